@@ -0,0 +1 @@
+/* Generated by perfect_table_gen: no table for 15x15, 5 in a row. */
@@ -0,0 +1,3293 @@
+/* Generated by perfect_table_gen (8533 reachable positions); do not edit. */
+
+#define PERFECT_TABLE_AVAILABLE 1
+#define PERFECT_TABLE_CODES 19683
+
+static const uint16_t perfectTable[2][PERFECT_TABLE_CODES] = {
+    {
+        0x0006,0x5f06,0x0006,0x5f06,0x0000,0x0006,0x0006,0x5f06,0x0000,0x5f06,0x0000,0x5f07,
+        0x0000,0x0000,0x6106,0x5f06,0x6106,0x5f07,0x0006,0x5f05,0x0000,0x0006,0x6106,0x0006,
+        0x0000,0x5f05,0x0000,0x5f06,0x0000,0x0006,0x0000,0x0000,0x6106,0x5f06,0x6308,0xa004,
+        0x0000,0x0000,0x6106,0x0000,0x0000,0x0000,0x6106,0x0000,0x6106,0x5f02,0x6308,0xa003,
+        0x6106,0x0000,0x6106,0x5f02,0x6308,0x0000,0x0006,0x5f06,0x0000,0x5f06,0x6304,0xa008,
+        0x0000,0x0006,0x0000,0x5f06,0x6303,0xa008,0x6302,0x0000,0xa008,0x5f0a,0x6106,0x0000,
+        0x0000,0x0006,0x0000,0x0006,0x6106,0x0000,0x0000,0x0000,0x0000,0x5f02,0x0000,0x0003,
+        0x0000,0x0000,0x6309,0x5f02,0x630a,0x0004,0x0000,0x0000,0x6308,0x0000,0x0000,0x0000,
+        0x6308,0x0000,0x6308,0x0002,0x630a,0x0003,0x6309,0x0000,0x6309,0x0002,0x630a,0x0000,
+        0x0000,0x0000,0x6307,0x0000,0x0000,0x0000,0x6307,0x0000,0x6307,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6307,0x6307,0x0000,0x6307,0x0000,0x0000,0x6307,
+        0x6307,0x6307,0x0001,0x5f02,0x630a,0x0008,0x6309,0x0000,0x6309,0x0002,0x630a,0x0000,
+        0x6308,0x0000,0x6308,0x0000,0x0000,0x6308,0x6308,0x6308,0x6308,0x0002,0x630a,0x0000,
+        0x6309,0x6309,0x6309,0x0000,0x630a,0x0000,0x0002,0x0003,0x0000,0x0002,0x6304,0xa00a,
+        0x0000,0x0009,0x0000,0x0002,0x6303,0x000a,0x6302,0x0000,0x000a,0x0009,0x0009,0x0000,
+        0x0000,0x0008,0x0000,0xa008,0x0008,0x0000,0x0000,0x0000,0x0000,0x0002,0x6308,0xa00a,
+        0x6102,0x0000,0x000a,0xa009,0x6308,0x0000,0x6102,0x0000,0x000a,0x0000,0x0000,0x000a,
+        0x0009,0x6308,0x9e07,0xa008,0x6308,0x0000,0x0008,0x6308,0x9e07,0x0000,0x6308,0x0000,
+        0x0000,0x0007,0x0000,0xa007,0x6304,0x0000,0x0000,0x0000,0x0000,0x0007,0x6303,0x0000,
+        0x6302,0x0001,0x9e07,0x0000,0x9e07,0x0000,0x0000,0x0000,0x0000,0x0000,0x9e07,0x0000,
+        0x0000,0x0000,0x0000,0x5f06,0x0000,0x5f04,0x0000,0x0000,0x6106,0x5f06,0x6106,0x5f04,
+        0x0000,0x0000,0x630a,0x0000,0x0000,0x0000,0x630a,0x0000,0x630a,0x0006,0x6106,0xa003,
+        0x6106,0x0000,0x6106,0xa002,0x6106,0x0000,0x0000,0x0000,0x6306,0x0000,0x0000,0x0000,
+        0x6306,0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6306,
+        0x6306,0x0000,0x6306,0x0000,0x0000,0x6306,0x6306,0x6306,0x0001,0x0006,0x6104,0x0008,
+        0x6104,0x0000,0x5f08,0x0002,0x610a,0x0000,0x630a,0x0000,0x630a,0x0000,0x0000,0x630a,
+        0x630a,0x630a,0x630a,0x0002,0x0006,0x0000,0x0006,0x6106,0x0008,0x0000,0x0006,0x0000,
+        0x0000,0x0000,0x6305,0x0000,0x0000,0x0000,0x6305,0x0000,0x6305,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6305,0x6305,0x0000,0x6305,0x0000,0x0000,0x6305,
+        0x6305,0x6305,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x6104,0x0000,0x0008,0x0000,0x0000,0x6309,
+        0x6104,0x630a,0x9e04,0x0000,0x0000,0x6308,0x0000,0x0000,0x0000,0x6308,0x0000,0x6308,
+        0x0002,0x630a,0x9e03,0x6309,0x0000,0x6309,0x0002,0x630a,0x0000,0x0002,0x6104,0xa00a,
+        0x6104,0x0000,0x000a,0xa009,0x0009,0x0000,0x630a,0x0000,0x630a,0x0000,0x0000,0x630a,
+        0x630a,0x630a,0x630a,0xa008,0x0008,0x0000,0x0008,0x0008,0x9e05,0x0000,0x9e05,0x0000,
+        0x5f02,0x0000,0xa00a,0x0000,0x0000,0x000a,0xa009,0x6308,0x9e04,0x0000,0x0000,0x630a,
+        0x0000,0x0000,0x0000,0x630a,0x0000,0x630a,0xa008,0x6308,0x9e03,0x0008,0x0000,0x9e08,
+        0x9e02,0x6308,0x0000,0x0002,0x6104,0x0000,0x6104,0x6304,0x9e04,0x0000,0x0009,0x0000,
+        0x630a,0x6303,0x630a,0x6302,0x0000,0x630a,0x630a,0x630a,0x0000,0x0000,0x0008,0x0000,
+        0x0008,0x0008,0x0000,0x0000,0x0000,0x0000,0x0006,0x5f06,0x0000,0x5f06,0x6304,0x0006,
+        0x0000,0x5f08,0x0000,0x5f06,0x6303,0x0006,0x6302,0x0000,0x6106,0x0006,0x6106,0x0000,
+        0x0000,0xa00a,0x0000,0xa00a,0xa00a,0x0000,0x0000,0x0000,0x0000,0x0006,0x6308,0x0004,
+        0x6102,0x0000,0x0006,0x0004,0x6308,0x0000,0x6102,0x0000,0x0006,0x0000,0x0000,0x6106,
+        0x6108,0x6308,0x0006,0x000a,0x6308,0x0000,0x5f0a,0x6308,0x000a,0x0000,0x6308,0x0000,
+        0x0000,0x5f06,0x0000,0x5f06,0x6304,0x0000,0x0000,0x0000,0x0000,0x5f06,0x6303,0x0000,
+        0x6302,0x0001,0x9e06,0x0000,0x6106,0x0000,0x0000,0x0000,0x0000,0x0000,0x9e06,0x0000,
+        0x0000,0x0000,0x0000,0x5f02,0x630a,0x0003,0x6309,0x0000,0x6309,0x0002,0x630a,0x0000,
+        0x6308,0x0000,0x6308,0x0000,0x0000,0x6308,0x6308,0x6308,0x6308,0x000a,0x630a,0x0000,
+        0x6309,0x6309,0x6309,0x0000,0x630a,0x0000,0x6102,0x0000,0x0003,0x0000,0x0000,0x6309,
+        0x6102,0x6308,0x0004,0x0000,0x0000,0x6308,0x0000,0x0000,0x0000,0x6308,0x0000,0x6308,
+        0x000a,0x6308,0x9e03,0x6309,0x0000,0x6309,0x9e02,0x6308,0x0000,0x5f02,0x630a,0x0000,
+        0x6309,0x6304,0x6309,0x0000,0x630a,0x0000,0x6308,0x6303,0x6308,0x6302,0x0000,0x6308,
+        0x6308,0x6308,0x0000,0x0000,0x630a,0x0000,0x6309,0x6309,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0005,0x0000,0xa005,0x6304,0x0000,0x0000,0x0000,0x0000,0x0005,0x6303,0x0000,
+        0x6302,0x0001,0x9e05,0x0000,0x9e05,0x0000,0x0000,0x0000,0x0000,0x0000,0x9e05,0x0000,
+        0x0000,0x0000,0x0000,0x0002,0x6308,0x0000,0x6102,0x6304,0x000a,0x0000,0x6308,0x0000,
+        0x6102,0x6303,0x000a,0x6302,0x0000,0x000a,0x0009,0x6308,0x0000,0x0000,0x6308,0x0000,
+        0x9e02,0x6308,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x5f06,0x0000,0x5f04,
+        0x0000,0x0000,0x6106,0x5f06,0x6305,0xa004,0x0000,0x0000,0x6306,0x0000,0x0000,0x0000,
+        0x6306,0x0000,0x6306,0x5f02,0x6305,0xa003,0x6109,0x0000,0x6109,0x5f02,0x6305,0x0000,
+        0x0000,0x0000,0x6106,0x0000,0x0000,0x0000,0x6302,0x0000,0xa004,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6306,0x6302,0x0000,0xa003,0x0000,0x0000,0x6106,
+        0x6302,0x0001,0x0001,0x5f06,0x6106,0x5f09,0x6106,0x0000,0x6106,0x5f0a,0x6106,0x0000,
+        0x6306,0x0000,0x6306,0x0000,0x0000,0x6306,0x6306,0x6306,0x6306,0x0006,0x610a,0x0000,
+        0x6109,0x6106,0x6109,0x0000,0x610a,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,
+        0x6304,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,
+        0x6102,0x0000,0x0003,0x0000,0x0000,0x6309,0x6102,0x6305,0x0001,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6307,0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,
+        0x6304,0x0000,0x6304,0x0000,0x0000,0x6304,0x6304,0x6304,0x6304,0x0000,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x6109,0x630a,0x0003,0x6309,0x0000,0x6309,
+        0x0002,0x630a,0x0000,0x0002,0x6305,0x000a,0x6102,0x0000,0x000a,0x0009,0x6305,0x0000,
+        0x6102,0x0000,0x610a,0x0000,0x0000,0x610a,0x0009,0x6305,0x9e05,0x0002,0x6305,0x0000,
+        0x0002,0x6305,0x000a,0x0000,0x6305,0x0000,0x6302,0x0000,0x000a,0x0000,0x0000,0x000a,
+        0x6302,0x0001,0x9e04,0x0000,0x0000,0x610a,0x0000,0x0000,0x0000,0x6302,0x0000,0x9e07,
+        0x6302,0x0001,0x9e03,0x6302,0x0000,0x000a,0x6302,0x0001,0x0000,0x0007,0x0007,0x0000,
+        0x0007,0x6304,0x9e04,0x0000,0x9e04,0x0000,0x0007,0x6303,0x9e03,0x6302,0x0000,0x9e07,
+        0x9e02,0x9e07,0x0000,0x0000,0x0007,0x0000,0x0007,0x0007,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6106,0x0000,0x0000,0x0000,0x6106,0x0000,0x6104,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6306,0x6105,0x0000,0x0003,0x0000,0x0000,0x6106,
+        0x5f02,0x6305,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6306,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6306,
+        0x0000,0x0000,0x0000,0x6306,0x0000,0x0001,0x6104,0x0000,0x6104,0x0000,0x0000,0x6106,
+        0x6104,0x6106,0x6104,0x0000,0x0000,0x6306,0x0000,0x0000,0x0000,0x6306,0x0000,0x6306,
+        0x0006,0x610a,0x0003,0x6109,0x0000,0x6109,0x0002,0x610a,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6305,0x0000,0x0000,0x0000,0x6305,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x6304,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x6109,0x0000,0x0003,
+        0x0000,0x0000,0x6309,0x0002,0x630a,0x0001,0x610a,0x0000,0x610a,0x0000,0x0000,0x610a,
+        0x0009,0x6305,0x9e04,0x0000,0x0000,0x630a,0x0000,0x0000,0x0000,0x630a,0x0000,0x630a,
+        0x0002,0x6305,0x9e03,0x0002,0x0000,0x000a,0x9e02,0x6305,0x0000,0x0000,0x0000,0x610a,
+        0x0000,0x0000,0x0000,0x6302,0x0000,0x9e04,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x630a,0x6302,0x0000,0x9e03,0x0000,0x0000,0x000a,0x6302,0x0001,0x0001,
+        0x610a,0x6104,0x610a,0x6104,0x0000,0x610a,0x0009,0x0009,0x0000,0x630a,0x0000,0x630a,
+        0x0000,0x0000,0x630a,0x630a,0x630a,0x630a,0x0002,0x0003,0x0000,0x0002,0x0009,0x000a,
+        0x0000,0x0009,0x0000,0x5f06,0x6305,0x000a,0x6106,0x0000,0x6106,0x5f02,0x6305,0x0000,
+        0x6306,0x0000,0x6306,0x0000,0x0000,0x6306,0x6306,0x6306,0x6306,0x5f0a,0x6305,0x0000,
+        0x5f0a,0x6305,0x000a,0x0000,0x6305,0x0000,0x6302,0x0000,0x0004,0x0000,0x0000,0x6106,
+        0x6302,0x0001,0xa004,0x0000,0x0000,0x6306,0x0000,0x0000,0x0000,0x6306,0x0000,0x6306,
+        0x6302,0x0001,0x9e06,0x6302,0x0000,0x000a,0x6302,0x0001,0x0000,0x5f06,0x6106,0x0000,
+        0x6106,0x6304,0x6106,0x0000,0x6106,0x0000,0x6306,0x6306,0x6306,0x6306,0x0000,0x6306,
+        0x6306,0x6306,0x0000,0x0000,0x9e06,0x0000,0x9e06,0x9e06,0x0000,0x0000,0x0000,0x0000,
+        0x6304,0x0000,0x6304,0x0000,0x0000,0x6304,0x6304,0x6304,0x6304,0x0000,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x610a,0x6305,0x9e03,0x6309,0x0000,0x6309,
+        0x9e02,0x6305,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x6302,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x6302,0x0000,0x9e03,
+        0x0000,0x0000,0x6309,0x6302,0x0001,0x0001,0x6304,0x6304,0x6304,0x6304,0x0000,0x6304,
+        0x6304,0x6304,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,
+        0x610a,0x630a,0x0000,0x6309,0x6309,0x6309,0x0000,0x630a,0x0000,0x0005,0x6305,0x0000,
+        0x0005,0x6304,0x9e04,0x0000,0x6305,0x0000,0x0005,0x6303,0x9e03,0x6302,0x0000,0x9e05,
+        0x9e02,0x6305,0x0000,0x0000,0x6305,0x0000,0x9e02,0x6305,0x0000,0x0000,0x0000,0x0000,
+        0x6302,0x0001,0x000a,0x6302,0x0000,0x000a,0x6302,0x0001,0x0000,0x6302,0x0000,0x000a,
+        0x0000,0x0000,0x000a,0x6302,0x0001,0x9e09,0x6302,0x0001,0x0000,0x6302,0x0001,0x000a,
+        0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0006,0x5f03,0x0000,0x5f02,0x6304,0xa005,
+        0x0000,0x0006,0x0000,0x5f02,0x6303,0xa005,0x6302,0x0000,0xa005,0x0006,0x610a,0x0000,
+        0x0000,0xa006,0x0000,0x0006,0x6106,0x0000,0x0000,0x0000,0x0000,0x0006,0x6106,0x0006,
+        0x6106,0x0000,0x6106,0x0006,0x6106,0x0000,0x6107,0x0000,0x6107,0x0000,0x0000,0x6106,
+        0x6107,0x6106,0x6107,0x0006,0x6106,0x0000,0x6106,0x6106,0x6106,0x0000,0x6106,0x0000,
+        0x0000,0x5f03,0x0000,0x5f02,0x6304,0x0000,0x0000,0x0000,0x0000,0x5f02,0x6303,0x0000,
+        0x6302,0x0001,0x0001,0x0000,0x610a,0x0000,0x0000,0x0000,0x0000,0x0000,0x6106,0x0000,
+        0x0000,0x0000,0x0000,0x0002,0x630a,0x0005,0x6309,0x0000,0x6309,0x0002,0x630a,0x0000,
+        0x6102,0x0000,0x0005,0x0000,0x0000,0x6309,0x6107,0x630a,0x0005,0x0003,0x630a,0x0000,
+        0x6309,0x6309,0x6309,0x0000,0x630a,0x0000,0x6307,0x0000,0x6307,0x0000,0x0000,0x6307,
+        0x6307,0x6307,0x6307,0x0000,0x0000,0x6307,0x0000,0x0000,0x0000,0x6307,0x0000,0x6307,
+        0x6307,0x6307,0x6307,0x6307,0x0000,0x6307,0x6307,0x6307,0x0000,0x0002,0x630a,0x0000,
+        0x6309,0x6304,0x0001,0x0000,0x630a,0x0000,0x6102,0x6303,0x0001,0x6302,0x0000,0x0001,
+        0x0002,0x630a,0x0000,0x0000,0x630a,0x0000,0x6309,0x6309,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0004,0x0000,0xa004,0x6304,0x0000,0x0000,0x0000,0x0000,0x0002,0x6303,0x0000,
+        0x6302,0x0001,0x9e05,0x0000,0x0009,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0xa004,0x0004,0x0000,0x0004,0x6304,0x9e04,0x0000,0x9e04,0x0000,
+        0x0002,0x6303,0x000a,0x6302,0x0000,0x000a,0x0009,0x0009,0x0000,0x0000,0x0001,0x0000,
+        0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x5f0a,0x6106,0xa005,
+        0x6106,0x0000,0xa005,0x0006,0x6106,0x0000,0x630a,0x0000,0x630a,0x0000,0x0000,0x630a,
+        0x630a,0x630a,0x630a,0x0006,0x6106,0x0000,0x6106,0x6106,0x9e06,0x0000,0x6106,0x0000,
+        0x6306,0x0000,0x6306,0x0000,0x0000,0x6306,0x6306,0x6306,0x6306,0x0000,0x0000,0x6306,
+        0x0000,0x0000,0x0000,0x6306,0x0000,0x6306,0x6306,0x6306,0x6306,0x6306,0x0000,0x6306,
+        0x6306,0x6306,0x0000,0x0002,0x6104,0x0000,0x5f02,0x6304,0x0001,0x0000,0x610a,0x0000,
+        0x630a,0x6303,0x0001,0x6302,0x0000,0x0001,0x630a,0x630a,0x0000,0x0000,0x0006,0x0000,
+        0x9e06,0x6106,0x0000,0x0000,0x0000,0x0000,0x6305,0x0000,0x6305,0x0000,0x0000,0x6305,
+        0x6305,0x6305,0x6305,0x0000,0x0000,0x6305,0x0000,0x0000,0x0000,0x6305,0x0000,0x6305,
+        0x6305,0x6305,0x6305,0x6305,0x0000,0x6305,0x6305,0x6305,0x0000,0x0000,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,
+        0x0002,0x630a,0x0001,0x6309,0x0000,0x0001,0x0002,0x630a,0x0000,0x630a,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x630a,0x630a,0x0001,0x0002,0x630a,0x0000,0x6309,0x6309,0x0001,
+        0x0000,0x630a,0x0000,0xa004,0x6104,0x0000,0x6104,0x6304,0x9e04,0x0000,0x9e04,0x0000,
+        0x630a,0x6303,0x630a,0x6302,0x0000,0x630a,0x630a,0x630a,0x0000,0x0000,0x0001,0x0000,
+        0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0xa004,0x6104,0x9e03,0x6104,0x0000,0x9e04,
+        0x9e02,0x9e04,0x0000,0x630a,0x0000,0x630a,0x0000,0x0000,0x630a,0x630a,0x630a,0x630a,
+        0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x6104,0x0000,
+        0x9e02,0x6304,0x0000,0x0000,0x0000,0x0000,0x630a,0x6303,0x0000,0x6302,0x0001,0x0001,
+        0x0000,0x630a,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0004,0x0000,0x0006,0x6304,0x0000,0x0000,0x0000,0x0000,0x0006,0x6303,0x0000,
+        0x6302,0x0001,0xa005,0x0000,0x0006,0x0000,0x0000,0x0000,0x0000,0x0000,0x9e06,0x0000,
+        0x0000,0x0000,0x0000,0x0004,0x0004,0x0000,0x0006,0x6304,0x0006,0x0000,0xa006,0x0000,
+        0x0006,0x6303,0x0006,0x6302,0x0000,0x0006,0x0006,0x0006,0x0000,0x0000,0x9e06,0x0000,
+        0x9e06,0x9e06,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0003,0x630a,0x0000,
+        0x6309,0x6304,0x6309,0x0000,0x630a,0x0000,0x6102,0x6303,0x0005,0x6302,0x0000,0x6309,
+        0x0002,0x630a,0x0000,0x0000,0x630a,0x0000,0x6309,0x6309,0x0000,0x0000,0x0000,0x0000,
+        0x0003,0x630a,0x0003,0x6309,0x0000,0x6309,0x0004,0x630a,0x0000,0x6102,0x0000,0x0003,
+        0x0000,0x0000,0x6309,0x0002,0x630a,0x0009,0x000a,0x630a,0x0000,0x6309,0x6309,0x6309,
+        0x0000,0x630a,0x0000,0x0000,0x630a,0x0000,0x6309,0x6304,0x0000,0x0000,0x0000,0x0000,
+        0x6102,0x6303,0x0000,0x6302,0x0001,0x0001,0x0000,0x630a,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6309,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0004,0x0000,
+        0x0004,0x6304,0x0000,0x0000,0x0000,0x0000,0x0002,0x6303,0x0000,0x6302,0x0001,0x000a,
+        0x0000,0x0009,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x5f06,0x0000,0x5f08,0x0000,0x0000,0x6306,0x0006,0x6108,0x0004,
+        0x0000,0x0000,0x6106,0x0000,0x0000,0x0000,0x6108,0x0000,0x6108,0x5f0a,0x6106,0xa003,
+        0x6306,0x0000,0x6306,0x0002,0x6108,0x0000,0x0000,0x0000,0x6106,0x0000,0x0000,0x0000,
+        0x6108,0x0000,0x5f04,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6106,
+        0x6106,0x0000,0xa003,0x0000,0x0000,0x6306,0x5f02,0x6308,0x0001,0x5f06,0x6106,0x5f08,
+        0x6306,0x0000,0x6306,0x0002,0x610a,0x0000,0x6106,0x0000,0x6108,0x0000,0x0000,0x6306,
+        0x6108,0x6106,0x6108,0x0006,0x6106,0x0000,0x6306,0x6306,0x6306,0x0000,0x610a,0x0000,
+        0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x6108,0x0000,0x0004,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x6303,0x0000,0x6303,0x0000,0x0000,0x0001,
+        0x0002,0x630a,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6307,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,
+        0x0000,0x0000,0x0000,0x6307,0x0000,0x0001,0x6303,0x0000,0x6303,0x0000,0x0000,0x0001,
+        0x6108,0x630a,0x9e04,0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x6308,0x0000,0x6308,
+        0x6303,0x6303,0x6303,0x0001,0x0000,0x0001,0x0002,0x630a,0x0000,0x0002,0x6108,0xa00a,
+        0x5f02,0x0000,0xa00a,0x0002,0x6108,0x0000,0x610a,0x0000,0x610a,0x0000,0x0000,0x610a,
+        0x610a,0x6108,0x610a,0xa008,0x6108,0x0000,0xa008,0x6108,0x9e05,0x0000,0x6108,0x0000,
+        0x6108,0x0000,0x000a,0x0000,0x0000,0x000a,0x6108,0x6308,0x9e04,0x0000,0x0000,0x610a,
+        0x0000,0x0000,0x0000,0x6108,0x0000,0x610a,0x6108,0x6308,0x9e03,0x6108,0x0000,0x9e07,
+        0x9e02,0x6308,0x0000,0xa007,0x0007,0x0000,0xa007,0x6304,0x9e04,0x0000,0x0007,0x0000,
+        0x0007,0x6303,0x9e03,0x6302,0x0000,0x9e07,0x0007,0x0007,0x0000,0x0000,0x9e03,0x0000,
+        0x9e02,0x9e07,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6106,0x0000,0x0000,0x0000,
+        0x610a,0x0000,0x5f04,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x630a,
+        0x6106,0x0000,0xa003,0x0000,0x0000,0x6306,0x5f02,0x6106,0x0001,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6306,0x0000,0x0000,0x0000,0x6306,0x0000,0x0001,
+        0x610a,0x0000,0x5f08,0x0000,0x0000,0x6306,0x610a,0x610a,0x9e06,0x0000,0x0000,0x630a,
+        0x0000,0x0000,0x0000,0x630a,0x0000,0x630a,0x0006,0x6106,0x9e06,0x6306,0x0000,0x6306,
+        0x0002,0x610a,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6305,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,
+        0x0000,0x0000,0x0000,0x6305,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,
+        0x0000,0x0000,0x0000,0x6104,0x0000,0x9e04,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6308,0x6303,0x0000,0x6303,0x0000,0x0000,0x0001,0x0002,0x630a,0x0001,
+        0x610a,0x0000,0x610a,0x0000,0x0000,0x610a,0x610a,0x6108,0x9e04,0x0000,0x0000,0x630a,
+        0x0000,0x0000,0x0000,0x630a,0x0000,0x630a,0x0008,0x6108,0x9e03,0x0008,0x0000,0x9e05,
+        0x9e02,0x6108,0x0000,0x0000,0x0000,0x610a,0x0000,0x0000,0x0000,0x6108,0x0000,0x9e04,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x630a,0x6108,0x0000,0x9e03,
+        0x0000,0x0000,0x9e08,0x9e02,0x6308,0x0001,0x610a,0x6104,0x9e03,0x6104,0x0000,0x9e04,
+        0x610a,0x610a,0x0000,0x630a,0x0000,0x630a,0x0000,0x0000,0x630a,0x630a,0x630a,0x630a,
+        0x0008,0x0008,0x0000,0x0008,0x0008,0x9e08,0x0000,0x0008,0x0000,0x5f06,0x6106,0x0006,
+        0x6306,0x0000,0x6306,0x0002,0x6108,0x0000,0x6106,0x0000,0x6106,0x0000,0x0000,0x6306,
+        0x6108,0x6106,0x6108,0x5f0a,0x610a,0x0000,0x6306,0x6306,0x6306,0x0000,0x610a,0x0000,
+        0x6108,0x0000,0x0006,0x0000,0x0000,0x6306,0x6108,0x6308,0x0004,0x0000,0x0000,0x6106,
+        0x0000,0x0000,0x0000,0x6108,0x0000,0x6108,0x5f0a,0x6308,0x9e06,0x6306,0x0000,0x6306,
+        0x9e06,0x6308,0x0000,0x5f06,0x6106,0x0000,0x6306,0x6306,0x6306,0x0000,0x0006,0x0000,
+        0x6106,0x6303,0x9e06,0x6306,0x0000,0x6306,0x0006,0x6106,0x0000,0x0000,0x9e06,0x0000,
+        0x6306,0x6306,0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x6303,0x0000,0x0000,0x0001,
+        0x6108,0x630a,0x0004,0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x6308,0x0000,0x6308,
+        0x6303,0x6303,0x6303,0x0001,0x0000,0x0001,0x9e02,0x630a,0x0000,0x0000,0x0000,0x6303,
+        0x0000,0x0000,0x0000,0x6102,0x0000,0x0004,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6308,0x6303,0x0000,0x6303,0x0000,0x0000,0x0001,0x9e02,0x6308,0x0001,
+        0x6303,0x6303,0x6303,0x0001,0x0000,0x0001,0x6108,0x630a,0x0000,0x6303,0x0000,0x6303,
+        0x0000,0x0000,0x0001,0x6308,0x6308,0x6308,0x6303,0x6303,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x630a,0x0000,0xa005,0x0005,0x0000,0xa005,0x6304,0x9e04,0x0000,0x0005,0x0000,
+        0x0005,0x6303,0x9e03,0x6302,0x0000,0x9e05,0x0005,0x0005,0x0000,0x0000,0x9e03,0x0000,
+        0x9e02,0x9e05,0x0000,0x0000,0x0000,0x0000,0x6108,0x6308,0x000a,0x6102,0x0000,0x000a,
+        0x6108,0x6308,0x0000,0x6102,0x0000,0x000a,0x0000,0x0000,0x000a,0x6108,0x6308,0x000a,
+        0x9e02,0x6308,0x0000,0x9e02,0x6308,0x9e08,0x0000,0x6308,0x0000,0x0000,0x0001,0x0000,
+        0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x630a,0x0000,0x0000,0x0000,0x630a,0x0000,0x630a,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6306,0x630a,0x0000,0x630a,0x0000,0x0000,0x6306,
+        0x630a,0x6305,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x630a,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x630a,
+        0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,0x630a,0x0000,0x630a,0x0000,0x0000,0x6306,
+        0x630a,0x630a,0x630a,0x0000,0x0000,0x6306,0x0000,0x0000,0x0000,0x6306,0x0000,0x6306,
+        0x630a,0x630a,0x630a,0x6306,0x0000,0x6306,0x630a,0x630a,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x630a,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x6304,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x6303,0x0000,0x6303,
+        0x0000,0x0000,0x0001,0x630a,0x630a,0x0001,0x630a,0x0000,0x630a,0x0000,0x0000,0x630a,
+        0x630a,0x6305,0x630a,0x0000,0x0000,0x630a,0x0000,0x0000,0x0000,0x630a,0x0000,0x630a,
+        0x630a,0x6305,0x630a,0x630a,0x0000,0x630a,0x630a,0x6305,0x0000,0x0000,0x0000,0x630a,
+        0x0000,0x0000,0x0000,0x6302,0x0000,0x630a,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x630a,0x6302,0x0000,0x630a,0x0000,0x0000,0x630a,0x6302,0x0001,0x0001,
+        0x630a,0x630a,0x630a,0x630a,0x0000,0x630a,0x630a,0x630a,0x0000,0x630a,0x0000,0x630a,
+        0x0000,0x0000,0x630a,0x630a,0x630a,0x630a,0x630a,0x630a,0x0000,0x630a,0x630a,0x630a,
+        0x0000,0x630a,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x630a,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x630a,
+        0x0000,0x0000,0x0000,0x630a,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x630a,
+        0x0000,0x0000,0x0000,0x630a,0x0000,0x630a,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6306,0x630a,0x0000,0x630a,0x0000,0x0000,0x6306,0x630a,0x630a,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x630a,0x0000,0x0001,0x0000,0x0000,0x630a,
+        0x0000,0x0000,0x0000,0x630a,0x0000,0x630a,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x630a,0x630a,0x0000,0x630a,0x0000,0x0000,0x630a,0x630a,0x6305,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x630a,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x630a,0x0000,0x0000,0x0000,
+        0x6302,0x0000,0x0001,0x630a,0x0000,0x630a,0x0000,0x0000,0x630a,0x630a,0x630a,0x630a,
+        0x0000,0x0000,0x630a,0x0000,0x0000,0x0000,0x630a,0x0000,0x000a,0x630a,0x630a,0x630a,
+        0x630a,0x0000,0x000a,0x630a,0x000a,0x0000,0x630a,0x0000,0x630a,0x0000,0x0000,0x6306,
+        0x630a,0x6305,0x630a,0x0000,0x0000,0x6306,0x0000,0x0000,0x0000,0x6306,0x0000,0x6306,
+        0x630a,0x6305,0x630a,0x6306,0x0000,0x6306,0x630a,0x6305,0x0000,0x0000,0x0000,0x630a,
+        0x0000,0x0000,0x0000,0x6302,0x0000,0x630a,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6306,0x6302,0x0000,0x630a,0x0000,0x0000,0x6306,0x6302,0x0001,0x0001,
+        0x630a,0x630a,0x630a,0x6306,0x0000,0x6306,0x630a,0x630a,0x0000,0x6306,0x0000,0x6306,
+        0x0000,0x0000,0x6306,0x6306,0x6306,0x6306,0x630a,0x630a,0x0000,0x6306,0x6306,0x6306,
+        0x0000,0x630a,0x0000,0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x6304,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x6303,0x0000,0x6303,
+        0x0000,0x0000,0x0001,0x630a,0x6305,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,0x6303,0x0000,0x6303,
+        0x0000,0x0000,0x0001,0x6304,0x6304,0x6304,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0001,0x6303,0x6303,0x6303,0x0001,0x0000,0x0001,0x630a,0x000a,0x0000,
+        0x630a,0x6305,0x630a,0x630a,0x0000,0x630a,0x630a,0x6305,0x0000,0x630a,0x0000,0x630a,
+        0x0000,0x0000,0x630a,0x630a,0x6305,0x630a,0x630a,0x6305,0x0000,0x630a,0x6305,0x630a,
+        0x0000,0x6305,0x0000,0x6302,0x0000,0x630a,0x0000,0x0000,0x630a,0x6302,0x0001,0x630a,
+        0x0000,0x0000,0x630a,0x0000,0x0000,0x0000,0x6302,0x0000,0x000a,0x6302,0x0001,0x630a,
+        0x6302,0x0000,0x000a,0x6302,0x0001,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,
+        0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0006,0x6106,0xa005,
+        0x6306,0x0000,0x6306,0x0002,0x0006,0x0000,0x6103,0x0000,0x0005,0x0000,0x0000,0x6306,
+        0x0006,0x610a,0x0005,0x0006,0x6106,0x0000,0x6306,0x6306,0x6306,0x0000,0x0006,0x0000,
+        0x6106,0x0000,0x6106,0x0000,0x0000,0x6306,0x0006,0x6106,0x0004,0x0000,0x0000,0x6106,
+        0x0000,0x0000,0x0000,0x6107,0x0000,0x6107,0x6106,0x6106,0x9e06,0x6306,0x0000,0x6306,
+        0x9e06,0x6106,0x0000,0xa002,0x6106,0x0000,0x6306,0x6306,0x0001,0x0000,0x0006,0x0000,
+        0x5f02,0x6303,0x0001,0x6306,0x0000,0x0001,0x0002,0x610a,0x0000,0x0000,0x6106,0x0000,
+        0x6306,0x6306,0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x6303,0x0000,0x0000,0x0001,
+        0x0002,0x630a,0x9e04,0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x6107,0x0000,0x0005,
+        0x6303,0x6303,0x6303,0x0001,0x0000,0x0001,0x0002,0x630a,0x0000,0x0000,0x0000,0x6303,
+        0x0000,0x0000,0x0000,0x6307,0x0000,0x6307,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6307,0x6303,0x0000,0x6303,0x0000,0x0000,0x0001,0x6307,0x6307,0x0001,
+        0x6303,0x6303,0x0001,0x0001,0x0000,0x0000,0x0002,0x630a,0x0000,0x6303,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x0002,0x630a,0x0001,0x6303,0x6303,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x630a,0x0000,0xa004,0x0004,0x0000,0xa004,0x6304,0x9e04,0x0000,0x0004,0x0000,
+        0x0002,0x6303,0x9e03,0x6302,0x0000,0x9e05,0x0002,0x0005,0x0000,0x0000,0x0001,0x0000,
+        0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0004,0x0004,0x9e03,0x0004,0x0000,0x9e04,
+        0x0004,0x0004,0x0000,0x0002,0x0000,0x000a,0x0000,0x0000,0x000a,0x0002,0x0007,0x000a,
+        0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x9e03,0x0000,
+        0x9e02,0x6304,0x0000,0x0000,0x0000,0x0000,0x9e02,0x6303,0x0000,0x6302,0x0001,0x0001,
+        0x0000,0x0007,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x6106,0x0000,0xa005,0x0000,0x0000,0x6306,0x0006,0x6106,0x9e06,0x0000,0x0000,0x630a,
+        0x0000,0x0000,0x0000,0x630a,0x0000,0x630a,0x6106,0x6106,0x9e06,0x6306,0x0000,0x6306,
+        0x9e06,0x6106,0x0000,0x0000,0x0000,0x6306,0x0000,0x0000,0x0000,0x6306,0x0000,0x6306,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6306,0x6306,0x0000,0x6306,
+        0x0000,0x0000,0x6306,0x6306,0x6306,0x0001,0x5f02,0x6106,0x0001,0x6306,0x0000,0x0001,
+        0x0002,0x610a,0x0000,0x630a,0x0000,0x0001,0x0000,0x0000,0x0000,0x630a,0x630a,0x0001,
+        0x9e06,0x6106,0x0000,0x6306,0x6306,0x0001,0x0000,0x0006,0x0000,0x0000,0x0000,0x6303,
+        0x0000,0x0000,0x0000,0x6305,0x0000,0x6305,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6305,0x6303,0x0000,0x6303,0x0000,0x0000,0x0001,0x6305,0x6305,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0000,0x6303,0x0000,0x0001,0x0000,0x0000,0x0000,0x0002,0x630a,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x630a,0x0000,0x0001,0x6303,0x6303,0x0001,
+        0x0001,0x0000,0x0000,0x0002,0x000a,0x0000,0x0004,0x6104,0x9e03,0x6104,0x0000,0x9e04,
+        0x0004,0x0004,0x0000,0x630a,0x0000,0x630a,0x0000,0x0000,0x630a,0x630a,0x630a,0x630a,
+        0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0004,0x0000,0x9e03,
+        0x0000,0x0000,0x9e04,0x0004,0x0004,0x9e04,0x0000,0x0000,0x630a,0x0000,0x0000,0x0000,
+        0x630a,0x0000,0x000a,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,
+        0x9e02,0x6104,0x0000,0x9e02,0x6304,0x0001,0x0000,0x0004,0x0000,0x630a,0x6303,0x0001,
+        0x6302,0x0000,0x0001,0x630a,0x000a,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0006,0x6106,0x0000,0x6306,0x6306,0x6306,0x0000,0x0006,0x0000,
+        0x6103,0x6303,0x0005,0x6306,0x0000,0x6306,0x0006,0x0006,0x0000,0x0000,0x9e06,0x0000,
+        0x6306,0x6306,0x0000,0x0000,0x0000,0x0000,0x0006,0x6106,0x0006,0x6306,0x0000,0x6306,
+        0x0004,0x0006,0x0000,0x6103,0x0000,0x0006,0x0000,0x0000,0x6306,0x0006,0x0006,0x0006,
+        0x9e06,0x9e06,0x0000,0x6306,0x6306,0x6306,0x0000,0x9e06,0x0000,0x0000,0x6106,0x0000,
+        0x6306,0x6306,0x0000,0x0000,0x0000,0x0000,0x9e06,0x6303,0x0000,0x6306,0x0001,0x0001,
+        0x0000,0x0006,0x0000,0x0000,0x0000,0x0000,0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,
+        0x6303,0x6303,0x6303,0x0001,0x0000,0x0001,0x0002,0x630a,0x0000,0x6303,0x0000,0x6303,
+        0x0000,0x0000,0x0001,0x0002,0x630a,0x0005,0x6303,0x6303,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x630a,0x0000,0x6303,0x0000,0x6303,0x0000,0x0000,0x0001,0x0002,0x630a,0x0004,
+        0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x0002,0x0000,0x000a,0x6303,0x6303,0x6303,
+        0x0001,0x0000,0x0001,0x9e02,0x000a,0x0000,0x6303,0x6303,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x630a,0x0000,0x6303,0x6303,0x0001,0x0001,0x0000,0x0000,0x0002,0x000a,0x0000,
+        0x0000,0x6303,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x9e03,0x0000,
+        0x9e02,0x6304,0x0000,0x0000,0x0000,0x0000,0x0005,0x6303,0x0000,0x6302,0x0001,0x9e05,
+        0x0000,0x0005,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0004,0x0004,0x0000,0x0004,0x6304,0x9e04,0x0000,0x0004,0x0000,0x0002,0x6303,0x000a,
+        0x6302,0x0000,0x000a,0x0002,0x000a,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0006,0x5f06,0x0000,0x0006,0x6304,0x0008,
+        0x0000,0x5f06,0x0000,0x5f06,0x6303,0x000a,0x6302,0x0000,0x0008,0x5f06,0x6106,0x0000,
+        0x0000,0x0008,0x0000,0x0008,0x0008,0x0000,0x0000,0x0000,0x0000,0x5f06,0x6308,0x0006,
+        0x6102,0x0000,0x0006,0x5f06,0x6308,0x0000,0x6106,0x0000,0x6106,0x0000,0x0000,0x6106,
+        0x6106,0x6308,0x6106,0x0006,0x6308,0x0000,0x0006,0x6308,0x0006,0x0000,0x6308,0x0000,
+        0x0000,0x5f04,0x0000,0x0008,0x6304,0x0000,0x0000,0x0000,0x0000,0x5f02,0x6303,0x0000,
+        0x6302,0x0001,0xa008,0x0000,0x6106,0x0000,0x0000,0x0000,0x0000,0x0000,0xa006,0x0000,
+        0x0000,0x0000,0x0000,0x5f02,0x630a,0x0005,0x6102,0x0000,0x0005,0x5f02,0x630a,0x0000,
+        0x6308,0x0000,0x6308,0x0000,0x0000,0x6308,0x6308,0x6308,0x6308,0x0005,0x630a,0x0000,
+        0x0005,0x630a,0x0005,0x0000,0x630a,0x0000,0x6307,0x0000,0x6307,0x0000,0x0000,0x6307,
+        0x6307,0x6307,0x6307,0x0000,0x0000,0x6307,0x0000,0x0000,0x0000,0x6307,0x0000,0x6307,
+        0x6307,0x6307,0x6307,0x6307,0x0000,0x6307,0x6307,0x6307,0x0000,0x0002,0x630a,0x0000,
+        0x6102,0x6304,0x0008,0x0000,0x630a,0x0000,0x6308,0x6303,0x6308,0x6302,0x0000,0x6308,
+        0x6308,0x6308,0x0000,0x0000,0x630a,0x0000,0x0008,0x630a,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0003,0x0000,0x0002,0x6304,0x0000,0x0000,0x0000,0x0000,0x0003,0x6303,0x0000,
+        0x6302,0x0001,0x000a,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0008,0x0000,
+        0x0000,0x0000,0x0000,0xa003,0x6308,0x0000,0x6102,0x6304,0x000a,0x0000,0x0001,0x0000,
+        0x0003,0x6303,0x9e03,0x6302,0x0000,0x000a,0x0001,0x0001,0x0000,0x0000,0x6308,0x0000,
+        0x0008,0x6308,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x5f06,0x6106,0x0006,
+        0x6104,0x0000,0x0006,0x5f06,0x6106,0x0000,0x630a,0x0000,0x630a,0x0000,0x0000,0x630a,
+        0x630a,0x630a,0x630a,0x0006,0x6106,0x0000,0x0006,0x6106,0x0006,0x0000,0x6106,0x0000,
+        0x6306,0x0000,0x6306,0x0000,0x0000,0x6306,0x6306,0x6306,0x6306,0x0000,0x0000,0x6306,
+        0x0000,0x0000,0x0000,0x6306,0x0000,0x6306,0x6306,0x6306,0x6306,0x6306,0x0000,0x6306,
+        0x6306,0x6306,0x0000,0x0002,0x6104,0x0000,0x6104,0x6304,0x0008,0x0000,0x0006,0x0000,
+        0x630a,0x6303,0x630a,0x6302,0x0000,0x630a,0x630a,0x630a,0x0000,0x0000,0x0006,0x0000,
+        0x0008,0x0006,0x0000,0x0000,0x0000,0x0000,0x6305,0x0000,0x6305,0x0000,0x0000,0x6305,
+        0x6305,0x6305,0x6305,0x0000,0x0000,0x6305,0x0000,0x0000,0x0000,0x6305,0x0000,0x6305,
+        0x6305,0x6305,0x6305,0x6305,0x0000,0x6305,0x6305,0x6305,0x0000,0x0000,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,
+        0x6104,0x630a,0x0008,0x6102,0x0000,0x0008,0x6104,0x630a,0x0000,0x6308,0x0000,0x6308,
+        0x0000,0x0000,0x6308,0x6308,0x6308,0x6308,0x0002,0x630a,0x0000,0x0002,0x630a,0x0008,
+        0x0000,0x630a,0x0000,0xa003,0x0003,0x0000,0x6104,0x6304,0x000a,0x0000,0x0001,0x0000,
+        0x630a,0x6303,0x630a,0x6302,0x0000,0x630a,0x0001,0x0001,0x0000,0x0000,0x9e03,0x0000,
+        0x0008,0x0008,0x0000,0x0000,0x0000,0x0000,0xa003,0x6308,0x9e03,0x6102,0x0000,0x000a,
+        0x0001,0x0001,0x0000,0x630a,0x0000,0x630a,0x0000,0x0000,0x630a,0x0001,0x0000,0x0001,
+        0x9e02,0x6308,0x0000,0x0008,0x6308,0x9e08,0x0000,0x0001,0x0000,0x0000,0x0003,0x0000,
+        0x6104,0x6304,0x0000,0x0000,0x0000,0x0000,0x630a,0x6303,0x0000,0x6302,0x0001,0x630a,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0008,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x5f04,0x0000,0x0008,0x6304,0x0000,0x0000,0x0000,0x0000,0x5f02,0x6303,0x0000,
+        0x6302,0x0001,0xa006,0x0000,0x6106,0x0000,0x0000,0x0000,0x0000,0x0000,0xa00a,0x0000,
+        0x0000,0x0000,0x0000,0x0004,0x6308,0x0000,0x6102,0x6304,0x000a,0x0000,0x6308,0x0000,
+        0x6102,0x6303,0x0006,0x6302,0x0000,0x0006,0x0006,0x6308,0x0000,0x0000,0x6308,0x0000,
+        0x000a,0x6308,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0004,0x630a,0x0000,
+        0x6102,0x6304,0x0008,0x0000,0x630a,0x0000,0x6308,0x6303,0x6308,0x6302,0x0000,0x6308,
+        0x6308,0x6308,0x0000,0x0000,0x630a,0x0000,0x000a,0x630a,0x0000,0x0000,0x0000,0x0000,
+        0x6102,0x6308,0x0004,0x6102,0x0000,0x0004,0x6102,0x6308,0x0000,0x6308,0x0000,0x6308,
+        0x0000,0x0000,0x6308,0x6308,0x6308,0x6308,0x000a,0x6308,0x0000,0x000a,0x6308,0x000a,
+        0x0000,0x6308,0x0000,0x0000,0x630a,0x0000,0x6102,0x6304,0x0000,0x0000,0x0000,0x0000,
+        0x6308,0x6303,0x0000,0x6302,0x0001,0x6308,0x0000,0x6308,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x630a,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x0000,
+        0x6102,0x6304,0x0000,0x0000,0x0000,0x0000,0x0003,0x6303,0x0000,0x6302,0x0001,0x000a,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x5f06,0x6305,0x0006,0x6102,0x0000,0x0006,0x5f06,0x6305,0x0000,
+        0x6306,0x0000,0x6306,0x0000,0x0000,0x6306,0x6306,0x6306,0x6306,0x0006,0x6305,0x0000,
+        0x0006,0x6305,0x0006,0x0000,0x6305,0x0000,0x6302,0x0000,0x6106,0x0000,0x0000,0x6106,
+        0x6302,0x0001,0x9e06,0x0000,0x0000,0x6306,0x0000,0x0000,0x0000,0x6306,0x0000,0x6306,
+        0x6302,0x0001,0xa003,0x6302,0x0000,0x0006,0x6302,0x0001,0x0000,0x0006,0x6106,0x0000,
+        0x6104,0x6304,0x0006,0x0000,0x6106,0x0000,0x6306,0x6306,0x6306,0x6306,0x0000,0x6306,
+        0x6306,0x6306,0x0000,0x0000,0x0006,0x0000,0x0006,0x0006,0x0000,0x0000,0x0000,0x0000,
+        0x6304,0x0000,0x6304,0x0000,0x0000,0x6304,0x6304,0x6304,0x6304,0x0000,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x6102,0x6305,0x0003,0x6102,0x0000,0x0005,
+        0x6102,0x6305,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x6302,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x6302,0x0000,0x6307,
+        0x0000,0x0000,0x6307,0x6302,0x0001,0x0001,0x6304,0x6304,0x6304,0x6304,0x0000,0x6304,
+        0x6304,0x6304,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,
+        0x0002,0x630a,0x0000,0x0002,0x630a,0x0007,0x0000,0x630a,0x0000,0x0003,0x6305,0x0000,
+        0x6102,0x6304,0x000a,0x0000,0x0001,0x0000,0x0003,0x6303,0x9e03,0x6302,0x0000,0x000a,
+        0x0001,0x0001,0x0000,0x0000,0x6305,0x0000,0x0002,0x6305,0x0000,0x0000,0x0000,0x0000,
+        0x6302,0x0001,0x9e03,0x6302,0x0000,0x000a,0x0001,0x0000,0x0000,0x6302,0x0000,0x9e03,
+        0x0000,0x0000,0x000a,0x0001,0x0000,0x0001,0x6302,0x0001,0x0000,0x6302,0x0001,0x000a,
+        0x0000,0x0000,0x0000,0x0000,0x9e03,0x0000,0x0007,0x6304,0x0000,0x0000,0x0000,0x0000,
+        0x9e02,0x6303,0x0000,0x6302,0x0001,0x9e07,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0007,0x0000,0x0000,0x0000,0x0000,0x6106,0x0000,0x6106,0x0000,0x0000,0x6106,
+        0x6106,0x6305,0x9e06,0x0000,0x0000,0x6306,0x0000,0x0000,0x0000,0x6306,0x0000,0x6306,
+        0x6105,0x6305,0x0003,0x6105,0x0000,0x0006,0x9e06,0x6305,0x0000,0x0000,0x0000,0x6306,
+        0x0000,0x0000,0x0000,0x6306,0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6306,0x6306,0x0000,0x6306,0x0000,0x0000,0x6306,0x6306,0x0001,0x0001,
+        0x6104,0x6106,0x6104,0x6104,0x0000,0x6104,0x0006,0x6106,0x0000,0x6306,0x0000,0x6306,
+        0x0000,0x0000,0x6306,0x6306,0x6306,0x6306,0x0006,0x0006,0x0000,0x0006,0x0006,0x0006,
+        0x0000,0x0006,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x6304,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x6305,0x0000,0x6305,
+        0x0000,0x0000,0x6305,0x6305,0x6305,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x6304,0x0000,0x6304,
+        0x0000,0x0000,0x6304,0x6304,0x6304,0x6304,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0001,0x0002,0x630a,0x0003,0x0002,0x0000,0x000a,0x0002,0x000a,0x0000,
+        0x0003,0x6305,0x9e03,0x6102,0x0000,0x000a,0x0001,0x0001,0x0000,0x630a,0x0000,0x630a,
+        0x0000,0x0000,0x630a,0x0001,0x0000,0x0001,0x0003,0x6305,0x0000,0x0002,0x6305,0x000a,
+        0x0000,0x0001,0x0000,0x6302,0x0000,0x9e03,0x0000,0x0000,0x000a,0x0001,0x0000,0x0001,
+        0x0000,0x0000,0x630a,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x6302,0x0001,0x9e03,
+        0x6302,0x0000,0x000a,0x0001,0x0000,0x0000,0x0003,0x0003,0x0000,0x6104,0x6304,0x000a,
+        0x0000,0x0001,0x0000,0x630a,0x6303,0x630a,0x6302,0x0000,0x000a,0x0001,0x0001,0x0000,
+        0x0000,0x0003,0x0000,0x0002,0x000a,0x0000,0x0000,0x0000,0x0000,0x5f02,0x6305,0x0000,
+        0x6102,0x6304,0x0006,0x0000,0x6305,0x0000,0x6306,0x6306,0x6306,0x6306,0x0000,0x6306,
+        0x6306,0x6306,0x0000,0x0000,0x6305,0x0000,0x000a,0x6305,0x0000,0x0000,0x0000,0x0000,
+        0x6302,0x0001,0xa006,0x6302,0x0000,0x0006,0x6302,0x0001,0x0000,0x6306,0x0000,0x6306,
+        0x0000,0x0000,0x6306,0x6306,0x0001,0x6306,0x6302,0x0001,0x0000,0x6302,0x0001,0x000a,
+        0x0000,0x0000,0x0000,0x0000,0x6106,0x0000,0x0006,0x6304,0x0000,0x0000,0x0000,0x0000,
+        0x6306,0x6306,0x0000,0x6306,0x0001,0x6306,0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x9e06,0x0000,0x0000,0x0000,0x0000,0x6304,0x6304,0x6304,0x6304,0x0000,0x6304,
+        0x6304,0x6304,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,
+        0x000a,0x6305,0x0000,0x000a,0x6305,0x000a,0x0000,0x6305,0x0000,0x6302,0x0000,0x6304,
+        0x0000,0x0000,0x6304,0x6302,0x0001,0x6304,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0001,0x6302,0x0001,0x9e03,0x6302,0x0000,0x000a,0x6302,0x0001,0x0000,
+        0x6304,0x6304,0x0000,0x6304,0x6304,0x6304,0x0000,0x6304,0x0000,0x0001,0x0001,0x0000,
+        0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x630a,0x0000,0x000a,0x000a,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x6305,0x0000,0x0005,0x6304,0x0000,0x0000,0x0000,0x0000,
+        0x9e02,0x6303,0x0000,0x6302,0x0001,0x9e05,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6305,0x0000,0x0000,0x0000,0x0000,0x6302,0x0001,0x0000,0x6302,0x0001,0x000a,
+        0x0000,0x0000,0x0000,0x6302,0x0001,0x9e03,0x6302,0x0000,0x000a,0x0001,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0xa00a,0x0000,0x000a,0x6304,0x0000,0x0000,0x0000,0x0000,0x5f0a,0x6303,0x0000,
+        0x6302,0x0001,0x9e06,0x0000,0x9e06,0x0000,0x0000,0x0000,0x0000,0x0000,0x9e06,0x0000,
+        0x0000,0x0000,0x0000,0xa00a,0xa00a,0x0000,0x5f0a,0x6304,0x000a,0x0000,0x9e06,0x0000,
+        0x5f0a,0x6303,0x000a,0x6302,0x0000,0x000a,0x9e06,0x9e06,0x0000,0x0000,0x9e06,0x0000,
+        0x9e06,0x9e06,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x000a,0x630a,0x0000,
+        0x000a,0x6304,0x9e04,0x0000,0x630a,0x0000,0x610a,0x6303,0x9e03,0x6302,0x0000,0x9e05,
+        0x610a,0x630a,0x0000,0x0000,0x630a,0x0000,0x000a,0x630a,0x0000,0x0000,0x0000,0x0000,
+        0x6307,0x6307,0x6307,0x6307,0x0000,0x6307,0x6307,0x6307,0x0000,0x6307,0x0000,0x6307,
+        0x0000,0x0000,0x6307,0x6307,0x6307,0x6307,0x6307,0x6307,0x0000,0x6307,0x6307,0x6307,
+        0x0000,0x6307,0x0000,0x0000,0x630a,0x0000,0x9e02,0x6304,0x0000,0x0000,0x0000,0x0000,
+        0x9e02,0x6303,0x0000,0x6302,0x0001,0x0001,0x0000,0x630a,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x630a,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9e03,0x0000,
+        0x9e02,0x6304,0x0000,0x0000,0x0000,0x0000,0x9e02,0x6303,0x0000,0x6302,0x0001,0x000a,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x5f0a,0x610a,0x0000,0x5f0a,0x6304,0x9e06,0x0000,0x9e06,0x0000,
+        0x630a,0x6303,0x630a,0x6302,0x0000,0x630a,0x630a,0x630a,0x0000,0x0000,0x9e06,0x0000,
+        0x9e06,0x9e06,0x0000,0x0000,0x0000,0x0000,0x6306,0x6306,0x6306,0x6306,0x0000,0x6306,
+        0x6306,0x6306,0x0000,0x6306,0x0000,0x6306,0x0000,0x0000,0x6306,0x6306,0x6306,0x6306,
+        0x6306,0x6306,0x0000,0x6306,0x6306,0x6306,0x0000,0x6306,0x0000,0x0000,0x610a,0x0000,
+        0x9e06,0x6304,0x0000,0x0000,0x0000,0x0000,0x630a,0x6303,0x0000,0x6302,0x0001,0x0001,
+        0x0000,0x630a,0x0000,0x0000,0x0000,0x0000,0x0000,0x9e06,0x0000,0x0000,0x0000,0x0000,
+        0x6305,0x6305,0x6305,0x6305,0x0000,0x6305,0x6305,0x6305,0x0000,0x6305,0x0000,0x6305,
+        0x0000,0x0000,0x6305,0x6305,0x6305,0x6305,0x6305,0x6305,0x0000,0x6305,0x6305,0x6305,
+        0x0000,0x6305,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0001,0x0000,
+        0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x9e02,0x630a,0x0000,0x9e02,0x6304,0x0001,
+        0x0000,0x630a,0x0000,0x630a,0x6303,0x0001,0x6302,0x0000,0x0001,0x630a,0x000a,0x0000,
+        0x0000,0x630a,0x0000,0x9e02,0x000a,0x0000,0x0000,0x0000,0x0000,0x0000,0x9e03,0x0000,
+        0x9e02,0x6304,0x0000,0x0000,0x0000,0x0000,0x630a,0x6303,0x0000,0x6302,0x0001,0x630a,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x9e02,0x9e03,0x0000,0x9e02,0x6304,0x9e04,0x0000,0x0001,0x0000,0x630a,0x6303,0x630a,
+        0x6302,0x0000,0x000a,0x0001,0x0001,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6303,0x0000,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xa00a,0x0000,
+        0x000a,0x6304,0x0000,0x0000,0x0000,0x0000,0x000a,0x6303,0x0000,0x6302,0x0001,0x000a,
+        0x0000,0x9e06,0x0000,0x0000,0x0000,0x0000,0x0000,0x9e06,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x630a,0x0000,0x000a,0x6304,0x0000,0x0000,0x0000,0x0000,
+        0x000a,0x6303,0x0000,0x6302,0x0001,0x9e05,0x0000,0x630a,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x630a,0x0000,0x0000,0x0000,0x0000,0x000a,0x630a,0x0000,0x000a,0x6304,0x000a,
+        0x0000,0x630a,0x0000,0x000a,0x6303,0x000a,0x6302,0x0000,0x000a,0x000a,0x000a,0x0000,
+        0x0000,0x630a,0x0000,0x000a,0x000a,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x6302,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6303,0x0000,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x5f06,0x0000,0x5f04,
+        0x0000,0x0000,0x6109,0x5f06,0x6306,0x5f04,0x0000,0x0000,0x6307,0x0000,0x0000,0x0000,
+        0x6307,0x0000,0x6307,0x5f02,0x6306,0xa003,0x6106,0x0000,0x6109,0xa002,0x6306,0x0000,
+        0x0000,0x0000,0x6107,0x0000,0x0000,0x0000,0x6106,0x0000,0x5f04,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6307,0x6106,0x0000,0x0003,0x0000,0x0000,0x6106,
+        0x6102,0x6306,0x0001,0x5f06,0x6306,0x5f08,0x6106,0x0000,0x5f08,0x5f04,0x6306,0x0000,
+        0x6307,0x0000,0x6307,0x0000,0x0000,0x6307,0x6307,0x6306,0x6307,0x0008,0x6306,0x0000,
+        0x6106,0x6306,0x0008,0x0000,0x6306,0x0000,0x0000,0x0000,0x6104,0x0000,0x0000,0x0000,
+        0x6302,0x0000,0x6104,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6307,
+        0x6302,0x0000,0x0003,0x0000,0x0000,0x6309,0x6302,0x0001,0x0001,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6307,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6307,0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,
+        0x6302,0x0000,0x6108,0x0000,0x0000,0x6309,0x6302,0x0001,0x9e04,0x0000,0x0000,0x6307,
+        0x0000,0x0000,0x0000,0x6302,0x0000,0x6307,0x6302,0x0001,0x9e03,0x6302,0x0000,0x6309,
+        0x6302,0x0001,0x0000,0x0002,0x6104,0x0004,0x6104,0x0000,0x0004,0x0009,0x0009,0x0000,
+        0x6307,0x0000,0x6307,0x0000,0x0000,0x6307,0x6307,0x6307,0x6307,0x0008,0x6108,0x0000,
+        0x0008,0x6108,0x0008,0x0000,0x9e05,0x0000,0x6108,0x0000,0x0003,0x0000,0x0000,0x0004,
+        0x0009,0x6308,0x9e04,0x0000,0x0000,0x6307,0x0000,0x0000,0x0000,0x6307,0x0000,0x6307,
+        0x6108,0x6308,0x9e03,0x6108,0x0000,0x0008,0x9e02,0x6308,0x0000,0x0007,0x0007,0x0000,
+        0x0007,0x6304,0x9e04,0x0000,0x9e04,0x0000,0x6307,0x6303,0x6307,0x6302,0x0000,0x6307,
+        0x6307,0x6307,0x0000,0x0000,0x9e03,0x0000,0x9e02,0x9e07,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x6304,0x0000,0x6304,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x6106,0x0000,0xa003,0x0000,0x0000,0x6106,
+        0xa002,0x6306,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6306,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6306,
+        0x0000,0x0000,0x0000,0x6306,0x0000,0x0001,0x6304,0x0000,0x6304,0x0000,0x0000,0x6304,
+        0x6304,0x6306,0x6304,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,
+        0x0002,0x6306,0x9e06,0x6106,0x0000,0x0008,0xa002,0x6306,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6305,0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x6302,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x6302,0x0000,0x9e03,
+        0x0000,0x0000,0x6309,0x6302,0x0001,0x0001,0x6304,0x0000,0x6304,0x0000,0x0000,0x6304,
+        0x6304,0x6304,0x6304,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,
+        0x0008,0x6108,0x9e03,0x0008,0x0000,0x0008,0x9e02,0x9e05,0x0000,0x0000,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x6304,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x6108,0x0000,0x9e03,0x0000,0x0000,0x0008,0x9e02,0x6308,0x0001,
+        0x6304,0x6304,0x6304,0x6304,0x0000,0x6304,0x6304,0x6304,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,0x0008,0x0008,0x0000,0x0008,0x0008,0x0008,
+        0x0000,0x9e08,0x0000,0x5f06,0x6306,0x0006,0x6106,0x0000,0x6109,0x5f08,0x6306,0x0000,
+        0x6106,0x0000,0x6108,0x0000,0x0000,0x6106,0x6106,0x6306,0x6108,0x5f08,0x6306,0x0000,
+        0x6106,0x6306,0x6109,0x0000,0x6306,0x0000,0x6102,0x0000,0x0006,0x0000,0x0000,0x6109,
+        0x6102,0x6306,0x0004,0x0000,0x0000,0x6108,0x0000,0x0000,0x0000,0x6106,0x0000,0x6108,
+        0x6102,0x6306,0x0003,0x6106,0x0000,0x6109,0x6102,0x6306,0x0000,0x5f06,0x6306,0x0000,
+        0x6106,0x6306,0x9e06,0x0000,0x6306,0x0000,0x6106,0x6306,0x9e06,0x6302,0x0000,0x9e06,
+        0x6106,0x6306,0x0000,0x0000,0x6306,0x0000,0x6106,0x6306,0x0000,0x0000,0x0000,0x0000,
+        0x6302,0x0000,0x6108,0x0000,0x0000,0x6309,0x6302,0x0001,0x0004,0x0000,0x0000,0x6308,
+        0x0000,0x0000,0x0000,0x6302,0x0000,0x6308,0x6302,0x0001,0x0003,0x6302,0x0000,0x6309,
+        0x6302,0x0001,0x0000,0x0000,0x0000,0x6108,0x0000,0x0000,0x0000,0x6302,0x0000,0x0004,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x6302,0x0000,0x0003,
+        0x0000,0x0000,0x6309,0x6302,0x0001,0x0001,0x6302,0x0001,0x6108,0x6302,0x0000,0x6309,
+        0x6302,0x0001,0x0000,0x6302,0x0000,0x6308,0x0000,0x0000,0x6308,0x6302,0x0001,0x6308,
+        0x6302,0x0001,0x0000,0x6302,0x0001,0x6309,0x0000,0x0000,0x0000,0x0005,0x0005,0x0000,
+        0x0005,0x6304,0x0005,0x0000,0x9e04,0x0000,0x0005,0x6303,0x0005,0x6302,0x0000,0x0005,
+        0x9e02,0x9e05,0x0000,0x0000,0x9e03,0x0000,0x9e02,0x9e05,0x0000,0x0000,0x0000,0x0000,
+        0x6108,0x6308,0x0003,0x6102,0x0000,0x0004,0x0009,0x6308,0x0000,0x6102,0x0000,0x0003,
+        0x0000,0x0000,0x0008,0x0009,0x6308,0x0009,0x6108,0x6308,0x0000,0x6108,0x6308,0x0008,
+        0x0000,0x6308,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6309,0x0000,0x0000,0x0000,
+        0x6309,0x0000,0x6309,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6306,
+        0x6309,0x0000,0x6309,0x0000,0x0000,0x6309,0x6309,0x6306,0x0001,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6309,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6309,0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,
+        0x6309,0x0000,0x6309,0x0000,0x0000,0x6309,0x6309,0x6306,0x6309,0x0000,0x0000,0x6306,
+        0x0000,0x0000,0x0000,0x6306,0x0000,0x6306,0x6309,0x6306,0x6309,0x6309,0x0000,0x6309,
+        0x6309,0x6306,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6309,
+        0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x6302,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x6302,0x0000,0x6309,0x0000,0x0000,0x6309,0x6302,0x0001,0x0001,
+        0x6309,0x0000,0x6309,0x0000,0x0000,0x6309,0x6309,0x6305,0x6309,0x0000,0x0000,0x6307,
+        0x0000,0x0000,0x0000,0x6307,0x0000,0x6307,0x6309,0x6305,0x6309,0x6309,0x0000,0x6309,
+        0x6309,0x6305,0x0000,0x0000,0x0000,0x6309,0x0000,0x0000,0x0000,0x6302,0x0000,0x6309,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6307,0x6302,0x0000,0x6309,
+        0x0000,0x0000,0x6309,0x6302,0x0001,0x0001,0x6309,0x6309,0x6309,0x6309,0x0000,0x6309,
+        0x6309,0x6309,0x0000,0x6307,0x0000,0x6307,0x0000,0x0000,0x6307,0x6307,0x6307,0x6307,
+        0x6309,0x6309,0x0000,0x6309,0x6309,0x6309,0x0000,0x6309,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6309,0x0000,0x0000,0x0000,0x6309,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x6304,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x6309,0x0000,0x6309,
+        0x0000,0x0000,0x6309,0x6309,0x6306,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6309,0x0000,0x0000,0x0000,
+        0x6302,0x0000,0x0001,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x6304,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x6309,0x0000,0x6309,
+        0x0000,0x0000,0x6309,0x6309,0x6305,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6309,0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,0x6304,0x0000,0x6304,
+        0x0000,0x0000,0x6304,0x6304,0x6304,0x6304,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0001,0x6309,0x6309,0x6309,0x6309,0x0000,0x0009,0x6309,0x0009,0x0000,
+        0x6309,0x0000,0x6309,0x0000,0x0000,0x6309,0x6309,0x6306,0x6309,0x0000,0x0000,0x6306,
+        0x0000,0x0000,0x0000,0x6306,0x0000,0x6306,0x6309,0x6306,0x6309,0x6309,0x0000,0x6309,
+        0x6309,0x6306,0x0000,0x0000,0x0000,0x6309,0x0000,0x0000,0x0000,0x6302,0x0000,0x6309,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6306,0x6302,0x0000,0x6309,
+        0x0000,0x0000,0x6309,0x6302,0x0001,0x0001,0x6309,0x6306,0x6309,0x6309,0x0000,0x6309,
+        0x6309,0x6306,0x0000,0x6306,0x0000,0x6306,0x0000,0x0000,0x6306,0x6306,0x6306,0x6306,
+        0x6309,0x6306,0x0000,0x6309,0x6306,0x6309,0x0000,0x6306,0x0000,0x0000,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x6302,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x6302,0x0000,0x6309,0x0000,0x0000,0x6309,0x6302,0x0001,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6309,0x0000,0x0000,0x0000,
+        0x6302,0x0000,0x0001,0x6302,0x0000,0x6304,0x0000,0x0000,0x6304,0x6302,0x0001,0x6304,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x6302,0x0001,0x6309,
+        0x6302,0x0000,0x0009,0x6302,0x0001,0x0000,0x6309,0x6305,0x6309,0x6309,0x0000,0x6309,
+        0x6309,0x6305,0x0000,0x6309,0x0000,0x6309,0x0000,0x0000,0x6309,0x6309,0x6305,0x6309,
+        0x6309,0x6305,0x0000,0x6309,0x6305,0x6309,0x0000,0x6305,0x0000,0x6302,0x0000,0x6309,
+        0x0000,0x0000,0x6309,0x6302,0x0001,0x6309,0x0000,0x0000,0x6309,0x0000,0x0000,0x0000,
+        0x6302,0x0000,0x0009,0x6302,0x0001,0x6309,0x6302,0x0000,0x0009,0x6302,0x0001,0x0000,
+        0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x5f02,0x6306,0xa005,0x6106,0x0000,0x0005,0x0004,0x6306,0x0000,
+        0x6307,0x0000,0x6307,0x0000,0x0000,0x6307,0x6307,0x6306,0x6307,0xa006,0x6306,0x0000,
+        0x6106,0x6306,0x9e06,0x0000,0x6306,0x0000,0x6106,0x0000,0x6107,0x0000,0x0000,0x6106,
+        0x6106,0x6306,0x0004,0x0000,0x0000,0x6307,0x0000,0x0000,0x0000,0x6307,0x0000,0x6307,
+        0x6106,0x6306,0x9e06,0x6106,0x0000,0x6106,0x9e06,0x6306,0x0000,0xa002,0x6306,0x0000,
+        0x6102,0x6306,0x0001,0x0000,0x6306,0x0000,0x6307,0x6306,0x0001,0x6302,0x0000,0x0001,
+        0x6307,0x6306,0x0000,0x0000,0x6306,0x0000,0x9e06,0x6306,0x0000,0x0000,0x0000,0x0000,
+        0x6302,0x0000,0x0005,0x0000,0x0000,0x6309,0x6302,0x0001,0x9e04,0x0000,0x0000,0x6307,
+        0x0000,0x0000,0x0000,0x6302,0x0000,0x6307,0x6302,0x0001,0x9e03,0x6302,0x0000,0x6309,
+        0x6302,0x0001,0x0000,0x0000,0x0000,0x6307,0x0000,0x0000,0x0000,0x6302,0x0000,0x6307,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6307,0x6302,0x0000,0x6307,
+        0x0000,0x0000,0x6307,0x6302,0x0001,0x0001,0x6302,0x0001,0x0001,0x6302,0x0000,0x0001,
+        0x6302,0x0001,0x0000,0x6302,0x0000,0x0001,0x0000,0x0000,0x0000,0x6302,0x0001,0x0001,
+        0x6302,0x0001,0x0000,0x6302,0x0001,0x0001,0x0000,0x0000,0x0000,0x0004,0x6104,0x0000,
+        0x6104,0x6304,0x9e04,0x0000,0x9e04,0x0000,0x6307,0x6303,0x6307,0x6302,0x0000,0x6307,
+        0x6307,0x6307,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0004,0x6104,0x0004,0x6104,0x0000,0x0004,0x9e02,0x9e04,0x0000,0x6307,0x0000,0x6307,
+        0x0000,0x0000,0x6307,0x6307,0x6307,0x6307,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0001,0x0000,0x0000,0x9e03,0x0000,0x9e02,0x6304,0x0000,0x0000,0x0000,0x0000,
+        0x6307,0x6303,0x0000,0x6302,0x0001,0x0001,0x0000,0x6307,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x6304,0x0000,0x0000,0x6304,
+        0x6304,0x6306,0x6304,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,
+        0x6106,0x6306,0x9e06,0x6106,0x0000,0x9e06,0x9e06,0x6306,0x0000,0x0000,0x0000,0x6306,
+        0x0000,0x0000,0x0000,0x6306,0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x6306,0x0000,0x6306,0x0000,0x0000,0x6306,0x6306,0x6306,0x0001,
+        0x6304,0x6306,0x0001,0x6304,0x0000,0x0001,0x6304,0x6306,0x0000,0x0001,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,0x9e06,0x6306,0x0000,0x9e06,0x6306,0x0001,
+        0x0000,0x6306,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x6302,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x6302,0x0000,0x6305,
+        0x0000,0x0000,0x6305,0x6302,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x6302,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x6302,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0000,0x6302,0x0001,0x0001,0x6302,0x0000,0x0001,0x6302,0x0001,0x0000,
+        0x6304,0x6304,0x6304,0x6304,0x0000,0x6304,0x6304,0x6304,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0001,0x0000,0x6304,0x0000,0x6304,0x0000,0x0000,0x6304,0x6304,0x6304,0x6304,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0001,
+        0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,0x6304,0x6304,0x0000,0x6304,0x6304,0x0001,
+        0x0000,0x6304,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,
+        0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0006,0x6306,0x0000,
+        0x6106,0x6306,0x0005,0x0000,0x6306,0x0000,0x6102,0x6306,0x0005,0x6302,0x0000,0x0005,
+        0x0006,0x6306,0x0000,0x0000,0x6306,0x0000,0x6106,0x6306,0x0000,0x0000,0x0000,0x0000,
+        0x0006,0x6306,0x0006,0x6106,0x0000,0x0006,0x0006,0x6306,0x0000,0x6102,0x0000,0x0006,
+        0x0000,0x0000,0x0006,0x0006,0x6306,0x0006,0x0006,0x6306,0x0000,0x6106,0x6306,0x0006,
+        0x0000,0x6306,0x0000,0x0000,0x6306,0x0000,0x9e06,0x6306,0x0000,0x0000,0x0000,0x0000,
+        0x9e06,0x6306,0x0000,0x6302,0x0001,0x0001,0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,0x6302,0x0001,0x0005,0x6302,0x0000,0x6309,
+        0x6302,0x0001,0x0000,0x6302,0x0000,0x0005,0x0000,0x0000,0x6309,0x6302,0x0001,0x0005,
+        0x6302,0x0001,0x0000,0x6302,0x0001,0x6309,0x0000,0x0000,0x0000,0x6302,0x0000,0x0003,
+        0x0000,0x0000,0x6309,0x6302,0x0001,0x0004,0x0000,0x0000,0x0003,0x0000,0x0000,0x0000,
+        0x6302,0x0000,0x0009,0x6302,0x0001,0x0003,0x6302,0x0000,0x0009,0x6302,0x0001,0x0000,
+        0x6302,0x0001,0x0000,0x6302,0x0001,0x0001,0x0000,0x0000,0x0000,0x6302,0x0001,0x0001,
+        0x6302,0x0000,0x0001,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,0x6302,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x9e03,0x0000,0x9e02,0x6304,0x0000,0x0000,0x0000,0x0000,
+        0x0005,0x6303,0x0000,0x6302,0x0001,0x0005,0x0000,0x9e05,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0004,0x0004,0x0000,0x0004,0x6304,0x0004,
+        0x0000,0x9e04,0x0000,0x0002,0x6303,0x0003,0x6302,0x0000,0x0009,0x0009,0x0009,0x0000,
+        0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6308,0x0000,0x0000,0x0000,0x6308,0x0000,0x6308,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6307,0x6308,0x0000,0x6308,0x0000,0x0000,0x6306,
+        0x6308,0x6306,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,
+        0x0000,0x0000,0x0000,0x6308,0x0000,0x0001,0x6308,0x0000,0x6308,0x0000,0x0000,0x6306,
+        0x6308,0x6306,0x6308,0x0000,0x0000,0x6307,0x0000,0x0000,0x0000,0x6307,0x0000,0x6307,
+        0x6308,0x6306,0x6308,0x6306,0x0000,0x6306,0x6308,0x6306,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x6302,0x0000,0x6308,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6307,0x6302,0x0000,0x6303,
+        0x0000,0x0000,0x0001,0x6302,0x0001,0x0001,0x6308,0x0000,0x6308,0x0000,0x0000,0x6308,
+        0x6308,0x6308,0x6308,0x0000,0x0000,0x6307,0x0000,0x0000,0x0000,0x6307,0x0000,0x6307,
+        0x6308,0x6308,0x6308,0x6308,0x0000,0x6308,0x6308,0x6308,0x0000,0x0000,0x0000,0x6308,
+        0x0000,0x0000,0x0000,0x6308,0x0000,0x6308,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6307,0x6308,0x0000,0x6308,0x0000,0x0000,0x6308,0x6308,0x6308,0x0001,
+        0x6308,0x6308,0x6308,0x6308,0x0000,0x6308,0x6308,0x6308,0x0000,0x6307,0x0000,0x6307,
+        0x0000,0x0000,0x6307,0x6307,0x6307,0x6307,0x6308,0x6308,0x0000,0x6308,0x6308,0x6308,
+        0x0000,0x6308,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,
+        0x0000,0x0000,0x0000,0x6308,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x6304,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x6308,0x0000,0x6308,0x0000,0x0000,0x6306,0x6308,0x6306,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,0x0000,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x6304,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x6308,0x0000,0x6308,0x0000,0x0000,0x6308,0x6308,0x6308,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x0000,0x0000,0x0000,
+        0x6308,0x0000,0x0001,0x6304,0x0000,0x6304,0x0000,0x0000,0x6304,0x6304,0x6304,0x6304,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x6308,0x6308,0x6308,
+        0x6308,0x0000,0x0008,0x6308,0x0008,0x0000,0x6308,0x0000,0x6308,0x0000,0x0000,0x6306,
+        0x6308,0x6306,0x6308,0x0000,0x0000,0x6308,0x0000,0x0000,0x0000,0x6308,0x0000,0x6308,
+        0x6308,0x6306,0x6308,0x6306,0x0000,0x6306,0x6308,0x6306,0x0000,0x0000,0x0000,0x6308,
+        0x0000,0x0000,0x0000,0x6308,0x0000,0x6308,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6308,0x6308,0x0000,0x6308,0x0000,0x0000,0x6306,0x6308,0x6306,0x0001,
+        0x6308,0x6306,0x6308,0x6306,0x0000,0x6306,0x6308,0x6306,0x0000,0x6308,0x0000,0x6308,
+        0x0000,0x0000,0x6306,0x6308,0x6306,0x6308,0x6308,0x6306,0x0000,0x6306,0x6306,0x6306,
+        0x0000,0x6306,0x0000,0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x6302,0x0000,0x6308,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x6302,0x0000,0x6303,
+        0x0000,0x0000,0x0001,0x6302,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6308,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,0x6302,0x0000,0x6303,
+        0x0000,0x0000,0x0001,0x6302,0x0001,0x6308,0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,
+        0x6302,0x0000,0x0008,0x6302,0x0001,0x6303,0x0001,0x0000,0x0001,0x6302,0x0001,0x0000,
+        0x6308,0x6308,0x6308,0x6308,0x0000,0x6308,0x6308,0x6308,0x0000,0x6308,0x0000,0x6308,
+        0x0000,0x0000,0x6308,0x6308,0x6308,0x6308,0x6308,0x6308,0x0000,0x6308,0x6308,0x6308,
+        0x0000,0x6308,0x0000,0x6308,0x0000,0x6308,0x0000,0x0000,0x6308,0x6308,0x6308,0x6308,
+        0x0000,0x0000,0x6308,0x0000,0x0000,0x0000,0x6308,0x0000,0x0008,0x6308,0x6308,0x6308,
+        0x6308,0x0000,0x0008,0x6308,0x0008,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,
+        0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,0x0001,
+        0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,0x0001,
+        0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0001,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,
+        0x0001,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,0x0001,
+        0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0001,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,
+        0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0001,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,
+        0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6106,0x0000,0xa005,0x0000,0x0000,0x6306,
+        0x0002,0x6306,0x9e06,0x0000,0x0000,0x6307,0x0000,0x0000,0x0000,0x6307,0x0000,0x6307,
+        0x6106,0x6306,0x9e06,0x6306,0x0000,0x6306,0x9e06,0x6306,0x0000,0x0000,0x0000,0x6106,
+        0x0000,0x0000,0x0000,0x6106,0x0000,0x0004,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6307,0x6106,0x0000,0x9e06,0x0000,0x0000,0x6306,0x9e06,0x6306,0x0001,
+        0xa002,0x6306,0x0001,0x6306,0x0000,0x0001,0xa002,0x6306,0x0000,0x6307,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x6307,0x6306,0x0001,0x9e06,0x6306,0x0000,0x6306,0x6306,0x0001,
+        0x0000,0x6306,0x0000,0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x6302,0x0000,0x9e04,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6307,0x6302,0x0000,0x6303,
+        0x0000,0x0000,0x0001,0x6302,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6307,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,0x6302,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x6302,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x6302,0x0000,0x0001,0x6302,0x0001,0x0001,0x0001,0x0000,0x0000,0x6302,0x0001,0x0000,
+        0x0004,0x6104,0x9e03,0x6104,0x0000,0x9e04,0x0004,0x0004,0x0000,0x6307,0x0000,0x6307,
+        0x0000,0x0000,0x6307,0x6307,0x6307,0x6307,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0001,0x0000,0x0004,0x0000,0x0004,0x0000,0x0000,0x0004,0x0004,0x0004,0x0004,
+        0x0000,0x0000,0x6307,0x0000,0x0000,0x0000,0x6307,0x0000,0x0007,0x0001,0x0000,0x0001,
+        0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,0x9e02,0x9e03,0x0000,0x9e02,0x6304,0x0001,
+        0x0000,0x9e04,0x0000,0x6307,0x6303,0x0001,0x6302,0x0000,0x0001,0x6307,0x0007,0x0000,
+        0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x6304,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x6106,0x0000,0x9e06,0x0000,0x0000,0x6306,0x9e06,0x6306,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6306,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6306,0x0000,0x0000,0x0000,
+        0x6306,0x0000,0x0001,0x6304,0x0000,0x0001,0x0000,0x0000,0x0000,0x6304,0x6306,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x9e06,0x6306,0x0001,
+        0x6306,0x0000,0x0001,0x9e06,0x0006,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0002,0x0001,0x0001,0x6304,0x0000,0x6304,0x0000,0x0000,0x6304,0x6304,0x6304,0x6304,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0001,
+        0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,
+        0x6304,0x0000,0x0004,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x6304,0x6304,0x0001,
+        0x6304,0x0000,0x0001,0x6304,0x0004,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0001,0x0001,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,
+        0x6106,0x6306,0xa005,0x6306,0x0000,0x6306,0xa006,0x6306,0x0000,0x6106,0x0000,0x0005,
+        0x0000,0x0000,0x6306,0x0006,0x6306,0x0005,0x6106,0x6306,0x0000,0x6306,0x6306,0x6306,
+        0x0000,0x6306,0x0000,0x6106,0x0000,0x0006,0x0000,0x0000,0x6306,0x0006,0x6306,0x0004,
+        0x0000,0x0000,0x0006,0x0000,0x0000,0x0000,0x0006,0x0000,0x0006,0x6106,0x6306,0x9e06,
+        0x6306,0x0000,0x0006,0x9e06,0x0006,0x0000,0x9e06,0x6306,0x0000,0x6306,0x6306,0x0001,
+        0x0000,0x6306,0x0000,0x9e06,0x6306,0x0001,0x6306,0x0000,0x0001,0x9e06,0x0006,0x0000,
+        0x0000,0x6306,0x0000,0x6306,0x0006,0x0000,0x0000,0x0000,0x0000,0x6302,0x0000,0x6303,
+        0x0000,0x0000,0x0001,0x6302,0x0001,0x9e04,0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,
+        0x6302,0x0000,0x0005,0x6302,0x0001,0x6303,0x0001,0x0000,0x0001,0x6302,0x0001,0x0000,
+        0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x6302,0x0000,0x0004,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x6302,0x0000,0x0003,0x0000,0x0000,0x0001,
+        0x0002,0x0001,0x0001,0x6302,0x0001,0x0001,0x0001,0x0000,0x0000,0x6302,0x0001,0x0000,
+        0x6302,0x0000,0x0001,0x0000,0x0000,0x0000,0x0002,0x0001,0x0001,0x6302,0x0001,0x0000,
+        0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x9e02,0x9e03,0x0000,0x9e02,0x6304,0x9e04,
+        0x0000,0x9e04,0x0000,0x0005,0x6303,0x0005,0x6302,0x0000,0x0005,0x0005,0x0005,0x0000,
+        0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0004,0x0004,0x0004,
+        0x0004,0x0000,0x0004,0x0004,0x0004,0x0000,0x0002,0x0000,0x0003,0x0000,0x0000,0x0001,
+        0x0002,0x0001,0x0001,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,
+        0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,
+        0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x5f06,0x6306,0x0006,0x6102,0x0000,0x0006,0x5f06,0x6306,0x0000,
+        0x6307,0x0000,0x6307,0x0000,0x0000,0x6307,0x6307,0x6306,0x6307,0x0006,0x6306,0x0000,
+        0x0006,0x6306,0x0006,0x0000,0x6306,0x0000,0x6106,0x0000,0x6107,0x0000,0x0000,0x6107,
+        0x6106,0x6306,0x9e06,0x0000,0x0000,0x6307,0x0000,0x0000,0x0000,0x6307,0x0000,0x6307,
+        0x6106,0x6306,0x0003,0x6106,0x0000,0x0006,0x9e06,0x6306,0x0000,0x5f04,0x6306,0x0000,
+        0x6102,0x6306,0x0008,0x0000,0x6306,0x0000,0x6307,0x6306,0x6307,0x6302,0x0000,0x6307,
+        0x6307,0x6306,0x0000,0x0000,0x6306,0x0000,0x0006,0x6306,0x0000,0x0000,0x0000,0x0000,
+        0x6302,0x0000,0x6104,0x0000,0x0000,0x6104,0x6302,0x0001,0x6104,0x0000,0x0000,0x6307,
+        0x0000,0x0000,0x0000,0x6302,0x0000,0x6307,0x6302,0x0001,0x0003,0x6302,0x0000,0x0005,
+        0x6302,0x0001,0x0000,0x0000,0x0000,0x6307,0x0000,0x0000,0x0000,0x6302,0x0000,0x6307,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6307,0x6302,0x0000,0x6307,
+        0x0000,0x0000,0x6307,0x6302,0x0001,0x0001,0x6302,0x0001,0x0008,0x6302,0x0000,0x0008,
+        0x6302,0x0001,0x0000,0x6302,0x0000,0x6307,0x0000,0x0000,0x6307,0x6302,0x0001,0x6307,
+        0x6302,0x0001,0x0000,0x6302,0x0001,0x0008,0x0000,0x0000,0x0000,0x0003,0x0003,0x0000,
+        0x6104,0x6304,0x0004,0x0000,0x0001,0x0000,0x6307,0x6303,0x6307,0x6302,0x0000,0x6307,
+        0x0001,0x0001,0x0000,0x0000,0x9e03,0x0000,0x0008,0x0008,0x0000,0x0000,0x0000,0x0000,
+        0x0003,0x6308,0x0003,0x6102,0x0000,0x0004,0x0001,0x0001,0x0000,0x6307,0x0000,0x6307,
+        0x0000,0x0000,0x6307,0x0001,0x0000,0x0001,0x9e02,0x6308,0x0000,0x0008,0x6308,0x0008,
+        0x0000,0x0001,0x0000,0x0000,0x9e03,0x0000,0x0007,0x6304,0x0000,0x0000,0x0000,0x0000,
+        0x6307,0x6303,0x0000,0x6302,0x0001,0x6307,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x9e07,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x6304,0x0000,0x0000,0x6304,
+        0x6304,0x6306,0x6304,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,
+        0x6106,0x6306,0xa003,0x6106,0x0000,0x0006,0x9e06,0x6306,0x0000,0x0000,0x0000,0x6306,
+        0x0000,0x0000,0x0000,0x6306,0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x6306,0x0000,0x6306,0x0000,0x0000,0x6306,0x6306,0x6306,0x0001,
+        0x6304,0x6306,0x6304,0x6304,0x0000,0x6304,0x6304,0x6306,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,0xa006,0x6306,0x0000,0x0006,0x6306,0x0008,
+        0x0000,0x6306,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x6302,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x6302,0x0000,0x6305,
+        0x0000,0x0000,0x6305,0x6302,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x6302,0x0000,0x6304,
+        0x0000,0x0000,0x6304,0x6302,0x0001,0x6304,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0001,0x6302,0x0001,0x9e03,0x6302,0x0000,0x0008,0x6302,0x0001,0x0000,
+        0x6304,0x6304,0x6304,0x6304,0x0000,0x6304,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x9e02,0x9e03,0x0000,0x0008,0x0008,0x0008,
+        0x0000,0x0001,0x0000,0x6304,0x0000,0x6304,0x0000,0x0000,0x6304,0x0001,0x0000,0x0001,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9e02,0x6308,0x9e03,
+        0x0008,0x0000,0x0008,0x0001,0x0001,0x0000,0x6304,0x6304,0x0000,0x6304,0x6304,0x6304,
+        0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0000,0x9e03,0x0000,0x0008,0x0008,0x0000,0x0000,0x0000,0x0000,0x0006,0x6306,0x0000,
+        0x6102,0x6306,0x0006,0x0000,0x6306,0x0000,0x6106,0x6306,0x0006,0x6302,0x0000,0x0006,
+        0x6106,0x6306,0x0000,0x0000,0x6306,0x0000,0x0006,0x6306,0x0000,0x0000,0x0000,0x0000,
+        0x6102,0x6306,0x0006,0x6102,0x0000,0x0006,0x0006,0x6306,0x0000,0x6106,0x0000,0x0006,
+        0x0000,0x0000,0x0006,0x6106,0x6306,0x0006,0x6102,0x6306,0x0000,0x6102,0x6306,0x0006,
+        0x0000,0x6306,0x0000,0x0000,0x6306,0x0000,0x0006,0x6306,0x0000,0x0000,0x0000,0x0000,
+        0x6106,0x6306,0x0000,0x6302,0x0001,0x9e06,0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,0x6302,0x0001,0x0003,0x6302,0x0000,0x0004,
+        0x6302,0x0001,0x0000,0x6302,0x0000,0x6308,0x0000,0x0000,0x6308,0x6302,0x0001,0x6308,
+        0x6302,0x0001,0x0000,0x6302,0x0001,0x0005,0x0000,0x0000,0x0000,0x6302,0x0000,0x0003,
+        0x0000,0x0000,0x0004,0x6302,0x0001,0x0004,0x0000,0x0000,0x6308,0x0000,0x0000,0x0000,
+        0x6302,0x0000,0x0008,0x6302,0x0001,0x0003,0x6302,0x0000,0x0008,0x6302,0x0001,0x0000,
+        0x6302,0x0001,0x0000,0x6302,0x0001,0x0008,0x0000,0x0000,0x0000,0x6302,0x0001,0x6308,
+        0x6302,0x0000,0x0008,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,0x6302,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x9e03,0x0000,0x0005,0x6304,0x0000,0x0000,0x0000,0x0000,
+        0x9e02,0x6303,0x0000,0x6302,0x0001,0x0005,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x9e05,0x0000,0x0000,0x0000,0x0000,0x0003,0x6308,0x0000,0x6102,0x6304,0x0004,
+        0x0000,0x0001,0x0000,0x0003,0x6303,0x0003,0x6302,0x0000,0x0008,0x0001,0x0001,0x0000,
+        0x0000,0x6308,0x0000,0x0008,0x0008,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x6106,0x0000,0x6104,0x0000,0x0000,0x6104,0x6106,0x6306,0x9e06,0x0000,0x0000,0x6306,
+        0x0000,0x0000,0x0000,0x6306,0x0000,0x6306,0x6102,0x6306,0x0003,0x6102,0x0000,0x0006,
+        0x9e06,0x6306,0x0000,0x0000,0x0000,0x6106,0x0000,0x0000,0x0000,0x6302,0x0000,0x9e06,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6306,0x6302,0x0000,0x0003,
+        0x0000,0x0000,0x0006,0x6302,0x0001,0x0001,0x6106,0x6306,0x6104,0x6106,0x0000,0x6104,
+        0x6106,0x6306,0x0000,0x6306,0x0000,0x6306,0x0000,0x0000,0x6306,0x6306,0x6306,0x6306,
+        0x0006,0x6306,0x0000,0x0006,0x6306,0x0006,0x0000,0x6306,0x0000,0x0000,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x6302,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x6302,0x0000,0x0003,0x0000,0x0000,0x0005,0x6302,0x0001,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6307,0x0000,0x0000,0x0000,
+        0x6302,0x0000,0x0001,0x6302,0x0000,0x6304,0x0000,0x0000,0x6304,0x6302,0x0001,0x6304,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x6302,0x0001,0x0003,
+        0x6302,0x0000,0x0007,0x6302,0x0001,0x0000,0x0003,0x6305,0x0003,0x6102,0x0000,0x0004,
+        0x0001,0x0001,0x0000,0x6307,0x0000,0x6307,0x0000,0x0000,0x6307,0x0001,0x0000,0x0001,
+        0x0003,0x6305,0x0000,0x0002,0x6305,0x0005,0x0000,0x0001,0x0000,0x6302,0x0000,0x0003,
+        0x0000,0x0000,0x0004,0x0001,0x0000,0x0001,0x0000,0x0000,0x6307,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x6302,0x0001,0x0003,0x6302,0x0000,0x0007,0x0001,0x0000,0x0000,
+        0x9e02,0x9e03,0x0000,0x0007,0x6304,0x0007,0x0000,0x0001,0x0000,0x6307,0x6303,0x6307,
+        0x6302,0x0000,0x0007,0x0001,0x0001,0x0000,0x0000,0x9e03,0x0000,0x0007,0x0007,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x6304,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x6106,0x0000,0x0003,
+        0x0000,0x0000,0x0006,0x9e06,0x6306,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6306,0x0000,0x0000,0x0000,0x6306,0x0000,0x0001,0x6304,0x0000,0x6304,
+        0x0000,0x0000,0x6304,0x6304,0x6306,0x6304,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0001,0x0006,0x6306,0x0003,0x0006,0x0000,0x0006,0x9e06,0x0006,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6305,0x0000,0x0000,0x0000,
+        0x6302,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,
+        0x6302,0x0000,0x0004,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,
+        0x6302,0x0000,0x0003,0x0000,0x0000,0x0001,0x0002,0x0001,0x0001,0x6304,0x0000,0x6304,
+        0x0000,0x0000,0x6304,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0003,0x6305,0x0003,0x0002,0x0000,0x0005,0x0001,0x0001,0x0000,
+        0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6302,0x0000,0x0003,0x0000,0x0000,0x0001,
+        0x0001,0x0000,0x0001,0x6304,0x6304,0x6304,0x6304,0x0000,0x0004,0x0001,0x0001,0x0000,
+        0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0003,0x0003,0x0000,
+        0x0002,0x0001,0x0001,0x0000,0x0001,0x0000,0x6106,0x6306,0x0006,0x6106,0x0000,0x0006,
+        0x6106,0x6306,0x0000,0x6306,0x0000,0x6306,0x0000,0x0000,0x6306,0x6306,0x6306,0x6306,
+        0x6102,0x6306,0x0000,0x6102,0x6306,0x0006,0x0000,0x6306,0x0000,0x6302,0x0000,0x0006,
+        0x0000,0x0000,0x0006,0x6302,0x0001,0x9e06,0x0000,0x0000,0x6306,0x0000,0x0000,0x0000,
+        0x6306,0x0000,0x0006,0x6302,0x0001,0x0003,0x6302,0x0000,0x0006,0x6302,0x0001,0x0000,
+        0x6106,0x6306,0x0000,0x6106,0x6306,0x0006,0x0000,0x6306,0x0000,0x6306,0x6306,0x6306,
+        0x6306,0x0000,0x0006,0x6306,0x0006,0x0000,0x0000,0x6306,0x0000,0x0006,0x0006,0x0000,
+        0x0000,0x0000,0x0000,0x6302,0x0000,0x6304,0x0000,0x0000,0x6304,0x6302,0x0001,0x6304,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x6302,0x0001,0x0003,
+        0x6302,0x0000,0x0005,0x6302,0x0001,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,
+        0x6302,0x0000,0x0004,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,
+        0x6302,0x0000,0x0003,0x0000,0x0000,0x0001,0x0002,0x0001,0x0001,0x6302,0x0001,0x6304,
+        0x6302,0x0000,0x0004,0x6302,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,
+        0x0001,0x0001,0x0000,0x6302,0x0001,0x0000,0x0002,0x0001,0x0001,0x0000,0x0000,0x0000,
+        0x9e02,0x6305,0x0000,0x0005,0x6304,0x0005,0x0000,0x0001,0x0000,0x9e02,0x6303,0x9e03,
+        0x6302,0x0000,0x0005,0x0001,0x0001,0x0000,0x0000,0x6305,0x0000,0x0005,0x0005,0x0000,
+        0x0000,0x0000,0x0000,0x6302,0x0001,0x0003,0x6302,0x0000,0x0004,0x0001,0x0000,0x0000,
+        0x6302,0x0000,0x0003,0x0000,0x0000,0x0001,0x0001,0x0000,0x0001,0x6302,0x0001,0x0000,
+        0x0002,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x5f04,0x6306,0x0000,
+        0x6102,0x6306,0x0005,0x0000,0x6306,0x0000,0x6307,0x6306,0x6307,0x6302,0x0000,0x6307,
+        0x6307,0x6306,0x0000,0x0000,0x6306,0x0000,0x0006,0x6306,0x0000,0x0000,0x0000,0x0000,
+        0x6106,0x6306,0x6107,0x6106,0x0000,0x6107,0x6106,0x6306,0x0000,0x6307,0x0000,0x6307,
+        0x0000,0x0000,0x6307,0x6307,0x6306,0x6307,0x6106,0x6306,0x0000,0x6106,0x6306,0x0006,
+        0x0000,0x6306,0x0000,0x0000,0x6306,0x0000,0x6102,0x6306,0x0000,0x0000,0x0000,0x0000,
+        0x6307,0x6306,0x0000,0x6302,0x0001,0x0001,0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,0x6302,0x0001,0x0005,0x6302,0x0000,0x0005,
+        0x6302,0x0001,0x0000,0x6302,0x0000,0x6307,0x0000,0x0000,0x6307,0x6302,0x0001,0x6307,
+        0x6302,0x0001,0x0000,0x6302,0x0001,0x0005,0x0000,0x0000,0x0000,0x6302,0x0000,0x6307,
+        0x0000,0x0000,0x6307,0x6302,0x0001,0x6307,0x0000,0x0000,0x6307,0x0000,0x0000,0x0000,
+        0x6302,0x0000,0x0007,0x6302,0x0001,0x6307,0x6302,0x0000,0x0007,0x6302,0x0001,0x0000,
+        0x6302,0x0001,0x0000,0x6302,0x0001,0x0001,0x0000,0x0000,0x0000,0x6302,0x0001,0x0001,
+        0x6302,0x0000,0x0001,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,0x6302,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x9e03,0x0000,0x6104,0x6304,0x0000,0x0000,0x0000,0x0000,
+        0x6307,0x6303,0x0000,0x6302,0x0001,0x6307,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x9e02,0x9e03,0x0000,0x6104,0x6304,0x0004,
+        0x0000,0x0001,0x0000,0x6307,0x6303,0x6307,0x6302,0x0000,0x0007,0x0001,0x0001,0x0000,
+        0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x6302,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x6304,0x6306,0x6304,0x6304,0x0000,0x6304,0x6304,0x6306,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,0x6106,0x6306,0x0000,0x6106,0x6306,0x9e06,
+        0x0000,0x6306,0x0000,0x6306,0x0000,0x6306,0x0000,0x0000,0x6306,0x6306,0x6306,0x6306,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x6306,0x6306,0x6306,
+        0x6306,0x0000,0x0006,0x6306,0x0006,0x0000,0x6304,0x6306,0x0000,0x6304,0x6306,0x0001,
+        0x0000,0x6306,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,
+        0x0000,0x6306,0x0000,0x9e06,0x0006,0x0000,0x0000,0x0000,0x0000,0x6302,0x0000,0x6304,
+        0x0000,0x0000,0x6304,0x6302,0x0001,0x6304,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0001,0x6302,0x0001,0x6305,0x6302,0x0000,0x0005,0x6302,0x0001,0x0000,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,
+        0x0001,0x0001,0x0000,0x6302,0x0001,0x0001,0x6302,0x0000,0x0001,0x6302,0x0001,0x0000,
+        0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,0x6302,0x0001,0x0000,
+        0x0002,0x0001,0x0001,0x0000,0x0000,0x0000,0x6304,0x6304,0x0000,0x6304,0x6304,0x6304,
+        0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x6304,0x6304,0x6304,
+        0x6304,0x0000,0x0004,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,
+        0x0000,0x6304,0x0000,0x6304,0x0004,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,
+        0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x6306,0x0000,0x6102,0x6306,0x0000,0x0000,0x0000,0x0000,
+        0x6102,0x6306,0x0000,0x6302,0x0001,0x0005,0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,0x0006,0x6306,0x0000,0x6102,0x6306,0x0006,
+        0x0000,0x6306,0x0000,0x6102,0x6306,0x0006,0x6302,0x0000,0x0006,0x0006,0x0006,0x0000,
+        0x0000,0x6306,0x0000,0x0006,0x0006,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,0x0000,0x6306,0x0000,0x6302,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x6302,0x0001,0x0000,0x6302,0x0001,0x0005,0x0000,0x0000,0x0000,0x6302,0x0001,0x0005,
+        0x6302,0x0000,0x0005,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,0x6302,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x6302,0x0001,0x0003,0x6302,0x0000,0x0004,0x6302,0x0001,0x0000,
+        0x6302,0x0000,0x0003,0x0000,0x0000,0x0001,0x0002,0x0001,0x0001,0x6302,0x0001,0x0000,
+        0x0002,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6302,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x6302,0x0001,0x0000,0x0002,0x0001,0x0001,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x6302,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x9e03,0x0000,0x0004,0x0004,0x0000,0x0000,0x0000,0x0000,0x0003,0x0003,0x0000,
+        0x0002,0x0001,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0006,0x5f04,0x0000,0x5f04,0x6304,0x0006,
+        0x0000,0x0006,0x0000,0x5f02,0x6303,0xa006,0x6302,0x0000,0x6106,0x0006,0x6108,0x0000,
+        0x0000,0xa007,0x0000,0xa007,0xa007,0x0000,0x0000,0x0000,0x0000,0x5f08,0x6308,0x0006,
+        0x6106,0x0000,0x6106,0x0006,0x6308,0x0000,0x6106,0x0000,0x6106,0x0000,0x0000,0x6106,
+        0x6106,0x6308,0x6106,0xa007,0x6308,0x0000,0xa007,0x6308,0x9e06,0x0000,0x6308,0x0000,
+        0x0000,0x0006,0x0000,0x0006,0x6304,0x0000,0x0000,0x0000,0x0000,0x0002,0x6303,0x0000,
+        0x6302,0x0001,0x9e06,0x0000,0x0006,0x0000,0x0000,0x0000,0x0000,0x0000,0xa007,0x0000,
+        0x0000,0x0000,0x0000,0x0002,0x6103,0x0003,0x6309,0x0000,0x6309,0x0002,0x6105,0x0000,
+        0x6308,0x0000,0x6308,0x0000,0x0000,0x6308,0x6308,0x6308,0x6308,0x0007,0x0007,0x0000,
+        0x6309,0x6309,0x6309,0x0000,0x0007,0x0000,0x6307,0x0000,0x6307,0x0000,0x0000,0x6307,
+        0x6307,0x6307,0x6307,0x0000,0x0000,0x6307,0x0000,0x0000,0x0000,0x6307,0x0000,0x6307,
+        0x6307,0x6307,0x6307,0x6307,0x0000,0x6307,0x6307,0x6307,0x0000,0x0002,0x6103,0x0000,
+        0x6309,0x6304,0x6309,0x0000,0x0004,0x0000,0x6308,0x6303,0x6308,0x6302,0x0000,0x6308,
+        0x6308,0x6308,0x0000,0x0000,0x0007,0x0000,0x6309,0x6309,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0004,0x0000,0xa002,0x6304,0x0000,0x0000,0x0000,0x0000,0x0002,0x6303,0x0000,
+        0x6302,0x0001,0x0001,0x0000,0x0009,0x0000,0x0000,0x0000,0x0000,0x0000,0x9e05,0x0000,
+        0x0000,0x0000,0x0000,0xa002,0x6308,0x0000,0x6102,0x6304,0x0001,0x0000,0x6308,0x0000,
+        0x6102,0x6303,0x0001,0x6302,0x0000,0x0001,0x9e02,0x6308,0x0000,0x0000,0x6308,0x0000,
+        0x9e02,0x6308,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0006,0x6105,0x0006,
+        0x6106,0x0000,0x6106,0x0006,0x6105,0x0000,0x6106,0x0000,0x6106,0x0000,0x0000,0x6106,
+        0x6106,0x6106,0x6106,0x0006,0x6105,0x0000,0x6106,0x6106,0x6106,0x0000,0x6105,0x0000,
+        0x6306,0x0000,0x6306,0x0000,0x0000,0x6306,0x6306,0x6306,0x6306,0x0000,0x0000,0x6306,
+        0x0000,0x0000,0x0000,0x6306,0x0000,0x6306,0x6306,0x6306,0x6306,0x6306,0x0000,0x6306,
+        0x6306,0x6306,0x0000,0x0002,0x0006,0x0000,0x0006,0x6304,0x9e06,0x0000,0x0006,0x0000,
+        0x0002,0x6303,0x9e06,0x6302,0x0000,0x9e06,0xa006,0x0006,0x0000,0x0000,0x0006,0x0000,
+        0x0006,0x0006,0x0000,0x0000,0x0000,0x0000,0x6305,0x0000,0x6305,0x0000,0x0000,0x6305,
+        0x6305,0x6305,0x6305,0x0000,0x0000,0x6305,0x0000,0x0000,0x0000,0x6305,0x0000,0x6305,
+        0x6305,0x6305,0x6305,0x6305,0x0000,0x6305,0x6305,0x6305,0x0000,0x0000,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,
+        0x0002,0x6103,0x0008,0x6309,0x0000,0x6309,0x0002,0x0004,0x0000,0x6308,0x0000,0x6308,
+        0x0000,0x0000,0x6308,0x6308,0x6308,0x6308,0x0002,0x0003,0x0000,0x6309,0x6309,0x6309,
+        0x0000,0x0008,0x0000,0xa002,0x0003,0x0000,0x0002,0x6304,0x0001,0x0000,0x0009,0x0000,
+        0x0002,0x6303,0x0001,0x6302,0x0000,0x0001,0x9e02,0x0009,0x0000,0x0000,0x0008,0x0000,
+        0x9e02,0x0008,0x0000,0x0000,0x0000,0x0000,0xa002,0x6308,0x0001,0x6102,0x0000,0x0001,
+        0x9e02,0x6308,0x0000,0x6102,0x0000,0x0001,0x0000,0x0000,0x0000,0x9e02,0x6308,0x0001,
+        0x9e02,0x6308,0x0000,0x9e02,0x6308,0x0001,0x0000,0x6308,0x0000,0x0000,0x0003,0x0000,
+        0x0002,0x6304,0x0000,0x0000,0x0000,0x0000,0x0002,0x6303,0x0000,0x6302,0x0001,0x0001,
+        0x0000,0x0009,0x0000,0x0000,0x0000,0x0000,0x0000,0x0008,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x5f04,0x0000,0x5f04,0x6304,0x0000,0x0000,0x0000,0x0000,0x5f02,0x6303,0x0000,
+        0x6302,0x0001,0x6106,0x0000,0x6108,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0004,0x6308,0x0000,0x5f04,0x6304,0x9e06,0x0000,0x6308,0x0000,
+        0x6102,0x6303,0x0006,0x6302,0x0000,0x6106,0x6108,0x6308,0x0000,0x0000,0x0001,0x0000,
+        0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0004,0x6104,0x0000,
+        0x6309,0x6304,0x6309,0x0000,0x0004,0x0000,0x6308,0x6303,0x6308,0x6302,0x0000,0x6308,
+        0x6308,0x6308,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0004,0x6308,0x0004,0x6309,0x0000,0x6309,0x0004,0x6308,0x0000,0x6308,0x0000,0x6308,
+        0x0000,0x0000,0x6308,0x6308,0x6308,0x6308,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0001,0x0000,0x0000,0x6104,0x0000,0x6309,0x6304,0x0000,0x0000,0x0000,0x0000,
+        0x6308,0x6303,0x0000,0x6302,0x0001,0x6308,0x0000,0x6308,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x0000,
+        0x9e02,0x6304,0x0000,0x0000,0x0000,0x0000,0x6102,0x6303,0x0000,0x6302,0x0001,0x0001,
+        0x0000,0x6308,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x5f02,0x6305,0xa006,0x6106,0x0000,0x6106,0x0002,0x6305,0x0000,
+        0x6306,0x0000,0x6306,0x0000,0x0000,0x6306,0x6306,0x6306,0x6306,0xa007,0x6305,0x0000,
+        0x0007,0x6305,0x9e06,0x0000,0x6305,0x0000,0x6302,0x0000,0x6106,0x0000,0x0000,0x6106,
+        0x6302,0x0001,0x9e06,0x0000,0x0000,0x6306,0x0000,0x0000,0x0000,0x6306,0x0000,0x6306,
+        0x6302,0x0001,0x9e06,0x6302,0x0000,0x9e06,0x6302,0x0001,0x0000,0x0006,0x6104,0x0000,
+        0x6106,0x6304,0x6106,0x0000,0x0006,0x0000,0x6306,0x6306,0x6306,0x6306,0x0000,0x6306,
+        0x6306,0x6306,0x0000,0x0000,0x0007,0x0000,0x0007,0x0007,0x0000,0x0000,0x0000,0x0000,
+        0x6304,0x0000,0x6304,0x0000,0x0000,0x6304,0x6304,0x6304,0x6304,0x0000,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0007,0x6305,0x9e03,0x6309,0x0000,0x6309,
+        0x9e02,0x6305,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x6302,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x6302,0x0000,0x6307,
+        0x0000,0x0000,0x6307,0x6302,0x0001,0x0001,0x6304,0x6304,0x6304,0x6304,0x0000,0x6304,
+        0x6304,0x6304,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,
+        0x0007,0x0007,0x0000,0x6309,0x6309,0x6309,0x0000,0x0007,0x0000,0x0002,0x6305,0x0000,
+        0x6102,0x6304,0x0001,0x0000,0x6305,0x0000,0x6102,0x6303,0x0001,0x6302,0x0000,0x0001,
+        0x9e02,0x6305,0x0000,0x0000,0x6305,0x0000,0x9e02,0x6305,0x0000,0x0000,0x0000,0x0000,
+        0x6302,0x0001,0x0001,0x6302,0x0000,0x0001,0x6302,0x0001,0x0000,0x6302,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x6302,0x0001,0x0001,0x6302,0x0001,0x0000,0x6302,0x0001,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x0007,0x0000,0x9e02,0x6304,0x0000,0x0000,0x0000,0x0000,
+        0x9e02,0x6303,0x0000,0x6302,0x0001,0x0001,0x0000,0x9e07,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0007,0x0000,0x0000,0x0000,0x0000,0x6106,0x0000,0x6106,0x0000,0x0000,0x6106,
+        0x6106,0x6305,0x9e06,0x0000,0x0000,0x6306,0x0000,0x0000,0x0000,0x6306,0x0000,0x6306,
+        0x6105,0x6305,0x9e06,0x6106,0x0000,0x6106,0x0002,0x6305,0x0000,0x0000,0x0000,0x6306,
+        0x0000,0x0000,0x0000,0x6306,0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6306,0x6306,0x0000,0x6306,0x0000,0x0000,0x6306,0x6306,0x0001,0x0001,
+        0x0006,0x6104,0x0006,0x6106,0x0000,0x6106,0x0006,0x0006,0x0000,0x6306,0x0000,0x6306,
+        0x0000,0x0000,0x6306,0x6306,0x6306,0x6306,0x0006,0x0006,0x0000,0x0006,0x0006,0x0006,
+        0x0000,0x0006,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x6304,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x6305,0x0000,0x6305,
+        0x0000,0x0000,0x6305,0x6305,0x6305,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x6304,0x0000,0x6304,
+        0x0000,0x0000,0x6304,0x6304,0x6304,0x6304,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0001,0x0002,0x0003,0x0003,0x6309,0x0000,0x0009,0x0002,0x0009,0x0000,
+        0x0002,0x6305,0x0001,0x6102,0x0000,0x0001,0x9e02,0x6305,0x0000,0x6102,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x9e02,0x6305,0x0001,0x0002,0x6305,0x0000,0x0002,0x6305,0x0001,
+        0x0000,0x6305,0x0000,0x6302,0x0000,0x0001,0x0000,0x0000,0x0000,0x6302,0x0001,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,0x6302,0x0001,0x0001,
+        0x6302,0x0000,0x0001,0x6302,0x0001,0x0000,0x0002,0x0003,0x0000,0x0002,0x6304,0x0001,
+        0x0000,0x0009,0x0000,0x0002,0x6303,0x0001,0x6302,0x0000,0x0001,0x9e02,0x0009,0x0000,
+        0x0000,0x0003,0x0000,0x0002,0x0009,0x0000,0x0000,0x0000,0x0000,0xa004,0x6305,0x0000,
+        0x6104,0x6304,0x9e06,0x0000,0x6305,0x0000,0x6306,0x6306,0x6306,0x6306,0x0000,0x6306,
+        0x6306,0x6306,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x6302,0x0001,0x9e06,0x6302,0x0000,0x9e06,0x6302,0x0001,0x0000,0x6306,0x0000,0x6306,
+        0x0000,0x0000,0x6306,0x6306,0x0001,0x6306,0x0001,0x0000,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x9e06,0x0000,0x9e06,0x6304,0x0000,0x0000,0x0000,0x0000,
+        0x6306,0x6306,0x0000,0x6306,0x0001,0x6306,0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x6304,0x6304,0x6304,0x6304,0x0000,0x6304,
+        0x6304,0x6304,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,
+        0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x6302,0x0000,0x6304,
+        0x0000,0x0000,0x6304,0x6302,0x0001,0x6304,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0001,0x0000,0x0000,
+        0x6304,0x6304,0x0000,0x6304,0x6304,0x6304,0x0000,0x6304,0x0000,0x0001,0x0001,0x0000,
+        0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x6305,0x0000,0x9e02,0x6304,0x0000,0x0000,0x0000,0x0000,
+        0x9e02,0x6303,0x0000,0x6302,0x0001,0x0001,0x0000,0x6305,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x6302,0x0001,0x0000,0x6302,0x0001,0x0001,
+        0x0000,0x0000,0x0000,0x6302,0x0001,0x0001,0x6302,0x0000,0x0001,0x6302,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0xa009,0x0000,0xa009,0x6304,0x0000,0x0000,0x0000,0x0000,0xa009,0x6303,0x0000,
+        0x6302,0x0001,0x9e06,0x0000,0x0009,0x0000,0x0000,0x0000,0x0000,0x0000,0x9e06,0x0000,
+        0x0000,0x0000,0x0000,0xa009,0xa009,0x0000,0xa009,0x6304,0x9e06,0x0000,0xa009,0x0000,
+        0x0009,0x6303,0x9e06,0x6302,0x0000,0x9e06,0x0009,0x0009,0x0000,0x0000,0x9e06,0x0000,
+        0x9e06,0x9e06,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0009,0x0009,0x0000,
+        0x6309,0x6304,0x6309,0x0000,0x0009,0x0000,0x0009,0x6303,0x9e03,0x6302,0x0000,0x6309,
+        0x0009,0x0009,0x0000,0x0000,0x9e03,0x0000,0x6309,0x6309,0x0000,0x0000,0x0000,0x0000,
+        0x6307,0x6307,0x6307,0x6307,0x0000,0x6307,0x6307,0x6307,0x0000,0x6307,0x0000,0x6307,
+        0x0000,0x0000,0x6307,0x6307,0x6307,0x6307,0x6307,0x6307,0x0000,0x6307,0x6307,0x6307,
+        0x0000,0x6307,0x0000,0x0000,0x0009,0x0000,0x6309,0x6304,0x0000,0x0000,0x0000,0x0000,
+        0x9e02,0x6303,0x0000,0x6302,0x0001,0x0001,0x0000,0x0009,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6309,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9e03,0x0000,
+        0x9e02,0x6304,0x0000,0x0000,0x0000,0x0000,0x9e02,0x6303,0x0000,0x6302,0x0001,0x0001,
+        0x0000,0x0009,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0xa009,0x0009,0x0000,0xa009,0x6304,0x9e06,0x0000,0x0009,0x0000,
+        0xa009,0x6303,0x9e06,0x6302,0x0000,0x9e06,0xa009,0x0009,0x0000,0x0000,0x9e06,0x0000,
+        0x9e06,0x9e06,0x0000,0x0000,0x0000,0x0000,0x6306,0x6306,0x6306,0x6306,0x0000,0x6306,
+        0x6306,0x6306,0x0000,0x6306,0x0000,0x6306,0x0000,0x0000,0x6306,0x6306,0x6306,0x6306,
+        0x6306,0x6306,0x0000,0x6306,0x6306,0x6306,0x0000,0x6306,0x0000,0x0000,0x0009,0x0000,
+        0x9e06,0x6304,0x0000,0x0000,0x0000,0x0000,0x9e06,0x6303,0x0000,0x6302,0x0001,0x0001,
+        0x0000,0x0009,0x0000,0x0000,0x0000,0x0000,0x0000,0x9e06,0x0000,0x0000,0x0000,0x0000,
+        0x6305,0x6305,0x6305,0x6305,0x0000,0x6305,0x6305,0x6305,0x0000,0x6305,0x0000,0x6305,
+        0x0000,0x0000,0x6305,0x6305,0x6305,0x6305,0x6305,0x6305,0x0000,0x6305,0x6305,0x6305,
+        0x0000,0x6305,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0001,0x0000,
+        0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x9e02,0x0009,0x0000,0x6309,0x6304,0x0001,
+        0x0000,0x0009,0x0000,0x9e02,0x6303,0x0001,0x6302,0x0000,0x0001,0x9e02,0x0009,0x0000,
+        0x0000,0x0009,0x0000,0x6309,0x0009,0x0000,0x0000,0x0000,0x0000,0x0000,0x9e03,0x0000,
+        0x9e02,0x6304,0x0000,0x0000,0x0000,0x0000,0x9e02,0x6303,0x0000,0x6302,0x0001,0x0001,
+        0x0000,0x0009,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x9e02,0x9e03,0x0000,0x9e02,0x6304,0x0001,0x0000,0x9e04,0x0000,0x9e02,0x6303,0x0001,
+        0x6302,0x0000,0x0001,0x9e02,0x0009,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6303,0x0000,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9e06,0x0000,
+        0x9e06,0x6304,0x0000,0x0000,0x0000,0x0000,0x0009,0x6303,0x0000,0x6302,0x0001,0x9e06,
+        0x0000,0x0009,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x9e03,0x0000,0x6309,0x6304,0x0000,0x0000,0x0000,0x0000,
+        0x0009,0x6303,0x0000,0x6302,0x0001,0x6309,0x0000,0x0009,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x9e02,0x9e03,0x0000,0x6309,0x6304,0x6309,
+        0x0000,0x9e04,0x0000,0x0009,0x6303,0x0009,0x6302,0x0000,0x0009,0x0009,0x0009,0x0000,
+        0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x6302,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6303,0x0000,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0006,0x6103,0x0006,
+        0x6306,0x0000,0x6306,0x0002,0x0006,0x0000,0x6106,0x0000,0x6106,0x0000,0x0000,0x6306,
+        0x0006,0x6108,0x0006,0xa007,0x0007,0x0000,0x6306,0x6306,0x6306,0x0000,0x0007,0x0000,
+        0x6106,0x0000,0x6106,0x0000,0x0000,0x6306,0x0006,0x6308,0x9e06,0x0000,0x0000,0x6106,
+        0x0000,0x0000,0x0000,0x6106,0x0000,0x6106,0xa007,0x6308,0x9e06,0x6306,0x0000,0x6306,
+        0x9e06,0x6308,0x0000,0x0006,0x6103,0x0000,0x6306,0x6306,0x6306,0x0000,0x0006,0x0000,
+        0x6106,0x6303,0x9e06,0x6306,0x0000,0x6306,0x0006,0x0006,0x0000,0x0000,0x0007,0x0000,
+        0x6306,0x6306,0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x6303,0x0000,0x0000,0x0001,
+        0x0002,0x6105,0x0004,0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x6308,0x0000,0x6308,
+        0x6303,0x6303,0x6303,0x0001,0x0000,0x0001,0x9e02,0x0007,0x0000,0x0000,0x0000,0x6303,
+        0x0000,0x0000,0x0000,0x6307,0x0000,0x6307,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6307,0x6303,0x0000,0x6303,0x0000,0x0000,0x0001,0x6307,0x6307,0x0001,
+        0x6303,0x6303,0x6303,0x0001,0x0000,0x0001,0x0002,0x0004,0x0000,0x6303,0x0000,0x6303,
+        0x0000,0x0000,0x0001,0x6308,0x6308,0x6308,0x6303,0x6303,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x0007,0x0000,0xa002,0x0004,0x0000,0xa002,0x6304,0x0001,0x0000,0x0004,0x0000,
+        0x0002,0x6303,0x0001,0x6302,0x0000,0x0001,0x0002,0x0005,0x0000,0x0000,0x9e03,0x0000,
+        0x9e02,0x9e05,0x0000,0x0000,0x0000,0x0000,0x0002,0x6308,0x0001,0x6102,0x0000,0x0001,
+        0x0002,0x6308,0x0000,0x6102,0x0000,0x0001,0x0000,0x0000,0x0000,0x0002,0x6308,0x0001,
+        0x9e02,0x6308,0x0000,0x9e02,0x6308,0x0001,0x0000,0x6308,0x0000,0x0000,0x0007,0x0000,
+        0x9e02,0x6304,0x0000,0x0000,0x0000,0x0000,0x9e02,0x6303,0x0000,0x6302,0x0001,0x0001,
+        0x0000,0x0007,0x0000,0x0000,0x0000,0x0000,0x0000,0x9e07,0x0000,0x0000,0x0000,0x0000,
+        0x6106,0x0000,0x6106,0x0000,0x0000,0x6306,0x0006,0x6105,0x9e06,0x0000,0x0000,0x6106,
+        0x0000,0x0000,0x0000,0x6106,0x0000,0x6106,0x6106,0x6106,0x9e06,0x6306,0x0000,0x6306,
+        0x0002,0x6105,0x0000,0x0000,0x0000,0x6306,0x0000,0x0000,0x0000,0x6306,0x0000,0x6306,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6306,0x6306,0x0000,0x6306,
+        0x0000,0x0000,0x6306,0x6306,0x6306,0x0001,0x0006,0x6103,0x9e06,0x6306,0x0000,0x6306,
+        0x0002,0x0006,0x0000,0x6106,0x0000,0x9e06,0x0000,0x0000,0x6306,0x0006,0x0006,0x9e06,
+        0x0006,0x0006,0x0000,0x6306,0x6306,0x6306,0x0000,0x0006,0x0000,0x0000,0x0000,0x6303,
+        0x0000,0x0000,0x0000,0x6305,0x0000,0x6305,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6305,0x6303,0x0000,0x6303,0x0000,0x0000,0x0001,0x6305,0x6305,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0000,0x6303,0x0000,0x6303,0x0000,0x0000,0x0001,0x0002,0x0004,0x9e04,
+        0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x6308,0x0000,0x0008,0x6303,0x6303,0x6303,
+        0x0001,0x0000,0x0001,0x0002,0x0008,0x0000,0x0002,0x0003,0x0001,0x0002,0x0000,0x0001,
+        0x0002,0x0004,0x0000,0x0002,0x0000,0x0001,0x0000,0x0000,0x0000,0x0002,0x0005,0x0001,
+        0x9e02,0x0008,0x0000,0x9e02,0x0008,0x0001,0x0000,0x0008,0x0000,0x0002,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x0002,0x6308,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0002,0x0000,0x0001,0x9e02,0x6308,0x0001,0x9e02,0x0000,0x0001,0x9e02,0x0008,0x0000,
+        0x0002,0x0003,0x0000,0x0002,0x6304,0x0001,0x0000,0x0004,0x0000,0x0002,0x6303,0x0001,
+        0x6302,0x0000,0x0001,0x0002,0x0008,0x0000,0x0000,0x0008,0x0000,0x9e02,0x0008,0x0000,
+        0x0000,0x0000,0x0000,0xa004,0x5f04,0x0000,0x6306,0x6306,0x6306,0x0000,0x0004,0x0000,
+        0x6106,0x6303,0x6106,0x6306,0x0000,0x6306,0x0006,0x6108,0x0000,0x0000,0x0001,0x0000,
+        0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x5f04,0x6308,0x9e06,0x6306,0x0000,0x6306,
+        0x0004,0x6308,0x0000,0x6106,0x0000,0x6106,0x0000,0x0000,0x6306,0x6108,0x6308,0x0006,
+        0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x9e06,0x0000,
+        0x6306,0x6306,0x0000,0x0000,0x0000,0x0000,0x6106,0x6303,0x0000,0x6306,0x0001,0x6306,
+        0x0000,0x0006,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x6303,0x6303,0x6303,0x0001,0x0000,0x0001,0x0004,0x0004,0x0000,0x6303,0x0000,0x6303,
+        0x0000,0x0000,0x0001,0x6308,0x6308,0x6308,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x6303,0x0000,0x6303,0x0000,0x0000,0x0001,0x0004,0x6308,0x0004,
+        0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x6308,0x0000,0x0008,0x0001,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,0x6303,0x6303,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x0004,0x0000,0x6303,0x6303,0x6303,0x0001,0x0000,0x0001,0x6308,0x0008,0x0000,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9e03,0x0000,
+        0x9e02,0x6304,0x0000,0x0000,0x0000,0x0000,0x9e02,0x6303,0x0000,0x6302,0x0001,0x0001,
+        0x0000,0x0005,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x9e02,0x6308,0x0000,0x9e02,0x6304,0x0001,0x0000,0x6308,0x0000,0x6102,0x6303,0x0001,
+        0x6302,0x0000,0x0001,0x0002,0x0008,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6106,0x0000,0x6106,0x0000,0x0000,0x6306,
+        0x0002,0x6305,0x9e06,0x0000,0x0000,0x6306,0x0000,0x0000,0x0000,0x6306,0x0000,0x6306,
+        0xa007,0x6305,0x9e06,0x6306,0x0000,0x6306,0x9e06,0x6305,0x0000,0x0000,0x0000,0x6106,
+        0x0000,0x0000,0x0000,0x6302,0x0000,0x9e06,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6306,0x6302,0x0000,0x9e06,0x0000,0x0000,0x6306,0x6302,0x0001,0x0001,
+        0x6106,0x6106,0x6106,0x6306,0x0000,0x6306,0xa006,0x0006,0x0000,0x6306,0x0000,0x6306,
+        0x0000,0x0000,0x6306,0x6306,0x6306,0x6306,0xa007,0x0007,0x0000,0x6306,0x6306,0x6306,
+        0x0000,0x0007,0x0000,0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x6304,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x6303,0x0000,0x6303,
+        0x0000,0x0000,0x0001,0x9e02,0x6305,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,0x6303,0x0000,0x6303,
+        0x0000,0x0000,0x0001,0x6304,0x6304,0x6304,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0001,0x6303,0x6303,0x6303,0x0001,0x0000,0x0001,0x9e02,0x0007,0x0000,
+        0x0002,0x6305,0x0001,0x6102,0x0000,0x0001,0x0002,0x6305,0x0000,0x6102,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x0002,0x6305,0x0001,0x9e02,0x6305,0x0000,0x9e02,0x6305,0x0001,
+        0x0000,0x6305,0x0000,0x6302,0x0000,0x0001,0x0000,0x0000,0x0000,0x6302,0x0001,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,0x6302,0x0001,0x0001,
+        0x6302,0x0000,0x0001,0x6302,0x0001,0x0000,0x9e02,0x0007,0x0000,0x9e02,0x6304,0x0001,
+        0x0000,0x0007,0x0000,0x9e02,0x6303,0x0001,0x6302,0x0000,0x0001,0x9e02,0x0007,0x0000,
+        0x0000,0x0007,0x0000,0x9e02,0x0007,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6106,
+        0x0000,0x0000,0x0000,0x6106,0x0000,0x9e06,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6306,0x6106,0x0000,0x9e06,0x0000,0x0000,0x6306,0x0002,0x6305,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6306,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6306,0x0000,0x0000,0x0000,
+        0x6306,0x0000,0x0001,0x6106,0x0000,0x6106,0x0000,0x0000,0x6306,0x0006,0x0006,0x9e06,
+        0x0000,0x0000,0x6306,0x0000,0x0000,0x0000,0x6306,0x0000,0x0006,0x0006,0x0006,0x9e06,
+        0x6306,0x0000,0x0006,0x0002,0x0006,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x6305,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x6304,0x0000,0x0004,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x6303,0x0000,0x0003,0x0000,0x0000,0x0001,
+        0x0002,0x0001,0x0001,0x0002,0x0000,0x0001,0x0000,0x0000,0x0000,0x0002,0x6305,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0002,0x0000,0x0001,0x0002,0x6305,0x0001,
+        0x0002,0x0000,0x0001,0x0002,0x0005,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x6302,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x6302,0x0000,0x0001,0x0000,0x0000,0x0000,0x0002,0x0001,0x0001,0x0002,0x0003,0x0001,
+        0x0002,0x0000,0x0001,0x0002,0x0004,0x0000,0x0002,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0002,0x0001,0x0001,0x0002,0x0003,0x0000,0x0002,0x0001,0x0001,0x0000,0x0001,0x0000,
+        0xa004,0x6305,0x9e06,0x6306,0x0000,0x6306,0xa004,0x6305,0x0000,0x6306,0x0000,0x6306,
+        0x0000,0x0000,0x6306,0x6306,0x6306,0x6306,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0001,0x0000,0x6302,0x0000,0x9e06,0x0000,0x0000,0x6306,0x6302,0x0001,0x9e06,
+        0x0000,0x0000,0x6306,0x0000,0x0000,0x0000,0x6306,0x0000,0x0006,0x0001,0x0000,0x0001,
+        0x0000,0x0000,0x0001,0x0001,0x0000,0x0000,0x9e06,0x9e06,0x0000,0x6306,0x6306,0x6306,
+        0x0000,0x9e06,0x0000,0x6306,0x6306,0x6306,0x6306,0x0000,0x0006,0x6306,0x0006,0x0000,
+        0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x6303,
+        0x0000,0x0000,0x0001,0x6304,0x6304,0x6304,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x6302,0x0000,0x0004,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0001,0x6303,0x6303,0x6303,0x0001,0x0000,0x0001,0x6304,0x0004,0x0000,
+        0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x9e02,0x6305,0x0000,0x9e02,0x6304,0x0001,
+        0x0000,0x6305,0x0000,0x9e02,0x6303,0x0001,0x6302,0x0000,0x0001,0x9e02,0x0005,0x0000,
+        0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x6302,0x0001,0x0001,
+        0x6302,0x0000,0x0001,0x6302,0x0001,0x0000,0x6302,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0002,0x0001,0x0001,0x0001,0x0000,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,
+        0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0006,0x6103,0x0000,0x6306,0x6306,0x6306,0x0000,0x0006,0x0000,
+        0x6103,0x6303,0x9e06,0x6306,0x0000,0x6306,0x0006,0x0006,0x0000,0x0000,0x9e06,0x0000,
+        0x6306,0x6306,0x0000,0x0000,0x0000,0x0000,0x6106,0x6106,0x6106,0x6306,0x0000,0x6306,
+        0x0006,0x0006,0x0000,0x6106,0x0000,0x6106,0x0000,0x0000,0x6306,0x0006,0x0006,0x0006,
+        0x9e06,0x9e06,0x0000,0x6306,0x6306,0x6306,0x0000,0x9e06,0x0000,0x0000,0x6103,0x0000,
+        0x6306,0x6306,0x0000,0x0000,0x0000,0x0000,0x0002,0x6303,0x0000,0x6306,0x0001,0x0001,
+        0x0000,0x0006,0x0000,0x0000,0x0000,0x0000,0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,
+        0x6303,0x6303,0x6303,0x0001,0x0000,0x0001,0x0002,0x0004,0x0000,0x6303,0x0000,0x6303,
+        0x0000,0x0000,0x0001,0x0002,0x0005,0x0005,0x6303,0x6303,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x0007,0x0000,0x6303,0x0000,0x6303,0x0000,0x0000,0x0001,0x6307,0x6307,0x6307,
+        0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x6307,0x0000,0x0007,0x6303,0x6303,0x6303,
+        0x0001,0x0000,0x0001,0x6307,0x0007,0x0000,0x6303,0x6303,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x0004,0x0000,0x6303,0x6303,0x0001,0x0001,0x0000,0x0000,0x0002,0x0007,0x0000,
+        0x0000,0x6303,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0004,0x0000,
+        0x9e02,0x6304,0x0000,0x0000,0x0000,0x0000,0x0002,0x6303,0x0000,0x6302,0x0001,0x0001,
+        0x0000,0x0005,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x9e02,0x0004,0x0000,0x9e02,0x6304,0x0001,0x0000,0x0004,0x0000,0x0002,0x6303,0x0001,
+        0x6302,0x0000,0x0001,0x0002,0x0007,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6303,0x0000,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6106,0x6106,0x9e06,0x6306,0x0000,0x6306,
+        0x0006,0x0006,0x0000,0x6106,0x0000,0x9e06,0x0000,0x0000,0x6306,0x0006,0x0006,0x9e06,
+        0x6106,0x6106,0x0000,0x6306,0x6306,0x6306,0x0000,0x0006,0x0000,0x6306,0x0000,0x6306,
+        0x0000,0x0000,0x6306,0x6306,0x6306,0x6306,0x0000,0x0000,0x6306,0x0000,0x0000,0x0000,
+        0x6306,0x0000,0x0006,0x6306,0x6306,0x6306,0x6306,0x0000,0x0006,0x6306,0x0006,0x0000,
+        0x0002,0x6103,0x0000,0x6306,0x6306,0x0001,0x0000,0x0006,0x0000,0x0002,0x6303,0x0001,
+        0x6306,0x0000,0x0001,0x0002,0x0006,0x0000,0x0000,0x0006,0x0000,0x6306,0x0006,0x0000,
+        0x0000,0x0000,0x0000,0x6303,0x0000,0x6303,0x0000,0x0000,0x0001,0x6305,0x6305,0x6305,
+        0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x6305,0x0000,0x0005,0x6303,0x6303,0x6303,
+        0x0001,0x0000,0x0001,0x6305,0x0005,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,
+        0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,0x6303,0x6303,0x0001,
+        0x0001,0x0000,0x0000,0x0002,0x0004,0x0000,0x6303,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0002,0x0001,0x0001,0x6303,0x0003,0x0000,0x0001,0x0001,0x0000,0x0000,0x0001,0x0000,
+        0x9e02,0x0004,0x0000,0x9e02,0x6304,0x0001,0x0000,0x0004,0x0000,0x0002,0x6303,0x0001,
+        0x6302,0x0000,0x0001,0x0002,0x0005,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x9e02,0x0004,0x0001,0x9e02,0x0000,0x0001,0x9e02,0x0004,0x0000,
+        0x0002,0x0000,0x0001,0x0000,0x0000,0x0000,0x0002,0x0001,0x0001,0x0001,0x0001,0x0000,
+        0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0004,0x0000,0x9e02,0x0004,0x0000,
+        0x0000,0x0000,0x0000,0x0002,0x0003,0x0000,0x0002,0x0001,0x0001,0x0000,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0004,0x0000,
+        0x6306,0x6306,0x0000,0x0000,0x0000,0x0000,0x6103,0x6303,0x0000,0x6306,0x0001,0x6306,
+        0x0000,0x0006,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0004,0x0004,0x0000,0x6306,0x6306,0x6306,0x0000,0x0004,0x0000,0x6103,0x6303,0x0006,
+        0x6306,0x0000,0x0006,0x0006,0x0006,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6303,0x0000,0x6306,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,0x6303,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x0004,0x0000,0x6303,0x6303,0x6303,0x0001,0x0000,0x0001,0x0002,0x0005,0x0000,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,0x6303,0x6303,
+        0x0001,0x0000,0x0001,0x0004,0x0004,0x0000,0x6303,0x0000,0x0003,0x0000,0x0000,0x0001,
+        0x0002,0x0001,0x0001,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,
+        0x0000,0x6303,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x6303,0x0003,0x0000,
+        0x0001,0x0001,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6303,0x0000,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0004,0x0000,0x9e02,0x0004,0x0000,
+        0x0000,0x0000,0x0000,0x0002,0x0003,0x0000,0x0002,0x0001,0x0001,0x0000,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x5f08,0x0000,0x0008,0x6304,0x0000,0x0000,0x0000,0x0000,0xa008,0x6303,0x0000,
+        0x6302,0x0001,0x9e06,0x0000,0x9e06,0x0000,0x0000,0x0000,0x0000,0x0000,0x9e06,0x0000,
+        0x0000,0x0000,0x0000,0x5f08,0x6308,0x0000,0x5f08,0x6304,0x9e06,0x0000,0x6308,0x0000,
+        0x6108,0x6303,0x9e06,0x6302,0x0000,0x9e06,0x9e06,0x6308,0x0000,0x0000,0x6308,0x0000,
+        0x9e06,0x6308,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0008,0x6108,0x0000,
+        0x0008,0x6304,0x0008,0x0000,0x6108,0x0000,0x6308,0x6303,0x6308,0x6302,0x0000,0x6308,
+        0x6308,0x6308,0x0000,0x0000,0x9e03,0x0000,0x9e02,0x9e05,0x0000,0x0000,0x0000,0x0000,
+        0x6307,0x6307,0x6307,0x6307,0x0000,0x6307,0x6307,0x6307,0x0000,0x6307,0x0000,0x6307,
+        0x0000,0x0000,0x6307,0x6307,0x6307,0x6307,0x6307,0x6307,0x0000,0x6307,0x6307,0x6307,
+        0x0000,0x6307,0x0000,0x0000,0x0008,0x0000,0x0008,0x6304,0x0000,0x0000,0x0000,0x0000,
+        0x6308,0x6303,0x0000,0x6302,0x0001,0x6308,0x0000,0x6308,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x9e07,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x0000,
+        0x9e02,0x6304,0x0000,0x0000,0x0000,0x0000,0x9e02,0x6303,0x0000,0x6302,0x0001,0x0001,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0xa008,0x5f08,0x0000,0x5f08,0x6304,0x9e06,0x0000,0x9e06,0x0000,
+        0xa008,0x6303,0x9e06,0x6302,0x0000,0x9e06,0x9e06,0x9e06,0x0000,0x0000,0x0008,0x0000,
+        0x0008,0x0008,0x0000,0x0000,0x0000,0x0000,0x6306,0x6306,0x6306,0x6306,0x0000,0x6306,
+        0x6306,0x6306,0x0000,0x6306,0x0000,0x6306,0x0000,0x0000,0x6306,0x6306,0x6306,0x6306,
+        0x6306,0x6306,0x0000,0x6306,0x6306,0x6306,0x0000,0x6306,0x0000,0x0000,0x0008,0x0000,
+        0x0008,0x6304,0x0000,0x0000,0x0000,0x0000,0xa008,0x6303,0x0000,0x6302,0x0001,0x9e06,
+        0x0000,0x9e06,0x0000,0x0000,0x0000,0x0000,0x0000,0x0008,0x0000,0x0000,0x0000,0x0000,
+        0x6305,0x6305,0x6305,0x6305,0x0000,0x6305,0x6305,0x6305,0x0000,0x6305,0x0000,0x6305,
+        0x0000,0x0000,0x6305,0x6305,0x6305,0x6305,0x6305,0x6305,0x0000,0x6305,0x6305,0x6305,
+        0x0000,0x6305,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0001,0x0000,
+        0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0008,0x0008,0x0000,0x0008,0x6304,0x0008,
+        0x0000,0x0008,0x0000,0x6308,0x6303,0x6308,0x6302,0x0000,0x0008,0x6308,0x0008,0x0000,
+        0x0000,0x0008,0x0000,0x0008,0x0008,0x0000,0x0000,0x0000,0x0000,0x0000,0x9e03,0x0000,
+        0x9e02,0x6304,0x0000,0x0000,0x0000,0x0000,0x9e02,0x6303,0x0000,0x6302,0x0001,0x0001,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0008,0x0000,0x0000,0x0000,0x0000,
+        0x9e02,0x6308,0x0000,0x9e02,0x6304,0x0001,0x0000,0x0001,0x0000,0x9e02,0x6303,0x0001,
+        0x6302,0x0000,0x0001,0x0001,0x0001,0x0000,0x0000,0x6308,0x0000,0x9e02,0x0008,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6303,0x0000,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x0000,
+        0x9e06,0x6304,0x0000,0x0000,0x0000,0x0000,0x6108,0x6303,0x0000,0x6302,0x0001,0x9e06,
+        0x0000,0x6308,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x9e03,0x0000,0x9e02,0x6304,0x0000,0x0000,0x0000,0x0000,
+        0x6308,0x6303,0x0000,0x6302,0x0001,0x6308,0x0000,0x6308,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x9e02,0x6308,0x0000,0x9e02,0x6304,0x9e04,
+        0x0000,0x6308,0x0000,0x6308,0x6303,0x6308,0x6302,0x0000,0x0008,0x6308,0x0008,0x0000,
+        0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x6302,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6303,0x0000,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x5f02,0x6305,0x0000,
+        0x6102,0x6304,0x0006,0x0000,0x6305,0x0000,0x6306,0x6306,0x6306,0x6306,0x0000,0x6306,
+        0x6306,0x6306,0x0000,0x0000,0x6305,0x0000,0x0007,0x6305,0x0000,0x0000,0x0000,0x0000,
+        0x6302,0x0001,0x6106,0x6302,0x0000,0x6106,0x6302,0x0001,0x0000,0x6306,0x0000,0x6306,
+        0x0000,0x0000,0x6306,0x6306,0x0001,0x6306,0x6302,0x0001,0x0000,0x6302,0x0001,0x9e06,
+        0x0000,0x0000,0x0000,0x0000,0x6104,0x0000,0x6104,0x6304,0x0000,0x0000,0x0000,0x0000,
+        0x6306,0x6306,0x0000,0x6306,0x0001,0x6306,0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0007,0x0000,0x0000,0x0000,0x0000,0x6304,0x6304,0x6304,0x6304,0x0000,0x6304,
+        0x6304,0x6304,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,
+        0x0007,0x6305,0x0000,0x0007,0x6305,0x0007,0x0000,0x6305,0x0000,0x6302,0x0000,0x6304,
+        0x0000,0x0000,0x6304,0x6302,0x0001,0x6304,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0001,0x6302,0x0001,0x6307,0x6302,0x0000,0x0007,0x6302,0x0001,0x0000,
+        0x6304,0x6304,0x0000,0x6304,0x6304,0x6304,0x0000,0x6304,0x0000,0x0001,0x0001,0x0000,
+        0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0007,0x0000,0x0007,0x0007,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x6305,0x0000,0x6102,0x6304,0x0000,0x0000,0x0000,0x0000,
+        0x9e02,0x6303,0x0000,0x6302,0x0001,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6305,0x0000,0x0000,0x0000,0x0000,0x6302,0x0001,0x0000,0x6302,0x0001,0x0001,
+        0x0000,0x0000,0x0000,0x6302,0x0001,0x0001,0x6302,0x0000,0x0001,0x0001,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x6302,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x6106,0x6305,0x6106,0x6106,0x0000,0x6106,0x6106,0x6305,0x0000,0x6306,0x0000,0x6306,
+        0x0000,0x0000,0x6306,0x6306,0x6306,0x6306,0x6105,0x6305,0x0000,0x6105,0x6305,0x0006,
+        0x0000,0x6305,0x0000,0x6306,0x0000,0x6306,0x0000,0x0000,0x6306,0x6306,0x0001,0x6306,
+        0x0000,0x0000,0x6306,0x0000,0x0000,0x0000,0x6306,0x0000,0x0006,0x6306,0x0001,0x6306,
+        0x6306,0x0000,0x0006,0x6306,0x0001,0x0000,0x0006,0x6104,0x0000,0x6104,0x6304,0x0006,
+        0x0000,0x0006,0x0000,0x6306,0x6306,0x6306,0x6306,0x0000,0x0006,0x6306,0x0006,0x0000,
+        0x0000,0x0006,0x0000,0x0006,0x0006,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x6304,
+        0x0000,0x0000,0x6304,0x6304,0x6304,0x6304,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0001,0x6305,0x6305,0x6305,0x6305,0x0000,0x0005,0x6305,0x0005,0x0000,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,
+        0x0001,0x0001,0x0000,0x6304,0x6304,0x6304,0x6304,0x0000,0x0004,0x6304,0x0004,0x0000,
+        0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,0x0002,0x0003,0x0000,
+        0x0002,0x0001,0x0001,0x0000,0x0001,0x0000,0x9e02,0x6305,0x0000,0x6102,0x6304,0x0001,
+        0x0000,0x0001,0x0000,0x9e02,0x6303,0x0001,0x6302,0x0000,0x0001,0x0001,0x0001,0x0000,
+        0x0000,0x6305,0x0000,0x0002,0x0005,0x0000,0x0000,0x0000,0x0000,0x6302,0x0001,0x0001,
+        0x6302,0x0000,0x0001,0x0001,0x0000,0x0000,0x6302,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0001,0x6302,0x0001,0x0000,0x0002,0x0001,0x0001,0x0000,0x0000,0x0000,
+        0x0000,0x0003,0x0000,0x0002,0x0004,0x0000,0x0000,0x0000,0x0000,0x9e02,0x0003,0x0000,
+        0x0002,0x0001,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x6305,0x0000,0x6104,0x6304,0x0000,0x0000,0x0000,0x0000,
+        0x6306,0x6306,0x0000,0x6306,0x0001,0x6306,0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x6302,0x0001,0x0000,0x6302,0x0001,0x9e06,
+        0x0000,0x0000,0x0000,0x6306,0x0001,0x6306,0x6306,0x0000,0x0006,0x6306,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x6306,0x0000,0x6306,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x6304,0x6304,0x0000,0x6304,0x6304,0x6304,0x0000,0x6304,0x0000,0x0001,0x0001,0x0000,
+        0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x6302,0x0001,0x6304,0x6302,0x0000,0x0004,0x6302,0x0001,0x0000,
+        0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,0x0001,0x0000,0x0000,
+        0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x6304,0x0004,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x6302,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,0x6302,0x0001,0x0000,
+        0x0002,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,
+        0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,
+        0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,
+        0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,
+        0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,
+        0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,
+        0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,
+    },
+    {
+        0x0006,0x0006,0x5f06,0x0006,0x0000,0x5f06,0x5f06,0x0006,0x0000,0x0006,0x0000,0x5f05,
+        0x0000,0x0000,0x5f05,0x0006,0x0006,0x6106,0x5f06,0x5f07,0x0000,0x5f06,0x5f07,0x6106,
+        0x0000,0x6106,0x0000,0x0006,0x0000,0x5f06,0x0000,0x0000,0x0006,0x5f06,0xa008,0x6304,
+        0x0000,0x0000,0x0006,0x0000,0x0000,0x0000,0x0006,0x0000,0x6106,0x5f06,0xa008,0x6303,
+        0x5f0a,0x0000,0x6106,0x6302,0xa008,0x0000,0x5f06,0x0006,0x0000,0x5f06,0xa004,0x6308,
+        0x0000,0x6106,0x0000,0x5f02,0xa003,0x6308,0x5f02,0x0000,0x6308,0x6106,0x6106,0x0000,
+        0x0000,0x6106,0x0000,0x6106,0x6106,0x0000,0x0000,0x0000,0x0000,0x0002,0x0000,0x0003,
+        0x0000,0x0000,0x0009,0x0002,0xa00a,0x6304,0x0000,0x0000,0x0008,0x0000,0x0000,0x0000,
+        0xa008,0x0000,0x0008,0x0002,0x000a,0x6303,0x0009,0x0000,0x0009,0x6302,0x000a,0x0000,
+        0x0000,0x0000,0x0007,0x0000,0x0000,0x0000,0xa007,0x0000,0x6304,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x9e07,0x0007,0x0000,0x6303,0x0000,0x0000,0x9e07,
+        0x6302,0x9e07,0x0001,0x0002,0xa00a,0x6308,0xa009,0x0000,0x6308,0x6102,0x000a,0x0000,
+        0xa008,0x0000,0x6308,0x0000,0x0000,0x6308,0x0008,0x9e07,0x6308,0x6102,0x000a,0x0000,
+        0x0009,0x9e07,0x6308,0x0000,0x000a,0x0000,0x5f02,0x0003,0x0000,0x5f02,0x0004,0x630a,
+        0x0000,0x6309,0x0000,0x0002,0x0003,0x630a,0x0002,0x0000,0x630a,0x6309,0x6309,0x0000,
+        0x0000,0x6308,0x0000,0x6308,0x6308,0x0000,0x0000,0x0000,0x0000,0x5f02,0x0008,0x630a,
+        0x0002,0x0000,0x630a,0x6309,0x6309,0x0000,0x0002,0x0000,0x630a,0x0000,0x0000,0x630a,
+        0x6309,0x6309,0x6309,0x6308,0x6308,0x0000,0x6308,0x6308,0x6308,0x0000,0x6308,0x0000,
+        0x0000,0x6307,0x0000,0x6307,0x6307,0x0000,0x0000,0x0000,0x0000,0x6307,0x6307,0x0000,
+        0x6307,0x0001,0x6307,0x0000,0x6307,0x0000,0x0000,0x0000,0x0000,0x0000,0x6307,0x0000,
+        0x0000,0x0000,0x0000,0x0006,0x0000,0x5f06,0x0000,0x0000,0x5f08,0x5f06,0x0006,0x6304,
+        0x0000,0x0000,0xa00a,0x0000,0x0000,0x0000,0xa00a,0x0000,0xa00a,0x5f06,0x0006,0x6303,
+        0x0006,0x0000,0x6106,0x6302,0x6106,0x0000,0x0000,0x0000,0x5f06,0x0000,0x0000,0x0000,
+        0x5f06,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9e06,
+        0x5f06,0x0000,0x6303,0x0000,0x0000,0x6106,0x6302,0x9e06,0x0001,0x0006,0x0004,0x6308,
+        0x0004,0x0000,0x6308,0x6102,0x0006,0x0000,0x000a,0x0000,0x6308,0x0000,0x0000,0x6308,
+        0x5f0a,0x000a,0x6308,0x6102,0x0006,0x0000,0x6108,0x0006,0x6308,0x0000,0x6106,0x0000,
+        0x0000,0x0000,0x0005,0x0000,0x0000,0x0000,0xa005,0x0000,0x6304,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x9e05,0x0005,0x0000,0x6303,0x0000,0x0000,0x9e05,
+        0x6302,0x9e05,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0002,0x0000,0x6308,0x0000,0x0000,0x6308,
+        0x6102,0x000a,0x6304,0x0000,0x0000,0x6308,0x0000,0x0000,0x0000,0x9e02,0x0000,0x6308,
+        0x6102,0x000a,0x6303,0x0009,0x0000,0x6308,0x6302,0x000a,0x0000,0x5f02,0x0003,0x630a,
+        0x0002,0x0000,0x630a,0x6309,0x6309,0x0000,0x000a,0x0000,0x630a,0x0000,0x0000,0x630a,
+        0x6309,0x6309,0x6309,0x6308,0x6308,0x0000,0x6308,0x6308,0x6308,0x0000,0x6308,0x0000,
+        0x5f02,0x0000,0x630a,0x0000,0x0000,0x630a,0x6309,0x6309,0x6304,0x0000,0x0000,0x630a,
+        0x0000,0x0000,0x0000,0x6309,0x0000,0x6309,0x6308,0x6308,0x6303,0x6308,0x0000,0x6308,
+        0x6302,0x6308,0x0000,0x6102,0x0003,0x0000,0x6102,0x0004,0x6308,0x0000,0x6309,0x0000,
+        0x000a,0x9e03,0x6308,0x9e02,0x0000,0x6308,0x6309,0x6309,0x0000,0x0000,0x6308,0x0000,
+        0x6308,0x6308,0x0000,0x0000,0x0000,0x0000,0x5f06,0x5f04,0x0000,0x5f06,0x5f04,0x6106,
+        0x0000,0x6106,0x0000,0x0006,0xa003,0x6106,0xa002,0x0000,0x6106,0x6106,0x6106,0x0000,
+        0x0000,0x630a,0x0000,0x630a,0x630a,0x0000,0x0000,0x0000,0x0000,0x0006,0x0008,0x6104,
+        0x0002,0x0000,0x610a,0x6104,0x5f08,0x0000,0x0002,0x0000,0x0006,0x0000,0x0000,0x0006,
+        0x0006,0x0008,0x6106,0x630a,0x630a,0x0000,0x630a,0x630a,0x630a,0x0000,0x630a,0x0000,
+        0x0000,0x6306,0x0000,0x6306,0x6306,0x0000,0x0000,0x0000,0x0000,0x6306,0x6306,0x0000,
+        0x6306,0x0001,0x6306,0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,0x0000,0x6306,0x0000,
+        0x0000,0x0000,0x0000,0x0002,0xa00a,0x6104,0xa009,0x0000,0x0009,0x6104,0x000a,0x0000,
+        0xa008,0x0000,0x0008,0x0000,0x0000,0x9e05,0x0008,0x9e05,0x0008,0x630a,0x630a,0x0000,
+        0x630a,0x630a,0x630a,0x0000,0x630a,0x0000,0x0002,0x0000,0x6104,0x0000,0x0000,0x0009,
+        0x6104,0x9e04,0x6304,0x0000,0x0000,0x0008,0x0000,0x0000,0x0000,0x0008,0x0000,0x0008,
+        0x630a,0x630a,0x6303,0x630a,0x0000,0x630a,0x6302,0x630a,0x0000,0x5f02,0xa00a,0x0000,
+        0xa009,0x9e04,0x6308,0x0000,0x000a,0x0000,0xa008,0x9e03,0x6308,0x9e02,0x0000,0x6308,
+        0x0008,0x9e08,0x0000,0x0000,0x630a,0x0000,0x630a,0x630a,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6305,0x0000,0x6305,0x6305,0x0000,0x0000,0x0000,0x0000,0x6305,0x6305,0x0000,
+        0x6305,0x0001,0x6305,0x0000,0x6305,0x0000,0x0000,0x0000,0x0000,0x0000,0x6305,0x0000,
+        0x0000,0x0000,0x0000,0x6104,0x0008,0x0000,0x6104,0x9e04,0x630a,0x0000,0x6309,0x0000,
+        0x0002,0x9e03,0x630a,0x0002,0x0000,0x630a,0x6309,0x6309,0x0000,0x0000,0x6308,0x0000,
+        0x6308,0x6308,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0006,0x0000,0x5f03,
+        0x0000,0x0000,0x0006,0x5f02,0xa005,0x6304,0x0000,0x0000,0xa006,0x0000,0x0000,0x0000,
+        0x0006,0x0000,0x6106,0x5f02,0xa005,0x6303,0x0006,0x0000,0x610a,0x6302,0xa005,0x0000,
+        0x0000,0x0000,0x5f03,0x0000,0x0000,0x0000,0x5f02,0x0000,0x6304,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6106,0x5f02,0x0000,0x6303,0x0000,0x0000,0x610a,
+        0x6302,0x0001,0x0001,0x0006,0x0006,0x6106,0x0006,0x0000,0x6106,0x6106,0x6106,0x0000,
+        0x0006,0x0000,0x6106,0x0000,0x0000,0x6106,0x6106,0x6106,0x6106,0x6107,0x6107,0x0000,
+        0x6107,0x6107,0x6106,0x0000,0x6106,0x0000,0x0000,0x0000,0x0004,0x0000,0x0000,0x0000,
+        0xa004,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,
+        0x0002,0x0000,0x6303,0x0000,0x0000,0x0009,0x6302,0x9e05,0x0001,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,
+        0xa004,0x0000,0x0004,0x0000,0x0000,0x9e04,0x0004,0x9e04,0x6304,0x0000,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0002,0x000a,0x6303,0x0009,0x0000,0x0009,
+        0x6302,0x000a,0x0000,0x0002,0x0005,0x630a,0x0002,0x0000,0x630a,0x6309,0x6309,0x0000,
+        0x0003,0x0000,0x630a,0x0000,0x0000,0x630a,0x6309,0x6309,0x6309,0x6102,0x0005,0x0000,
+        0x6107,0x0005,0x630a,0x0000,0x6309,0x0000,0x0002,0x0000,0x630a,0x0000,0x0000,0x630a,
+        0x6309,0x0001,0x6304,0x0000,0x0000,0x630a,0x0000,0x0000,0x0000,0x6309,0x0000,0x6309,
+        0x6102,0x0001,0x6303,0x0002,0x0000,0x630a,0x6302,0x0001,0x0000,0x6307,0x6307,0x0000,
+        0x6307,0x6307,0x6307,0x0000,0x6307,0x0000,0x6307,0x6307,0x6307,0x6307,0x0000,0x6307,
+        0x6307,0x6307,0x0000,0x0000,0x6307,0x0000,0x6307,0x6307,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0004,0x0000,0x0000,0x0000,0x0006,0x0000,0x6304,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x9e06,0x0006,0x0000,0x6303,0x0000,0x0000,0x0006,
+        0x6302,0xa005,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,
+        0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,0x0004,0x0000,0x0004,0x0000,0x0000,0xa006,
+        0x0006,0x0006,0x6304,0x0000,0x0000,0x9e06,0x0000,0x0000,0x0000,0x9e06,0x0000,0x9e06,
+        0x0006,0x0006,0x6303,0x0006,0x0000,0x0006,0x6302,0x0006,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0004,0x0000,0x0000,0x0000,0x0004,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0002,0x0000,0x6303,
+        0x0000,0x0000,0x0009,0x6302,0x000a,0x0001,0x0003,0x0000,0x630a,0x0000,0x0000,0x630a,
+        0x6309,0x6309,0x6304,0x0000,0x0000,0x630a,0x0000,0x0000,0x0000,0x6309,0x0000,0x6309,
+        0x6102,0x0005,0x6303,0x0002,0x0000,0x630a,0x6302,0x6309,0x0000,0x0000,0x0000,0x630a,
+        0x0000,0x0000,0x0000,0x6309,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6309,0x6102,0x0000,0x6303,0x0000,0x0000,0x630a,0x6302,0x0001,0x0001,
+        0x0003,0x0003,0x630a,0x0004,0x0000,0x630a,0x6309,0x6309,0x0000,0x000a,0x0000,0x630a,
+        0x0000,0x0000,0x630a,0x6309,0x6309,0x6309,0x6102,0x0003,0x0000,0x0002,0x0009,0x630a,
+        0x0000,0x6309,0x0000,0x5f0a,0xa005,0x6106,0x0006,0x0000,0x6106,0x6106,0xa005,0x0000,
+        0x0006,0x0000,0x6106,0x0000,0x0000,0x6106,0x6106,0x9e06,0x6106,0x630a,0x630a,0x0000,
+        0x630a,0x630a,0x630a,0x0000,0x630a,0x0000,0x0002,0x0000,0x6104,0x0000,0x0000,0x610a,
+        0x5f02,0x0001,0x6304,0x0000,0x0000,0x0006,0x0000,0x0000,0x0000,0x9e06,0x0000,0x6106,
+        0x630a,0x0001,0x6303,0x630a,0x0000,0x630a,0x6302,0x0001,0x0000,0x6306,0x6306,0x0000,
+        0x6306,0x6306,0x6306,0x0000,0x6306,0x0000,0x6306,0x6306,0x6306,0x6306,0x0000,0x6306,
+        0x6306,0x6306,0x0000,0x0000,0x6306,0x0000,0x6306,0x6306,0x0000,0x0000,0x0000,0x0000,
+        0xa004,0x0000,0x6104,0x0000,0x0000,0x9e04,0x6104,0x9e04,0x6304,0x0000,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x630a,0x630a,0x6303,0x630a,0x0000,0x630a,
+        0x6302,0x630a,0x0000,0x0000,0x0000,0x6104,0x0000,0x0000,0x0000,0x9e02,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x630a,0x0000,0x6303,
+        0x0000,0x0000,0x630a,0x6302,0x0001,0x0001,0xa004,0x9e03,0x6104,0x9e02,0x0000,0x9e04,
+        0x6104,0x9e04,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,
+        0x630a,0x630a,0x0000,0x630a,0x630a,0x630a,0x0000,0x630a,0x0000,0x6305,0x6305,0x0000,
+        0x6305,0x6305,0x6305,0x0000,0x6305,0x0000,0x6305,0x6305,0x6305,0x6305,0x0000,0x6305,
+        0x6305,0x6305,0x0000,0x0000,0x6305,0x0000,0x6305,0x6305,0x0000,0x0000,0x0000,0x0000,
+        0x0002,0x0001,0x630a,0x0002,0x0000,0x630a,0x6309,0x0001,0x0000,0x0002,0x0000,0x630a,
+        0x0000,0x0000,0x630a,0x6309,0x0001,0x6309,0x630a,0x0001,0x0000,0x630a,0x0001,0x630a,
+        0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x5f06,0x5f04,0x0000,0x5f06,0xa004,0x6305,
+        0x0000,0x6106,0x0000,0x5f02,0xa003,0x6305,0x5f02,0x0000,0x6305,0x6109,0x6109,0x0000,
+        0x0000,0x6306,0x0000,0x6306,0x6306,0x0000,0x0000,0x0000,0x0000,0x5f06,0x5f09,0x6106,
+        0x5f0a,0x0000,0x6106,0x6106,0x6106,0x0000,0x0006,0x0000,0x610a,0x0000,0x0000,0x610a,
+        0x6109,0x6109,0x6106,0x6306,0x6306,0x0000,0x6306,0x6306,0x6306,0x0000,0x6306,0x0000,
+        0x0000,0x6106,0x0000,0x6302,0xa004,0x0000,0x0000,0x0000,0x0000,0x6302,0xa003,0x0000,
+        0x6302,0x0001,0x0001,0x0000,0x6106,0x0000,0x0000,0x0000,0x0000,0x0000,0x6306,0x0000,
+        0x0000,0x0000,0x0000,0x0002,0x000a,0x6305,0x0009,0x0000,0x6305,0x6102,0x000a,0x0000,
+        0x0002,0x0000,0x6305,0x0000,0x0000,0x6305,0x0002,0x000a,0x6305,0x6102,0x610a,0x0000,
+        0x0009,0x9e05,0x6305,0x0000,0x610a,0x0000,0x0007,0x0000,0x0007,0x0000,0x0000,0x9e04,
+        0x0007,0x9e04,0x6304,0x0000,0x0000,0x0007,0x0000,0x0000,0x0000,0x0007,0x0000,0x0007,
+        0x0007,0x9e03,0x6303,0x9e02,0x0000,0x9e07,0x6302,0x9e07,0x0000,0x6302,0x000a,0x0000,
+        0x6302,0x9e04,0x0001,0x0000,0x000a,0x0000,0x6302,0x9e03,0x0001,0x6302,0x0000,0x0001,
+        0x6302,0x000a,0x0000,0x0000,0x610a,0x0000,0x6302,0x9e07,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6304,0x0000,0x6304,0x6304,0x0000,0x0000,0x0000,0x0000,0x6102,0x0003,0x0000,
+        0x6102,0x0001,0x6305,0x0000,0x6309,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x6304,0x6304,0x0000,0x6304,0x6304,0x6304,0x0000,0x6304,0x0000,
+        0x6109,0x0003,0x630a,0x0002,0x0000,0x630a,0x6309,0x6309,0x0000,0x0000,0x0001,0x0000,
+        0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x6307,0x0000,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x5f06,0x000a,0x6305,
+        0x5f02,0x0000,0x6305,0x6106,0x6106,0x0000,0x5f0a,0x0000,0x6305,0x0000,0x0000,0x6305,
+        0x5f0a,0x000a,0x6305,0x6306,0x6306,0x0000,0x6306,0x6306,0x6306,0x0000,0x6306,0x0000,
+        0x5f06,0x0000,0x6106,0x0000,0x0000,0x6106,0x6106,0x6106,0x6304,0x0000,0x0000,0x9e06,
+        0x0000,0x0000,0x0000,0x9e06,0x0000,0x9e06,0x6306,0x6306,0x6306,0x6306,0x0000,0x6306,
+        0x6306,0x6306,0x0000,0x6302,0x0004,0x0000,0x6302,0xa004,0x0001,0x0000,0x6106,0x0000,
+        0x6302,0x9e06,0x0001,0x6302,0x0000,0x0001,0x6302,0x000a,0x0000,0x0000,0x6306,0x0000,
+        0x6306,0x6306,0x0000,0x0000,0x0000,0x0000,0x0005,0x0000,0x6305,0x0000,0x0000,0x6305,
+        0x0005,0x9e04,0x6304,0x0000,0x0000,0x6305,0x0000,0x0000,0x0000,0x9e02,0x0000,0x6305,
+        0x0005,0x9e03,0x6303,0x9e02,0x0000,0x6305,0x6302,0x9e05,0x0000,0x0000,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,
+        0x6302,0x000a,0x0001,0x6302,0x0000,0x0001,0x6302,0x000a,0x0000,0x6302,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x6302,0x000a,0x0001,0x6302,0x000a,0x0000,0x6302,0x9e09,0x0001,
+        0x0000,0x000a,0x0000,0x6304,0x6304,0x0000,0x6304,0x6304,0x6304,0x0000,0x6304,0x0000,
+        0x610a,0x9e03,0x6305,0x9e02,0x0000,0x6305,0x6309,0x6309,0x0000,0x0000,0x0001,0x0000,
+        0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x6304,0x6304,0x6304,0x6304,0x0000,0x6304,
+        0x6304,0x6304,0x0000,0x610a,0x0000,0x630a,0x0000,0x0000,0x630a,0x6309,0x6309,0x6309,
+        0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x6304,0x0000,
+        0x6302,0x6304,0x0000,0x0000,0x0000,0x0000,0x6302,0x9e03,0x0000,0x6302,0x0001,0x0001,
+        0x0000,0x6309,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6106,0x0000,0x6106,0x6104,0x0000,0x0000,0x0000,0x0000,0x6105,0x0003,0x0000,
+        0x5f02,0x0001,0x6305,0x0000,0x6106,0x0000,0x0000,0x0000,0x0000,0x0000,0x6306,0x0000,
+        0x0000,0x0000,0x0000,0x6104,0x6104,0x0000,0x6104,0x6104,0x6106,0x0000,0x6106,0x0000,
+        0x0006,0x0003,0x610a,0x0002,0x0000,0x610a,0x6109,0x6109,0x0000,0x0000,0x6306,0x0000,
+        0x6306,0x6306,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6306,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x6306,0x0000,0x6306,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x610a,0x610a,0x0000,
+        0x0009,0x9e04,0x6305,0x0000,0x610a,0x0000,0x0002,0x9e03,0x6305,0x9e02,0x0000,0x6305,
+        0x0002,0x000a,0x0000,0x0000,0x630a,0x0000,0x630a,0x630a,0x0000,0x0000,0x0000,0x0000,
+        0x610a,0x610a,0x6104,0x0009,0x0000,0x0009,0x6104,0x610a,0x0000,0x0002,0x0000,0x0003,
+        0x0000,0x0000,0x0009,0x0002,0x000a,0x0009,0x630a,0x630a,0x0000,0x630a,0x630a,0x630a,
+        0x0000,0x630a,0x0000,0x0000,0x610a,0x0000,0x6302,0x9e04,0x0000,0x0000,0x0000,0x0000,
+        0x6302,0x9e03,0x0000,0x6302,0x0001,0x0001,0x0000,0x000a,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x630a,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x6305,0x0000,0x6305,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,
+        0x6304,0x6304,0x0000,0x0000,0x0000,0x0000,0x6109,0x0003,0x0000,0x0002,0x0001,0x630a,
+        0x0000,0x6309,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0006,0x0000,0x5f06,0x0000,0x0000,0x5f06,0x0006,0x0008,0x6304,
+        0x0000,0x0000,0x0008,0x0000,0x0000,0x0000,0x0008,0x0000,0x0008,0x5f06,0x000a,0x6303,
+        0x5f06,0x0000,0x6106,0x6302,0x0008,0x0000,0x0000,0x0000,0x5f04,0x0000,0x0000,0x0000,
+        0x0008,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xa006,
+        0x5f02,0x0000,0x6303,0x0000,0x0000,0x6106,0x6302,0xa008,0x0001,0x5f06,0x0006,0x6308,
+        0x5f06,0x0000,0x6308,0x6102,0x0006,0x0000,0x0006,0x0000,0x6308,0x0000,0x0000,0x6308,
+        0x0006,0x0006,0x6308,0x6106,0x6106,0x0000,0x6106,0x6106,0x6308,0x0000,0x6106,0x0000,
+        0x0000,0x0000,0x0003,0x0000,0x0000,0x0000,0x0002,0x0000,0x6304,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0008,0x0003,0x0000,0x6303,0x0000,0x0000,0x0001,
+        0x6302,0x000a,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,
+        0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,0xa003,0x0000,0x6308,0x0000,0x0000,0x0001,
+        0x6102,0x000a,0x6304,0x0000,0x0000,0x6308,0x0000,0x0000,0x0000,0x0008,0x0000,0x6308,
+        0x0003,0x9e03,0x6303,0x0001,0x0000,0x0001,0x6302,0x000a,0x0000,0x5f02,0x0005,0x630a,
+        0x5f02,0x0000,0x630a,0x6102,0x0005,0x0000,0x0005,0x0000,0x630a,0x0000,0x0000,0x630a,
+        0x0005,0x0005,0x630a,0x6308,0x6308,0x0000,0x6308,0x6308,0x6308,0x0000,0x6308,0x0000,
+        0x0002,0x0000,0x630a,0x0000,0x0000,0x630a,0x6102,0x0008,0x6304,0x0000,0x0000,0x630a,
+        0x0000,0x0000,0x0000,0x0008,0x0000,0x630a,0x6308,0x6308,0x6303,0x6308,0x0000,0x6308,
+        0x6302,0x6308,0x0000,0x6307,0x6307,0x0000,0x6307,0x6307,0x6307,0x0000,0x6307,0x0000,
+        0x6307,0x6307,0x6307,0x6307,0x0000,0x6307,0x6307,0x6307,0x0000,0x0000,0x6307,0x0000,
+        0x6307,0x6307,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x5f04,0x0000,0x0000,0x0000,
+        0x0008,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xa00a,
+        0x5f02,0x0000,0x6303,0x0000,0x0000,0x6106,0x6302,0xa006,0x0001,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,
+        0x0004,0x0000,0x6308,0x0000,0x0000,0x6308,0x6102,0x000a,0x6304,0x0000,0x0000,0x6308,
+        0x0000,0x0000,0x0000,0x000a,0x0000,0x6308,0x6102,0x0006,0x6303,0x0006,0x0000,0x6308,
+        0x6302,0x0006,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,
+        0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,
+        0x0000,0x0000,0x0000,0x6102,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6308,0x0003,0x0000,0x6303,0x0000,0x0000,0x0001,0x6302,0x000a,0x0001,
+        0x0004,0x0000,0x630a,0x0000,0x0000,0x630a,0x6102,0x0008,0x6304,0x0000,0x0000,0x630a,
+        0x0000,0x0000,0x0000,0x000a,0x0000,0x630a,0x6308,0x6308,0x6303,0x6308,0x0000,0x6308,
+        0x6302,0x6308,0x0000,0x0000,0x0000,0x630a,0x0000,0x0000,0x0000,0x6102,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x630a,0x6308,0x0000,0x6303,
+        0x0000,0x0000,0x6308,0x6302,0x6308,0x0001,0x6102,0x0004,0x6308,0x6102,0x0000,0x6308,
+        0x6102,0x0004,0x0000,0x000a,0x0000,0x6308,0x0000,0x0000,0x6308,0x000a,0x000a,0x6308,
+        0x6308,0x6308,0x0000,0x6308,0x6308,0x6308,0x0000,0x6308,0x0000,0x5f06,0x0006,0x6106,
+        0x5f06,0x0000,0x6106,0x6104,0x0006,0x0000,0x0006,0x0000,0x6106,0x0000,0x0000,0x6106,
+        0x0006,0x0006,0x6106,0x630a,0x630a,0x0000,0x630a,0x630a,0x630a,0x0000,0x630a,0x0000,
+        0x0002,0x0000,0x6104,0x0000,0x0000,0x0006,0x6104,0x0008,0x6304,0x0000,0x0000,0x0006,
+        0x0000,0x0000,0x0000,0x0008,0x0000,0x0006,0x630a,0x630a,0x6303,0x630a,0x0000,0x630a,
+        0x6302,0x630a,0x0000,0x6306,0x6306,0x0000,0x6306,0x6306,0x6306,0x0000,0x6306,0x0000,
+        0x6306,0x6306,0x6306,0x6306,0x0000,0x6306,0x6306,0x6306,0x0000,0x0000,0x6306,0x0000,
+        0x6306,0x6306,0x0000,0x0000,0x0000,0x0000,0xa003,0x0000,0x0003,0x0000,0x0000,0x0001,
+        0x6104,0x000a,0x6304,0x0000,0x0000,0x9e03,0x0000,0x0000,0x0000,0x0008,0x0000,0x0008,
+        0x630a,0x630a,0x6303,0x0001,0x0000,0x0001,0x6302,0x630a,0x0000,0x0000,0x0000,0x0003,
+        0x0000,0x0000,0x0000,0x6104,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0008,0x630a,0x0000,0x6303,0x0000,0x0000,0x0001,0x6302,0x630a,0x0001,
+        0xa003,0x9e03,0x6308,0x0001,0x0000,0x0001,0x6102,0x000a,0x0000,0x9e02,0x0000,0x6308,
+        0x0000,0x0000,0x0001,0x0008,0x9e08,0x6308,0x630a,0x630a,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x630a,0x0000,0x6305,0x6305,0x0000,0x6305,0x6305,0x6305,0x0000,0x6305,0x0000,
+        0x6305,0x6305,0x6305,0x6305,0x0000,0x6305,0x6305,0x6305,0x0000,0x0000,0x6305,0x0000,
+        0x6305,0x6305,0x0000,0x0000,0x0000,0x0000,0x6104,0x0008,0x630a,0x6104,0x0000,0x630a,
+        0x6102,0x0008,0x0000,0x0002,0x0000,0x630a,0x0000,0x0000,0x630a,0x0002,0x0008,0x630a,
+        0x6308,0x6308,0x0000,0x6308,0x6308,0x6308,0x0000,0x6308,0x0000,0x0000,0x0001,0x0000,
+        0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0xa00a,0x0000,0x0000,0x0000,0x000a,0x0000,0x6304,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x9e06,0x5f0a,0x0000,0x6303,0x0000,0x0000,0x9e06,
+        0x6302,0x9e06,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,
+        0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,0xa00a,0x0000,0xa00a,0x0000,0x0000,0x9e06,
+        0x5f0a,0x000a,0x6304,0x0000,0x0000,0x9e06,0x0000,0x0000,0x0000,0x9e06,0x0000,0x9e06,
+        0x5f0a,0x000a,0x6303,0x9e06,0x0000,0x9e06,0x6302,0x000a,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x9e03,0x0000,0x0000,0x0000,0x9e02,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x9e02,0x0000,0x6303,
+        0x0000,0x0000,0x0001,0x6302,0x000a,0x0001,0x000a,0x0000,0x630a,0x0000,0x0000,0x630a,
+        0x000a,0x9e04,0x6304,0x0000,0x0000,0x630a,0x0000,0x0000,0x0000,0x000a,0x0000,0x630a,
+        0x610a,0x9e03,0x6303,0x610a,0x0000,0x630a,0x6302,0x9e05,0x0000,0x0000,0x0000,0x630a,
+        0x0000,0x0000,0x0000,0x9e02,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x630a,0x9e02,0x0000,0x6303,0x0000,0x0000,0x630a,0x6302,0x0001,0x0001,
+        0x6307,0x6307,0x6307,0x6307,0x0000,0x6307,0x6307,0x6307,0x0000,0x6307,0x0000,0x6307,
+        0x0000,0x0000,0x6307,0x6307,0x6307,0x6307,0x6307,0x6307,0x0000,0x6307,0x6307,0x6307,
+        0x0000,0x6307,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,
+        0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xa00a,
+        0x0000,0x0000,0x0000,0x000a,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x9e06,0x000a,0x0000,0x6303,0x0000,0x0000,0x9e06,0x6302,0x000a,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,0x0000,0x0000,0x630a,
+        0x0000,0x0000,0x0000,0x000a,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x630a,0x000a,0x0000,0x6303,0x0000,0x0000,0x630a,0x6302,0x9e05,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,
+        0x6302,0x0000,0x0001,0x000a,0x0000,0x630a,0x0000,0x0000,0x630a,0x000a,0x000a,0x6304,
+        0x0000,0x0000,0x630a,0x0000,0x0000,0x0000,0x000a,0x0000,0x000a,0x000a,0x000a,0x6303,
+        0x000a,0x0000,0x000a,0x6302,0x000a,0x0000,0x5f0a,0x0000,0x610a,0x0000,0x0000,0x9e06,
+        0x5f0a,0x9e06,0x6304,0x0000,0x0000,0x9e06,0x0000,0x0000,0x0000,0x9e06,0x0000,0x9e06,
+        0x630a,0x630a,0x6303,0x630a,0x0000,0x630a,0x6302,0x630a,0x0000,0x0000,0x0000,0x610a,
+        0x0000,0x0000,0x0000,0x9e06,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x9e06,0x630a,0x0000,0x6303,0x0000,0x0000,0x630a,0x6302,0x0001,0x0001,
+        0x6306,0x6306,0x6306,0x6306,0x0000,0x6306,0x6306,0x6306,0x0000,0x6306,0x0000,0x6306,
+        0x0000,0x0000,0x6306,0x6306,0x6306,0x6306,0x6306,0x6306,0x0000,0x6306,0x6306,0x6306,
+        0x0000,0x6306,0x0000,0x0000,0x0000,0x9e03,0x0000,0x0000,0x0000,0x9e02,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x630a,0x0000,0x6303,
+        0x0000,0x0000,0x0001,0x6302,0x630a,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,0x9e02,0x0000,0x9e03,
+        0x0000,0x0000,0x0001,0x9e02,0x9e04,0x6304,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0001,0x630a,0x630a,0x6303,0x0001,0x0000,0x0001,0x6302,0x000a,0x0000,
+        0x6305,0x6305,0x6305,0x6305,0x0000,0x6305,0x6305,0x6305,0x0000,0x6305,0x0000,0x6305,
+        0x0000,0x0000,0x6305,0x6305,0x6305,0x6305,0x6305,0x6305,0x0000,0x6305,0x6305,0x6305,
+        0x0000,0x6305,0x0000,0x9e02,0x0000,0x630a,0x0000,0x0000,0x630a,0x9e02,0x0001,0x6304,
+        0x0000,0x0000,0x630a,0x0000,0x0000,0x0000,0x9e02,0x0000,0x000a,0x630a,0x0001,0x6303,
+        0x630a,0x0000,0x000a,0x6302,0x0001,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,
+        0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x5f06,0x0006,0x6305,
+        0x5f06,0x0000,0x6305,0x6102,0x0006,0x0000,0x0006,0x0000,0x6305,0x0000,0x0000,0x6305,
+        0x0006,0x0006,0x6305,0x6306,0x6306,0x0000,0x6306,0x6306,0x6306,0x0000,0x6306,0x0000,
+        0x0006,0x0000,0x6106,0x0000,0x0000,0x6106,0x6104,0x0006,0x6304,0x0000,0x0000,0x0006,
+        0x0000,0x0000,0x0000,0x0006,0x0000,0x0006,0x6306,0x6306,0x6306,0x6306,0x0000,0x6306,
+        0x6306,0x6306,0x0000,0x6302,0x6106,0x0000,0x6302,0x9e06,0x0001,0x0000,0x6106,0x0000,
+        0x6302,0xa003,0x0001,0x6302,0x0000,0x0001,0x6302,0x0006,0x0000,0x0000,0x6306,0x0000,
+        0x6306,0x6306,0x0000,0x0000,0x0000,0x0000,0x0003,0x0000,0x6305,0x0000,0x0000,0x0001,
+        0x6102,0x000a,0x6304,0x0000,0x0000,0x6305,0x0000,0x0000,0x0000,0x0002,0x0000,0x6305,
+        0x0003,0x9e03,0x6303,0x0001,0x0000,0x0001,0x6302,0x000a,0x0000,0x0000,0x0000,0x9e03,
+        0x0000,0x0000,0x0000,0x0007,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0007,0x9e02,0x0000,0x6303,0x0000,0x0000,0x0001,0x6302,0x9e07,0x0001,
+        0x6302,0x9e03,0x0001,0x0001,0x0000,0x0000,0x6302,0x000a,0x0000,0x6302,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x6302,0x000a,0x0001,0x6302,0x9e03,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x000a,0x0000,0x6304,0x6304,0x0000,0x6304,0x6304,0x6304,0x0000,0x6304,0x0000,
+        0x6102,0x0003,0x6305,0x6102,0x0000,0x6305,0x6102,0x0005,0x0000,0x0000,0x0001,0x0000,
+        0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x6304,0x6304,0x6304,0x6304,0x0000,0x6304,
+        0x6304,0x6304,0x0000,0x0002,0x0000,0x630a,0x0000,0x0000,0x630a,0x0002,0x0007,0x630a,
+        0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x6304,0x0000,
+        0x6302,0x6304,0x0000,0x0000,0x0000,0x0000,0x6302,0x6307,0x0000,0x6302,0x0001,0x0001,
+        0x0000,0x6307,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x5f02,0x0000,0x6305,0x0000,0x0000,0x6305,0x6102,0x0006,0x6304,0x0000,0x0000,0x6305,
+        0x0000,0x0000,0x0000,0x000a,0x0000,0x6305,0x6306,0x6306,0x6306,0x6306,0x0000,0x6306,
+        0x6306,0x6306,0x0000,0x0000,0x0000,0x6106,0x0000,0x0000,0x0000,0x0006,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9e06,0x6306,0x0000,0x6306,
+        0x0000,0x0000,0x6306,0x6306,0x6306,0x0001,0x6302,0xa006,0x0001,0x6302,0x0000,0x0001,
+        0x6302,0x0006,0x0000,0x6302,0x0000,0x0001,0x0000,0x0000,0x0000,0x6302,0x000a,0x0001,
+        0x6306,0x6306,0x0000,0x6306,0x6306,0x0001,0x0000,0x6306,0x0000,0x0000,0x0000,0x6305,
+        0x0000,0x0000,0x0000,0x0005,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6305,0x9e02,0x0000,0x6303,0x0000,0x0000,0x0001,0x6302,0x9e05,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0000,0x6302,0x0000,0x0001,0x0000,0x0000,0x0000,0x6302,0x000a,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,0x6302,0x9e03,0x0001,
+        0x0001,0x0000,0x0000,0x6302,0x000a,0x0000,0x6304,0x6304,0x6304,0x6304,0x0000,0x6304,
+        0x6304,0x6304,0x0000,0x000a,0x0000,0x6305,0x0000,0x0000,0x6305,0x000a,0x000a,0x6305,
+        0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x6304,0x0000,0x6304,
+        0x0000,0x0000,0x6304,0x6304,0x6304,0x6304,0x0000,0x0000,0x630a,0x0000,0x0000,0x0000,
+        0x000a,0x0000,0x000a,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,
+        0x6302,0x6304,0x0000,0x6302,0x6304,0x0001,0x0000,0x6304,0x0000,0x6302,0x9e03,0x0001,
+        0x6302,0x0000,0x0001,0x6302,0x000a,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x6106,0x6106,0x0000,0x6106,0x9e06,0x6305,0x0000,0x6106,0x0000,
+        0x6105,0x0003,0x6305,0x9e06,0x0000,0x6305,0x6105,0x0006,0x0000,0x0000,0x6306,0x0000,
+        0x6306,0x6306,0x0000,0x0000,0x0000,0x0000,0x6104,0x6104,0x6106,0x0006,0x0000,0x6106,
+        0x6104,0x6104,0x0000,0x0006,0x0000,0x0006,0x0000,0x0000,0x0006,0x0006,0x0006,0x0006,
+        0x6306,0x6306,0x0000,0x6306,0x6306,0x6306,0x0000,0x6306,0x0000,0x0000,0x6306,0x0000,
+        0x6306,0x6306,0x0000,0x0000,0x0000,0x0000,0x6306,0x6306,0x0000,0x6306,0x0001,0x0001,
+        0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,
+        0x0003,0x9e03,0x6305,0x0001,0x0000,0x0001,0x6102,0x000a,0x0000,0x0003,0x0000,0x6305,
+        0x0000,0x0000,0x0001,0x0002,0x000a,0x6305,0x630a,0x630a,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x630a,0x0000,0x0003,0x0000,0x0003,0x0000,0x0000,0x0001,0x6104,0x000a,0x6304,
+        0x0000,0x0000,0x0003,0x0000,0x0000,0x0000,0x0002,0x0000,0x000a,0x630a,0x630a,0x6303,
+        0x0001,0x0000,0x0001,0x6302,0x000a,0x0000,0x6302,0x9e03,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x000a,0x0000,0x6302,0x9e03,0x0001,0x0001,0x0000,0x0000,0x6302,0x000a,0x0000,
+        0x0000,0x630a,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,
+        0x6304,0x6304,0x0000,0x0000,0x0000,0x0000,0x6305,0x6305,0x0000,0x6305,0x0001,0x6305,
+        0x0000,0x6305,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x6304,0x6304,0x0000,0x6304,0x6304,0x6304,0x0000,0x6304,0x0000,0x0002,0x0003,0x630a,
+        0x0002,0x0000,0x000a,0x0002,0x000a,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x5f06,0x5f08,0x0000,0x0006,0x0004,0x6108,
+        0x0000,0x6306,0x0000,0x5f0a,0xa003,0x6106,0x0002,0x0000,0x6108,0x6306,0x6306,0x0000,
+        0x0000,0x6106,0x0000,0x6108,0x6108,0x0000,0x0000,0x0000,0x0000,0x5f06,0x5f08,0x6106,
+        0x0002,0x0000,0x610a,0x6306,0x6306,0x0000,0x0006,0x0000,0x6106,0x0000,0x0000,0x610a,
+        0x6306,0x6306,0x6306,0x6106,0x6108,0x0000,0x6108,0x6108,0x6106,0x0000,0x6306,0x0000,
+        0x0000,0x6106,0x0000,0x6108,0x5f04,0x0000,0x0000,0x0000,0x0000,0x6106,0xa003,0x0000,
+        0x5f02,0x0001,0x6308,0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,0x0000,0x6106,0x0000,
+        0x0000,0x0000,0x0000,0x0002,0xa00a,0x6108,0x0002,0x0000,0x6108,0x5f02,0xa00a,0x0000,
+        0xa008,0x0000,0x6108,0x0000,0x0000,0x6108,0xa008,0x9e05,0x6108,0x610a,0x610a,0x0000,
+        0x610a,0x610a,0x6108,0x0000,0x610a,0x0000,0xa007,0x0000,0x0007,0x0000,0x0000,0x0007,
+        0xa007,0x9e04,0x6304,0x0000,0x0000,0x9e03,0x0000,0x0000,0x0000,0x9e02,0x0000,0x9e07,
+        0x0007,0x9e03,0x6303,0x0007,0x0000,0x0007,0x6302,0x9e07,0x0000,0x6108,0x000a,0x0000,
+        0x6108,0x9e04,0x6308,0x0000,0x000a,0x0000,0x6108,0x9e03,0x6308,0x9e02,0x0000,0x6308,
+        0x6108,0x9e07,0x0000,0x0000,0x610a,0x0000,0x6108,0x610a,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6303,0x0000,0x6108,0x0004,0x0000,0x0000,0x0000,0x0000,0x6303,0x6303,0x0000,
+        0x0002,0x0001,0x630a,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x0000,
+        0x0000,0x0000,0x0000,0x6303,0x6303,0x0000,0x6108,0x9e04,0x630a,0x0000,0x0001,0x0000,
+        0x6303,0x6303,0x6303,0x0002,0x0000,0x630a,0x0001,0x0001,0x0000,0x0000,0x6303,0x0000,
+        0x6308,0x6308,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6307,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x6307,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x5f06,0x0006,0x6106,
+        0x0002,0x0000,0x6108,0x6306,0x6306,0x0000,0x5f0a,0x0000,0x610a,0x0000,0x0000,0x610a,
+        0x6306,0x6306,0x6306,0x6106,0x6106,0x0000,0x6108,0x6108,0x6106,0x0000,0x6306,0x0000,
+        0x5f06,0x0000,0x6106,0x0000,0x0000,0x0006,0x6306,0x6306,0x6306,0x0000,0x0000,0x9e06,
+        0x0000,0x0000,0x0000,0x6306,0x0000,0x6306,0x6106,0x9e06,0x6303,0x0006,0x0000,0x6106,
+        0x6306,0x6306,0x0000,0x6108,0x0006,0x0000,0x6108,0x0004,0x6308,0x0000,0x6306,0x0000,
+        0x5f0a,0x9e06,0x6308,0x9e06,0x0000,0x6308,0x6306,0x6306,0x0000,0x0000,0x6106,0x0000,
+        0x6108,0x6108,0x0000,0x0000,0x0000,0x0000,0xa005,0x0000,0x0005,0x0000,0x0000,0x0005,
+        0xa005,0x9e04,0x6304,0x0000,0x0000,0x9e03,0x0000,0x0000,0x0000,0x9e02,0x0000,0x9e05,
+        0x0005,0x9e03,0x6303,0x0005,0x0000,0x0005,0x6302,0x9e05,0x0000,0x0000,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,
+        0x6108,0x000a,0x6308,0x6108,0x0000,0x6308,0x6102,0x000a,0x0000,0x9e02,0x0000,0x6308,
+        0x0000,0x0000,0x6308,0x9e02,0x9e08,0x6308,0x6102,0x000a,0x0000,0x6108,0x000a,0x6308,
+        0x0000,0x000a,0x0000,0x6303,0x6303,0x0000,0x6108,0x0004,0x630a,0x0000,0x0001,0x0000,
+        0x6303,0x6303,0x6303,0x9e02,0x0000,0x630a,0x0001,0x0001,0x0000,0x0000,0x6303,0x0000,
+        0x6308,0x6308,0x0000,0x0000,0x0000,0x0000,0x6303,0x6303,0x6303,0x6108,0x0000,0x630a,
+        0x0001,0x0001,0x0000,0x6303,0x0000,0x6303,0x0000,0x0000,0x630a,0x0001,0x0000,0x0001,
+        0x6303,0x6303,0x0000,0x6308,0x6308,0x6308,0x0000,0x0001,0x0000,0x0000,0x6303,0x0000,
+        0x6102,0x0004,0x0000,0x0000,0x0000,0x0000,0x6303,0x6303,0x0000,0x9e02,0x0001,0x6308,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6106,0x0000,0x610a,0x5f04,0x0000,0x0000,0x0000,0x0000,0x6106,0xa003,0x0000,
+        0x5f02,0x0001,0x6106,0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,0x0000,0x630a,0x0000,
+        0x0000,0x0000,0x0000,0x610a,0x5f08,0x0000,0x610a,0x9e06,0x610a,0x0000,0x6306,0x0000,
+        0x0006,0x9e06,0x6106,0x0002,0x0000,0x610a,0x6306,0x6306,0x0000,0x0000,0x630a,0x0000,
+        0x630a,0x630a,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6306,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x6306,0x0000,0x6306,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x610a,0x610a,0x0000,
+        0x610a,0x9e04,0x6108,0x0000,0x610a,0x0000,0x0008,0x9e03,0x6108,0x9e02,0x0000,0x6108,
+        0x0008,0x9e05,0x0000,0x0000,0x630a,0x0000,0x630a,0x630a,0x0000,0x0000,0x0000,0x0000,
+        0x610a,0x9e03,0x6104,0x610a,0x0000,0x610a,0x6104,0x9e04,0x0000,0x0008,0x0000,0x0008,
+        0x0000,0x0000,0x0008,0x0008,0x9e08,0x0008,0x630a,0x630a,0x0000,0x630a,0x630a,0x630a,
+        0x0000,0x630a,0x0000,0x0000,0x610a,0x0000,0x6108,0x9e04,0x0000,0x0000,0x0000,0x0000,
+        0x6108,0x9e03,0x0000,0x9e02,0x0001,0x6308,0x0000,0x9e08,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x630a,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6305,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x6305,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,
+        0x6104,0x9e04,0x0000,0x0000,0x0000,0x0000,0x6303,0x6303,0x0000,0x0002,0x0001,0x630a,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0006,0xa005,0x6106,0x0002,0x0000,0x0006,0x6306,0x6306,0x0000,
+        0x0006,0x0000,0x6106,0x0000,0x0000,0x0006,0x6306,0x6306,0x6306,0x6103,0x0005,0x0000,
+        0x0006,0x0005,0x610a,0x0000,0x6306,0x0000,0xa002,0x0000,0x6106,0x0000,0x0000,0x0006,
+        0x6306,0x0001,0x6306,0x0000,0x0000,0x6106,0x0000,0x0000,0x0000,0x6306,0x0000,0x6306,
+        0x5f02,0x0001,0x6303,0x0002,0x0000,0x610a,0x6306,0x0001,0x0000,0x6106,0x6106,0x0000,
+        0x0006,0x0004,0x6106,0x0000,0x6306,0x0000,0x6106,0x9e06,0x6106,0x9e06,0x0000,0x6106,
+        0x6306,0x6306,0x0000,0x0000,0x6106,0x0000,0x6107,0x6107,0x0000,0x0000,0x0000,0x0000,
+        0xa004,0x0000,0x0004,0x0000,0x0000,0x0004,0xa004,0x9e04,0x6304,0x0000,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0002,0x9e03,0x6303,0x0002,0x0000,0x0005,
+        0x6302,0x9e05,0x0000,0x0000,0x0000,0x9e03,0x0000,0x0000,0x0000,0x9e02,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x9e02,0x0000,0x6303,
+        0x0000,0x0000,0x0007,0x6302,0x0001,0x0001,0x0004,0x9e03,0x0004,0x0004,0x0000,0x0004,
+        0x0004,0x9e04,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,
+        0x0002,0x000a,0x0000,0x0002,0x000a,0x0007,0x0000,0x000a,0x0000,0x6303,0x6303,0x0000,
+        0x0002,0x9e04,0x630a,0x0000,0x0001,0x0000,0x6303,0x6303,0x6303,0x0002,0x0000,0x630a,
+        0x0001,0x0001,0x0000,0x0000,0x6303,0x0000,0x6107,0x0005,0x0000,0x0000,0x0000,0x0000,
+        0x6303,0x0001,0x6303,0x0002,0x0000,0x630a,0x0001,0x0000,0x0000,0x6303,0x0000,0x6303,
+        0x0000,0x0000,0x630a,0x0001,0x0000,0x0001,0x6303,0x0001,0x0000,0x0002,0x0001,0x630a,
+        0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x6307,0x6307,0x0000,0x0000,0x0000,0x0000,
+        0x6303,0x6303,0x0000,0x6307,0x0001,0x6307,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6307,0x0000,0x0000,0x0000,0x0000,0x0006,0x0000,0x6106,0x0000,0x0000,0x0006,
+        0x6306,0x6306,0x6306,0x0000,0x0000,0x9e06,0x0000,0x0000,0x0000,0x6306,0x0000,0x6306,
+        0x6103,0x0005,0x6303,0x0006,0x0000,0x0006,0x6306,0x6306,0x0000,0x0000,0x0000,0x6106,
+        0x0000,0x0000,0x0000,0x6306,0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6306,0x9e06,0x0000,0x6303,0x0000,0x0000,0x0006,0x6306,0x0001,0x0001,
+        0x0006,0x0006,0x6106,0x0004,0x0000,0x0006,0x6306,0x6306,0x0000,0x9e06,0x0000,0x9e06,
+        0x0000,0x0000,0x9e06,0x6306,0x6306,0x6306,0x6103,0x0006,0x0000,0x0006,0x0006,0x0006,
+        0x0000,0x6306,0x0000,0x0000,0x0000,0x9e03,0x0000,0x0000,0x0000,0x9e02,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0005,0x0000,0x6303,
+        0x0000,0x0000,0x0005,0x6302,0x9e05,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0004,0x0000,0x0004,
+        0x0000,0x0000,0x0004,0x0004,0x9e04,0x6304,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0001,0x0002,0x000a,0x6303,0x0002,0x0000,0x000a,0x6302,0x000a,0x0000,
+        0x6303,0x6303,0x6303,0x0002,0x0000,0x630a,0x0001,0x0001,0x0000,0x6303,0x0000,0x6303,
+        0x0000,0x0000,0x630a,0x0001,0x0000,0x0001,0x6303,0x6303,0x0000,0x0002,0x0005,0x630a,
+        0x0000,0x0001,0x0000,0x6303,0x0000,0x6303,0x0000,0x0000,0x630a,0x0001,0x0000,0x0001,
+        0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x6303,0x0001,0x6303,
+        0x0002,0x0000,0x000a,0x0001,0x0000,0x0000,0x6303,0x6303,0x0000,0x0002,0x0004,0x630a,
+        0x0000,0x0001,0x0000,0x6303,0x6303,0x6303,0x9e02,0x0000,0x000a,0x0001,0x0001,0x0000,
+        0x0000,0x6303,0x0000,0x0002,0x000a,0x0000,0x0000,0x0000,0x0000,0x6106,0xa005,0x0000,
+        0x0006,0x9e06,0x6106,0x0000,0x6306,0x0000,0x6106,0x9e06,0x6106,0x9e06,0x0000,0x6106,
+        0x6306,0x6306,0x0000,0x0000,0x630a,0x0000,0x630a,0x630a,0x0000,0x0000,0x0000,0x0000,
+        0x5f02,0x0001,0x6106,0x0002,0x0000,0x610a,0x6306,0x0001,0x0000,0x9e06,0x0000,0x6106,
+        0x0000,0x0000,0x0006,0x6306,0x0001,0x6306,0x630a,0x0001,0x0000,0x630a,0x0001,0x630a,
+        0x0000,0x0000,0x0000,0x0000,0x6306,0x0000,0x6306,0x6306,0x0000,0x0000,0x0000,0x0000,
+        0x6306,0x6306,0x0000,0x6306,0x0001,0x6306,0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,0x0004,0x9e03,0x6104,0x0004,0x0000,0x0004,
+        0x6104,0x9e04,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,
+        0x630a,0x630a,0x0000,0x630a,0x630a,0x630a,0x0000,0x630a,0x0000,0x9e02,0x0000,0x6104,
+        0x0000,0x0000,0x0004,0x9e02,0x0001,0x6304,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0001,0x630a,0x0001,0x6303,0x630a,0x0000,0x000a,0x6302,0x0001,0x0000,
+        0x0004,0x9e03,0x0000,0x0004,0x9e04,0x0004,0x0000,0x9e04,0x0000,0x0001,0x0001,0x0000,
+        0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x630a,0x0000,0x630a,0x000a,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x6305,0x6305,0x0000,0x0000,0x0000,0x0000,
+        0x6303,0x6303,0x0000,0x6305,0x0001,0x6305,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6305,0x0000,0x0000,0x0000,0x0000,0x6303,0x0001,0x0000,0x0002,0x0001,0x630a,
+        0x0000,0x0000,0x0000,0x6303,0x0001,0x6303,0x0002,0x0000,0x000a,0x0001,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x630a,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x630a,0x0000,0x630a,0x630a,0x0000,0x0000,0x0000,0x0000,0x630a,0x630a,0x0000,
+        0x630a,0x0001,0x6305,0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,0x0000,0x6306,0x0000,
+        0x0000,0x0000,0x0000,0x630a,0x630a,0x0000,0x630a,0x630a,0x630a,0x0000,0x6306,0x0000,
+        0x630a,0x630a,0x630a,0x630a,0x0000,0x630a,0x6306,0x6306,0x0000,0x0000,0x6306,0x0000,
+        0x6306,0x6306,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x630a,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x630a,0x0000,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x630a,0x630a,0x0000,
+        0x630a,0x630a,0x6305,0x0000,0x630a,0x0000,0x630a,0x630a,0x6305,0x630a,0x0000,0x6305,
+        0x630a,0x630a,0x0000,0x0000,0x630a,0x0000,0x630a,0x630a,0x0000,0x0000,0x0000,0x0000,
+        0x630a,0x630a,0x630a,0x630a,0x0000,0x630a,0x630a,0x630a,0x0000,0x630a,0x0000,0x630a,
+        0x0000,0x0000,0x630a,0x630a,0x630a,0x630a,0x630a,0x630a,0x0000,0x630a,0x630a,0x630a,
+        0x0000,0x630a,0x0000,0x0000,0x630a,0x0000,0x6302,0x630a,0x0000,0x0000,0x0000,0x0000,
+        0x6302,0x630a,0x0000,0x6302,0x0001,0x0001,0x0000,0x630a,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x630a,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x630a,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,
+        0x6304,0x6304,0x0000,0x0000,0x0000,0x0000,0x6303,0x6303,0x0000,0x630a,0x0001,0x630a,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x630a,0x630a,0x0000,0x630a,0x630a,0x6305,0x0000,0x6306,0x0000,
+        0x630a,0x630a,0x6305,0x630a,0x0000,0x6305,0x6306,0x6306,0x0000,0x0000,0x6306,0x0000,
+        0x6306,0x6306,0x0000,0x0000,0x0000,0x0000,0x630a,0x630a,0x630a,0x630a,0x0000,0x630a,
+        0x6306,0x6306,0x0000,0x630a,0x0000,0x630a,0x0000,0x0000,0x630a,0x6306,0x6306,0x6306,
+        0x6306,0x6306,0x0000,0x6306,0x6306,0x6306,0x0000,0x6306,0x0000,0x0000,0x630a,0x0000,
+        0x6302,0x630a,0x0000,0x0000,0x0000,0x0000,0x6302,0x630a,0x0000,0x6302,0x0001,0x0001,
+        0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,
+        0x630a,0x630a,0x6305,0x630a,0x0000,0x6305,0x630a,0x630a,0x0000,0x630a,0x0000,0x6305,
+        0x0000,0x0000,0x6305,0x630a,0x630a,0x6305,0x630a,0x630a,0x0000,0x630a,0x630a,0x6305,
+        0x0000,0x630a,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0001,0x0000,
+        0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x6302,0x630a,0x0000,0x6302,0x630a,0x0001,
+        0x0000,0x630a,0x0000,0x6302,0x630a,0x0001,0x6302,0x0000,0x0001,0x6302,0x000a,0x0000,
+        0x0000,0x630a,0x0000,0x6302,0x000a,0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,
+        0x6304,0x6304,0x0000,0x0000,0x0000,0x0000,0x6303,0x6303,0x0000,0x630a,0x0001,0x6305,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x6303,0x6303,0x0000,0x6304,0x6304,0x6304,0x0000,0x0001,0x0000,0x6303,0x6303,0x6303,
+        0x630a,0x0000,0x000a,0x0001,0x0001,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6303,0x0000,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x630a,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x630a,0x0000,0x630a,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x630a,0x0000,
+        0x630a,0x630a,0x0000,0x0000,0x0000,0x0000,0x630a,0x630a,0x0000,0x630a,0x0001,0x630a,
+        0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x630a,0x0000,0x630a,0x630a,0x0000,0x0000,0x0000,0x0000,
+        0x630a,0x630a,0x0000,0x630a,0x0001,0x6305,0x0000,0x630a,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x630a,0x0000,0x0000,0x0000,0x0000,0x630a,0x630a,0x0000,0x630a,0x630a,0x630a,
+        0x0000,0x630a,0x0000,0x630a,0x630a,0x630a,0x630a,0x0000,0x000a,0x630a,0x000a,0x0000,
+        0x0000,0x630a,0x0000,0x630a,0x000a,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x630a,0x0000,0x0000,0x0000,0x0000,0x0000,0x630a,0x0000,0x6302,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6303,0x0000,0x630a,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0006,0x0000,0x5f04,
+        0x0000,0x0000,0x0006,0x5f04,0x0006,0x6304,0x0000,0x0000,0xa007,0x0000,0x0000,0x0000,
+        0xa007,0x0000,0xa007,0x5f02,0xa006,0x6303,0x0006,0x0000,0x6108,0x6302,0x6106,0x0000,
+        0x0000,0x0000,0x0006,0x0000,0x0000,0x0000,0x0006,0x0000,0x6304,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0xa007,0x0002,0x0000,0x6303,0x0000,0x0000,0x0006,
+        0x6302,0x9e06,0x0001,0x5f08,0x0006,0x6308,0x0006,0x0000,0x6308,0x6106,0x6106,0x0000,
+        0xa007,0x0000,0x6308,0x0000,0x0000,0x6308,0xa007,0x9e06,0x6308,0x6106,0x6106,0x0000,
+        0x6106,0x6106,0x6308,0x0000,0x6106,0x0000,0x0000,0x0000,0x0004,0x0000,0x0000,0x0000,
+        0xa002,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9e05,
+        0x0002,0x0000,0x6303,0x0000,0x0000,0x0009,0x6302,0x0001,0x0001,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,
+        0xa002,0x0000,0x6308,0x0000,0x0000,0x6308,0x6102,0x0001,0x6304,0x0000,0x0000,0x6308,
+        0x0000,0x0000,0x0000,0x9e02,0x0000,0x6308,0x6102,0x0001,0x6303,0x9e02,0x0000,0x6308,
+        0x6302,0x0001,0x0000,0x0002,0x0003,0x6103,0x0002,0x0000,0x6105,0x6309,0x6309,0x0000,
+        0x0007,0x0000,0x0007,0x0000,0x0000,0x0007,0x6309,0x6309,0x6309,0x6308,0x6308,0x0000,
+        0x6308,0x6308,0x6308,0x0000,0x6308,0x0000,0x0002,0x0000,0x6103,0x0000,0x0000,0x0004,
+        0x6309,0x6309,0x6304,0x0000,0x0000,0x0007,0x0000,0x0000,0x0000,0x6309,0x0000,0x6309,
+        0x6308,0x6308,0x6303,0x6308,0x0000,0x6308,0x6302,0x6308,0x0000,0x6307,0x6307,0x0000,
+        0x6307,0x6307,0x6307,0x0000,0x6307,0x0000,0x6307,0x6307,0x6307,0x6307,0x0000,0x6307,
+        0x6307,0x6307,0x0000,0x0000,0x6307,0x0000,0x6307,0x6307,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x5f04,0x0000,0x0000,0x0000,0x5f04,0x0000,0x6304,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x5f02,0x0000,0x6303,0x0000,0x0000,0x6108,
+        0x6302,0x6106,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,
+        0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,0x0004,0x0000,0x6308,0x0000,0x0000,0x6308,
+        0x5f04,0x9e06,0x6304,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,
+        0x6102,0x0006,0x6303,0x6108,0x0000,0x6308,0x6302,0x6106,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x0000,0x0000,0x0000,0x9e02,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x6102,0x0000,0x6303,
+        0x0000,0x0000,0x6308,0x6302,0x0001,0x0001,0x0004,0x0000,0x6104,0x0000,0x0000,0x0004,
+        0x6309,0x6309,0x6304,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,
+        0x6308,0x6308,0x6303,0x6308,0x0000,0x6308,0x6302,0x6308,0x0000,0x0000,0x0000,0x6104,
+        0x0000,0x0000,0x0000,0x6309,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x6308,0x0000,0x6303,0x0000,0x0000,0x6308,0x6302,0x6308,0x0001,
+        0x0004,0x0004,0x6308,0x0004,0x0000,0x6308,0x6309,0x6309,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,0x6308,0x6308,0x0000,0x6308,0x6308,0x6308,
+        0x0000,0x6308,0x0000,0x0006,0x0006,0x6105,0x0006,0x0000,0x6105,0x6106,0x6106,0x0000,
+        0x0006,0x0000,0x6105,0x0000,0x0000,0x6105,0x6106,0x6106,0x6106,0x6106,0x6106,0x0000,
+        0x6106,0x6106,0x6106,0x0000,0x6106,0x0000,0x0002,0x0000,0x0006,0x0000,0x0000,0x0006,
+        0x0006,0x9e06,0x6304,0x0000,0x0000,0x0006,0x0000,0x0000,0x0000,0x0006,0x0000,0x0006,
+        0x0002,0x9e06,0x6303,0xa006,0x0000,0x0006,0x6302,0x9e06,0x0000,0x6306,0x6306,0x0000,
+        0x6306,0x6306,0x6306,0x0000,0x6306,0x0000,0x6306,0x6306,0x6306,0x6306,0x0000,0x6306,
+        0x6306,0x6306,0x0000,0x0000,0x6306,0x0000,0x6306,0x6306,0x0000,0x0000,0x0000,0x0000,
+        0xa002,0x0000,0x0003,0x0000,0x0000,0x0009,0x0002,0x0001,0x6304,0x0000,0x0000,0x0008,
+        0x0000,0x0000,0x0000,0x9e02,0x0000,0x0008,0x0002,0x0001,0x6303,0x9e02,0x0000,0x0009,
+        0x6302,0x0001,0x0000,0x0000,0x0000,0x0003,0x0000,0x0000,0x0000,0x0002,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0008,0x0002,0x0000,0x6303,
+        0x0000,0x0000,0x0009,0x6302,0x0001,0x0001,0xa002,0x0001,0x6308,0x9e02,0x0000,0x6308,
+        0x6102,0x0001,0x0000,0x9e02,0x0000,0x6308,0x0000,0x0000,0x6308,0x9e02,0x0001,0x6308,
+        0x6102,0x0001,0x0000,0x9e02,0x0001,0x6308,0x0000,0x0000,0x0000,0x6305,0x6305,0x0000,
+        0x6305,0x6305,0x6305,0x0000,0x6305,0x0000,0x6305,0x6305,0x6305,0x6305,0x0000,0x6305,
+        0x6305,0x6305,0x0000,0x0000,0x6305,0x0000,0x6305,0x6305,0x0000,0x0000,0x0000,0x0000,
+        0x0002,0x0008,0x6103,0x0002,0x0000,0x0004,0x6309,0x6309,0x0000,0x0002,0x0000,0x0003,
+        0x0000,0x0000,0x0008,0x6309,0x6309,0x6309,0x6308,0x6308,0x0000,0x6308,0x6308,0x6308,
+        0x0000,0x6308,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xa009,0x0000,0x0000,0x0000,
+        0xa009,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9e06,
+        0xa009,0x0000,0x6303,0x0000,0x0000,0x0009,0x6302,0x9e06,0x0001,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,
+        0xa009,0x0000,0xa009,0x0000,0x0000,0xa009,0xa009,0x9e06,0x6304,0x0000,0x0000,0x9e06,
+        0x0000,0x0000,0x0000,0x9e06,0x0000,0x9e06,0x0009,0x9e06,0x6303,0x0009,0x0000,0x0009,
+        0x6302,0x9e06,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,
+        0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9e03,
+        0x0000,0x0000,0x0000,0x9e02,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x9e02,0x0000,0x6303,0x0000,0x0000,0x0009,0x6302,0x0001,0x0001,
+        0x0009,0x0000,0x0009,0x0000,0x0000,0x0009,0x6309,0x6309,0x6304,0x0000,0x0000,0x9e03,
+        0x0000,0x0000,0x0000,0x6309,0x0000,0x6309,0x0009,0x9e03,0x6303,0x0009,0x0000,0x0009,
+        0x6302,0x6309,0x0000,0x0000,0x0000,0x0009,0x0000,0x0000,0x0000,0x6309,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6309,0x9e02,0x0000,0x6303,
+        0x0000,0x0000,0x0009,0x6302,0x0001,0x0001,0x6307,0x6307,0x6307,0x6307,0x0000,0x6307,
+        0x6307,0x6307,0x0000,0x6307,0x0000,0x6307,0x0000,0x0000,0x6307,0x6307,0x6307,0x6307,
+        0x6307,0x6307,0x0000,0x6307,0x6307,0x6307,0x0000,0x6307,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x9e06,0x0000,0x0000,0x0000,0x9e06,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0009,0x0000,0x6303,
+        0x0000,0x0000,0x0009,0x6302,0x9e06,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,
+        0x6302,0x0000,0x0001,0x0000,0x0000,0x9e03,0x0000,0x0000,0x0000,0x6309,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0009,0x0000,0x6303,
+        0x0000,0x0000,0x0009,0x6302,0x6309,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,0x9e02,0x0000,0x9e03,
+        0x0000,0x0000,0x9e04,0x6309,0x6309,0x6304,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0001,0x0009,0x0009,0x6303,0x0009,0x0000,0x0009,0x6302,0x0009,0x0000,
+        0xa009,0x0000,0x0009,0x0000,0x0000,0x0009,0xa009,0x9e06,0x6304,0x0000,0x0000,0x9e06,
+        0x0000,0x0000,0x0000,0x9e06,0x0000,0x9e06,0xa009,0x9e06,0x6303,0xa009,0x0000,0x0009,
+        0x6302,0x9e06,0x0000,0x0000,0x0000,0x0009,0x0000,0x0000,0x0000,0x9e06,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9e06,0x9e06,0x0000,0x6303,
+        0x0000,0x0000,0x0009,0x6302,0x0001,0x0001,0x6306,0x6306,0x6306,0x6306,0x0000,0x6306,
+        0x6306,0x6306,0x0000,0x6306,0x0000,0x6306,0x0000,0x0000,0x6306,0x6306,0x6306,0x6306,
+        0x6306,0x6306,0x0000,0x6306,0x6306,0x6306,0x0000,0x6306,0x0000,0x0000,0x0000,0x9e03,
+        0x0000,0x0000,0x0000,0x9e02,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x9e02,0x0000,0x6303,0x0000,0x0000,0x0009,0x6302,0x0001,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,
+        0x6302,0x0000,0x0001,0x9e02,0x0000,0x9e03,0x0000,0x0000,0x9e04,0x9e02,0x0001,0x6304,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x9e02,0x0001,0x6303,
+        0x9e02,0x0000,0x0009,0x6302,0x0001,0x0000,0x6305,0x6305,0x6305,0x6305,0x0000,0x6305,
+        0x6305,0x6305,0x0000,0x6305,0x0000,0x6305,0x0000,0x0000,0x6305,0x6305,0x6305,0x6305,
+        0x6305,0x6305,0x0000,0x6305,0x6305,0x6305,0x0000,0x6305,0x0000,0x9e02,0x0000,0x0009,
+        0x0000,0x0000,0x0009,0x6309,0x0001,0x6304,0x0000,0x0000,0x0009,0x0000,0x0000,0x0000,
+        0x6309,0x0000,0x0009,0x9e02,0x0001,0x6303,0x9e02,0x0000,0x0009,0x6302,0x0001,0x0000,
+        0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x5f02,0xa006,0x6305,0x0002,0x0000,0x6305,0x6106,0x6106,0x0000,
+        0xa007,0x0000,0x6305,0x0000,0x0000,0x6305,0x0007,0x9e06,0x6305,0x6306,0x6306,0x0000,
+        0x6306,0x6306,0x6306,0x0000,0x6306,0x0000,0x0006,0x0000,0x6104,0x0000,0x0000,0x0006,
+        0x6106,0x6106,0x6304,0x0000,0x0000,0x0007,0x0000,0x0000,0x0000,0x0007,0x0000,0x0007,
+        0x6306,0x6306,0x6306,0x6306,0x0000,0x6306,0x6306,0x6306,0x0000,0x6302,0x6106,0x0000,
+        0x6302,0x9e06,0x0001,0x0000,0x6106,0x0000,0x6302,0x9e06,0x0001,0x6302,0x0000,0x0001,
+        0x6302,0x9e06,0x0000,0x0000,0x6306,0x0000,0x6306,0x6306,0x0000,0x0000,0x0000,0x0000,
+        0x0002,0x0000,0x6305,0x0000,0x0000,0x6305,0x6102,0x0001,0x6304,0x0000,0x0000,0x6305,
+        0x0000,0x0000,0x0000,0x9e02,0x0000,0x6305,0x6102,0x0001,0x6303,0x9e02,0x0000,0x6305,
+        0x6302,0x0001,0x0000,0x0000,0x0000,0x0007,0x0000,0x0000,0x0000,0x9e02,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0007,0x9e02,0x0000,0x6303,
+        0x0000,0x0000,0x9e07,0x6302,0x0001,0x0001,0x6302,0x0001,0x0001,0x6302,0x0000,0x0001,
+        0x6302,0x0001,0x0000,0x6302,0x0000,0x0001,0x0000,0x0000,0x0000,0x6302,0x0001,0x0001,
+        0x6302,0x0001,0x0000,0x6302,0x0001,0x0001,0x0000,0x0000,0x0000,0x6304,0x6304,0x0000,
+        0x6304,0x6304,0x6304,0x0000,0x6304,0x0000,0x0007,0x9e03,0x6305,0x9e02,0x0000,0x6305,
+        0x6309,0x6309,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x6304,0x6304,0x6304,0x6304,0x0000,0x6304,0x6304,0x6304,0x0000,0x0007,0x0000,0x0007,
+        0x0000,0x0000,0x0007,0x6309,0x6309,0x6309,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0001,0x0000,0x0000,0x6304,0x0000,0x6302,0x6304,0x0000,0x0000,0x0000,0x0000,
+        0x6302,0x6307,0x0000,0x6302,0x0001,0x0001,0x0000,0x6307,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0xa004,0x0000,0x6305,0x0000,0x0000,0x6305,
+        0x6104,0x9e06,0x6304,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,
+        0x6306,0x6306,0x6306,0x6306,0x0000,0x6306,0x6306,0x6306,0x0000,0x0000,0x0000,0x9e06,
+        0x0000,0x0000,0x0000,0x9e06,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x6306,0x0000,0x6306,0x0000,0x0000,0x6306,0x6306,0x6306,0x0001,
+        0x6302,0x9e06,0x0001,0x6302,0x0000,0x0001,0x6302,0x9e06,0x0000,0x0001,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,0x6306,0x6306,0x0000,0x6306,0x6306,0x0001,
+        0x0000,0x6306,0x0000,0x0000,0x0000,0x6305,0x0000,0x0000,0x0000,0x9e02,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x9e02,0x0000,0x6303,
+        0x0000,0x0000,0x6305,0x6302,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x6302,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x6302,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0000,0x6302,0x0001,0x0001,0x6302,0x0000,0x0001,0x6302,0x0001,0x0000,
+        0x6304,0x6304,0x6304,0x6304,0x0000,0x6304,0x6304,0x6304,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0001,0x0000,0x6304,0x0000,0x6304,0x0000,0x0000,0x6304,0x6304,0x6304,0x6304,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0001,
+        0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,0x6302,0x6304,0x0000,0x6302,0x6304,0x0001,
+        0x0000,0x6304,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,
+        0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x6106,0x6106,0x0000,
+        0x6106,0x9e06,0x6305,0x0000,0x6106,0x0000,0x6105,0x9e06,0x6305,0x0002,0x0000,0x6305,
+        0x6106,0x6106,0x0000,0x0000,0x6306,0x0000,0x6306,0x6306,0x0000,0x0000,0x0000,0x0000,
+        0x0006,0x0006,0x6104,0x0006,0x0000,0x0006,0x6106,0x6106,0x0000,0x0006,0x0000,0x0006,
+        0x0000,0x0000,0x0006,0x0006,0x0006,0x0006,0x6306,0x6306,0x0000,0x6306,0x6306,0x6306,
+        0x0000,0x6306,0x0000,0x0000,0x6306,0x0000,0x6306,0x6306,0x0000,0x0000,0x0000,0x0000,
+        0x6306,0x6306,0x0000,0x6306,0x0001,0x0001,0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,0x0002,0x0001,0x6305,0x9e02,0x0000,0x6305,
+        0x6102,0x0001,0x0000,0x0002,0x0000,0x6305,0x0000,0x0000,0x6305,0x0002,0x0001,0x6305,
+        0x6102,0x0001,0x0000,0x9e02,0x0001,0x6305,0x0000,0x0000,0x0000,0x0002,0x0000,0x0003,
+        0x0000,0x0000,0x0009,0x0002,0x0001,0x6304,0x0000,0x0000,0x0003,0x0000,0x0000,0x0000,
+        0x0002,0x0000,0x0009,0x0002,0x0001,0x6303,0x9e02,0x0000,0x0009,0x6302,0x0001,0x0000,
+        0x6302,0x0001,0x0000,0x6302,0x0001,0x0001,0x0000,0x0000,0x0000,0x6302,0x0001,0x0001,
+        0x6302,0x0000,0x0001,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,0x6302,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x6304,0x6304,0x0000,0x0000,0x0000,0x0000,
+        0x6305,0x6305,0x0000,0x6305,0x0001,0x6305,0x0000,0x6305,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x6304,0x6304,0x0000,0x6304,0x6304,0x6304,
+        0x0000,0x6304,0x0000,0x0002,0x0003,0x0003,0x0002,0x0000,0x0009,0x6309,0x0009,0x0000,
+        0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x5f08,0x0000,0x0000,0x0000,0x0008,0x0000,0x6304,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x9e06,0xa008,0x0000,0x6303,0x0000,0x0000,0x9e06,
+        0x6302,0x9e06,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,
+        0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,0x5f08,0x0000,0x6308,0x0000,0x0000,0x6308,
+        0x5f08,0x9e06,0x6304,0x0000,0x0000,0x6308,0x0000,0x0000,0x0000,0x9e06,0x0000,0x6308,
+        0x6108,0x9e06,0x6303,0x9e06,0x0000,0x6308,0x6302,0x9e06,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x0000,0x0000,0x0000,0x9e02,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x9e02,0x0000,0x6303,
+        0x0000,0x0000,0x0001,0x6302,0x0001,0x0001,0x0008,0x0000,0x6108,0x0000,0x0000,0x6108,
+        0x0008,0x0008,0x6304,0x0000,0x0000,0x9e03,0x0000,0x0000,0x0000,0x9e02,0x0000,0x9e05,
+        0x6308,0x6308,0x6303,0x6308,0x0000,0x6308,0x6302,0x6308,0x0000,0x0000,0x0000,0x0008,
+        0x0000,0x0000,0x0000,0x0008,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x9e07,0x6308,0x0000,0x6303,0x0000,0x0000,0x6308,0x6302,0x6308,0x0001,
+        0x6307,0x6307,0x6307,0x6307,0x0000,0x6307,0x6307,0x6307,0x0000,0x6307,0x0000,0x6307,
+        0x0000,0x0000,0x6307,0x6307,0x6307,0x6307,0x6307,0x6307,0x0000,0x6307,0x6307,0x6307,
+        0x0000,0x6307,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,
+        0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,
+        0x0000,0x0000,0x0000,0x9e06,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x6108,0x0000,0x6303,0x0000,0x0000,0x6308,0x6302,0x9e06,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,0x0000,0x0000,0x9e03,
+        0x0000,0x0000,0x0000,0x9e02,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x6308,0x0000,0x6303,0x0000,0x0000,0x6308,0x6302,0x6308,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,
+        0x6302,0x0000,0x0001,0x9e02,0x0000,0x6308,0x0000,0x0000,0x6308,0x9e02,0x9e04,0x6304,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x6308,0x6308,0x6303,
+        0x6308,0x0000,0x0008,0x6302,0x0008,0x0000,0xa008,0x0000,0x5f08,0x0000,0x0000,0x9e06,
+        0x5f08,0x9e06,0x6304,0x0000,0x0000,0x0008,0x0000,0x0000,0x0000,0x0008,0x0000,0x0008,
+        0xa008,0x9e06,0x6303,0x9e06,0x0000,0x9e06,0x6302,0x9e06,0x0000,0x0000,0x0000,0x0008,
+        0x0000,0x0000,0x0000,0x0008,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0008,0xa008,0x0000,0x6303,0x0000,0x0000,0x9e06,0x6302,0x9e06,0x0001,
+        0x6306,0x6306,0x6306,0x6306,0x0000,0x6306,0x6306,0x6306,0x0000,0x6306,0x0000,0x6306,
+        0x0000,0x0000,0x6306,0x6306,0x6306,0x6306,0x6306,0x6306,0x0000,0x6306,0x6306,0x6306,
+        0x0000,0x6306,0x0000,0x0000,0x0000,0x9e03,0x0000,0x0000,0x0000,0x9e02,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0008,0x9e02,0x0000,0x6303,
+        0x0000,0x0000,0x0001,0x6302,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,0x9e02,0x0000,0x6308,
+        0x0000,0x0000,0x0001,0x9e02,0x0001,0x6304,0x0000,0x0000,0x6308,0x0000,0x0000,0x0000,
+        0x9e02,0x0000,0x0008,0x9e02,0x0001,0x6303,0x0001,0x0000,0x0001,0x6302,0x0001,0x0000,
+        0x6305,0x6305,0x6305,0x6305,0x0000,0x6305,0x6305,0x6305,0x0000,0x6305,0x0000,0x6305,
+        0x0000,0x0000,0x6305,0x6305,0x6305,0x6305,0x6305,0x6305,0x0000,0x6305,0x6305,0x6305,
+        0x0000,0x6305,0x0000,0x0008,0x0000,0x0008,0x0000,0x0000,0x0008,0x0008,0x0008,0x6304,
+        0x0000,0x0000,0x0008,0x0000,0x0000,0x0000,0x0008,0x0000,0x0008,0x6308,0x6308,0x6303,
+        0x6308,0x0000,0x0008,0x6302,0x0008,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,
+        0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,0x0001,
+        0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,0x0001,
+        0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0001,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,
+        0x0001,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,0x0001,
+        0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0001,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,
+        0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0001,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,
+        0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x5f02,0x0000,0x6305,0x0000,0x0000,0x6305,
+        0x6102,0x0006,0x6304,0x0000,0x0000,0x6305,0x0000,0x0000,0x0000,0x0007,0x0000,0x6305,
+        0x6306,0x6306,0x6306,0x6306,0x0000,0x6306,0x6306,0x6306,0x0000,0x0000,0x0000,0x6104,
+        0x0000,0x0000,0x0000,0x6104,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0007,0x6306,0x0000,0x6306,0x0000,0x0000,0x6306,0x6306,0x6306,0x0001,
+        0x6302,0x6106,0x0001,0x6302,0x0000,0x0001,0x6302,0x6106,0x0000,0x6302,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x6302,0x9e06,0x0001,0x6306,0x6306,0x0000,0x6306,0x6306,0x0001,
+        0x0000,0x6306,0x0000,0x0000,0x0000,0x6305,0x0000,0x0000,0x0000,0x6102,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6305,0x9e02,0x0000,0x6303,
+        0x0000,0x0000,0x0001,0x6302,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,0x6302,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x6302,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x6302,0x0000,0x0001,0x6302,0x0001,0x0001,0x0001,0x0000,0x0000,0x6302,0x0001,0x0000,
+        0x6304,0x6304,0x6304,0x6304,0x0000,0x6304,0x6304,0x6304,0x0000,0x0007,0x0000,0x6305,
+        0x0000,0x0000,0x6305,0x0007,0x0007,0x6305,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0001,0x0000,0x6304,0x0000,0x6304,0x0000,0x0000,0x6304,0x6304,0x6304,0x6304,
+        0x0000,0x0000,0x0007,0x0000,0x0000,0x0000,0x0007,0x0000,0x0007,0x0001,0x0000,0x0001,
+        0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,0x6302,0x6304,0x0000,0x6302,0x6304,0x0001,
+        0x0000,0x6304,0x0000,0x6302,0x6307,0x0001,0x6302,0x0000,0x0001,0x6302,0x0007,0x0000,
+        0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6305,
+        0x0000,0x0000,0x0000,0x6104,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x6306,0x0000,0x6306,0x0000,0x0000,0x6306,0x6306,0x6306,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6306,0x0000,0x0000,0x0000,
+        0x6306,0x0000,0x0001,0x6302,0x0000,0x0001,0x0000,0x0000,0x0000,0x6302,0x9e06,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x6306,0x6306,0x0001,
+        0x6306,0x0000,0x0001,0x6306,0x0006,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0002,0x0001,0x0001,0x6304,0x0000,0x6304,0x0000,0x0000,0x6304,0x6304,0x6304,0x6304,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0001,
+        0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,
+        0x6304,0x0000,0x0004,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x6302,0x6304,0x0001,
+        0x6302,0x0000,0x0001,0x6302,0x0004,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0001,0x0001,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,
+        0x6106,0x6106,0x6305,0x6106,0x0000,0x6305,0x6106,0x6106,0x0000,0x6105,0x0000,0x6305,
+        0x0000,0x0000,0x6305,0x6105,0x0006,0x6305,0x6306,0x6306,0x0000,0x6306,0x6306,0x6306,
+        0x0000,0x6306,0x0000,0x0006,0x0000,0x6104,0x0000,0x0000,0x0006,0x6104,0x0006,0x6304,
+        0x0000,0x0000,0x0006,0x0000,0x0000,0x0000,0x0006,0x0000,0x0006,0x6306,0x6306,0x6306,
+        0x6306,0x0000,0x0006,0x6306,0x0006,0x0000,0x6306,0x6306,0x0000,0x6306,0x6306,0x0001,
+        0x0000,0x6306,0x0000,0x6306,0x6306,0x0001,0x6306,0x0000,0x0001,0x6306,0x0006,0x0000,
+        0x0000,0x6306,0x0000,0x6306,0x0006,0x0000,0x0000,0x0000,0x0000,0x9e02,0x0000,0x6305,
+        0x0000,0x0000,0x0001,0x6102,0x0001,0x6304,0x0000,0x0000,0x6305,0x0000,0x0000,0x0000,
+        0x0002,0x0000,0x0005,0x9e02,0x0001,0x6303,0x0001,0x0000,0x0001,0x6302,0x0001,0x0000,
+        0x0000,0x0000,0x0003,0x0000,0x0000,0x0000,0x0002,0x0000,0x0004,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x9e02,0x0000,0x0003,0x0000,0x0000,0x0001,
+        0x0002,0x0001,0x0001,0x6302,0x0001,0x0001,0x0001,0x0000,0x0000,0x6302,0x0001,0x0000,
+        0x6302,0x0000,0x0001,0x0000,0x0000,0x0000,0x0002,0x0001,0x0001,0x6302,0x0001,0x0000,
+        0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x6304,0x6304,0x0000,0x6304,0x6304,0x6304,
+        0x0000,0x6304,0x0000,0x6305,0x6305,0x6305,0x6305,0x0000,0x0005,0x6305,0x0005,0x0000,
+        0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x6304,0x6304,0x6304,
+        0x6304,0x0000,0x0004,0x6304,0x0004,0x0000,0x0002,0x0000,0x0003,0x0000,0x0000,0x0001,
+        0x0002,0x0001,0x0001,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,
+        0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,
+        0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0006,0x0006,0x6103,0x0002,0x0000,0x0006,0x6306,0x6306,0x0000,
+        0xa007,0x0000,0x0007,0x0000,0x0000,0x0007,0x6306,0x6306,0x6306,0x6106,0x6106,0x0000,
+        0x0006,0x0006,0x6108,0x0000,0x6306,0x0000,0x0006,0x0000,0x6103,0x0000,0x0000,0x0006,
+        0x6306,0x6306,0x6306,0x0000,0x0000,0x0007,0x0000,0x0000,0x0000,0x6306,0x0000,0x6306,
+        0x6106,0x9e06,0x6303,0x0006,0x0000,0x0006,0x6306,0x6306,0x0000,0x6106,0x6106,0x0000,
+        0x0006,0x9e06,0x6308,0x0000,0x6306,0x0000,0xa007,0x9e06,0x6308,0x9e06,0x0000,0x6308,
+        0x6306,0x6306,0x0000,0x0000,0x6106,0x0000,0x6106,0x6106,0x0000,0x0000,0x0000,0x0000,
+        0xa002,0x0000,0x0004,0x0000,0x0000,0x0004,0xa002,0x0001,0x6304,0x0000,0x0000,0x9e03,
+        0x0000,0x0000,0x0000,0x9e02,0x0000,0x9e05,0x0002,0x0001,0x6303,0x0002,0x0000,0x0005,
+        0x6302,0x0001,0x0000,0x0000,0x0000,0x0007,0x0000,0x0000,0x0000,0x9e02,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9e07,0x9e02,0x0000,0x6303,
+        0x0000,0x0000,0x0007,0x6302,0x0001,0x0001,0x0002,0x0001,0x6308,0x0002,0x0000,0x6308,
+        0x6102,0x0001,0x0000,0x9e02,0x0000,0x6308,0x0000,0x0000,0x6308,0x9e02,0x0001,0x6308,
+        0x6102,0x0001,0x0000,0x0002,0x0001,0x6308,0x0000,0x0000,0x0000,0x6303,0x6303,0x0000,
+        0x0002,0x0004,0x6105,0x0000,0x0001,0x0000,0x6303,0x6303,0x6303,0x9e02,0x0000,0x0007,
+        0x0001,0x0001,0x0000,0x0000,0x6303,0x0000,0x6308,0x6308,0x0000,0x0000,0x0000,0x0000,
+        0x6303,0x6303,0x6303,0x0002,0x0000,0x0004,0x0001,0x0001,0x0000,0x6303,0x0000,0x6303,
+        0x0000,0x0000,0x0007,0x0001,0x0000,0x0001,0x6303,0x6303,0x0000,0x6308,0x6308,0x6308,
+        0x0000,0x0001,0x0000,0x0000,0x6303,0x0000,0x6307,0x6307,0x0000,0x0000,0x0000,0x0000,
+        0x6303,0x6303,0x0000,0x6307,0x0001,0x6307,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6307,0x0000,0x0000,0x0000,0x0000,0xa004,0x0000,0x5f04,0x0000,0x0000,0x0004,
+        0x6306,0x6306,0x6306,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,
+        0x6106,0x6106,0x6303,0x0006,0x0000,0x6108,0x6306,0x6306,0x0000,0x0000,0x0000,0x9e06,
+        0x0000,0x0000,0x0000,0x6306,0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x6106,0x0000,0x6303,0x0000,0x0000,0x0006,0x6306,0x6306,0x0001,
+        0x5f04,0x9e06,0x6308,0x0004,0x0000,0x6308,0x6306,0x6306,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,0x6106,0x6106,0x0000,0x6108,0x0006,0x6308,
+        0x0000,0x6306,0x0000,0x0000,0x0000,0x9e03,0x0000,0x0000,0x0000,0x9e02,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x9e02,0x0000,0x6303,
+        0x0000,0x0000,0x0005,0x6302,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x9e02,0x0000,0x6308,
+        0x0000,0x0000,0x6308,0x9e02,0x0001,0x6304,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0001,0x6102,0x0001,0x6303,0x0002,0x0000,0x0008,0x6302,0x0001,0x0000,
+        0x6303,0x6303,0x6303,0x0004,0x0000,0x0004,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x6303,0x6303,0x0000,0x6308,0x6308,0x6308,
+        0x0000,0x0001,0x0000,0x6303,0x0000,0x6303,0x0000,0x0000,0x0004,0x0001,0x0000,0x0001,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,0x6303,0x6303,
+        0x6308,0x0000,0x0008,0x0001,0x0001,0x0000,0x6303,0x6303,0x0000,0x0004,0x0004,0x6308,
+        0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0000,0x6303,0x0000,0x6308,0x0008,0x0000,0x0000,0x0000,0x0000,0x6106,0x6106,0x0000,
+        0x0006,0x9e06,0x6105,0x0000,0x6306,0x0000,0x6106,0x9e06,0x6106,0x0002,0x0000,0x6105,
+        0x6306,0x6306,0x0000,0x0000,0x6106,0x0000,0x6106,0x6106,0x0000,0x0000,0x0000,0x0000,
+        0x0006,0x9e06,0x6103,0x0002,0x0000,0x0006,0x6306,0x6306,0x0000,0x0006,0x0000,0x0006,
+        0x0000,0x0000,0x0006,0x6306,0x6306,0x6306,0x6106,0x9e06,0x0000,0x0006,0x9e06,0x0006,
+        0x0000,0x6306,0x0000,0x0000,0x6306,0x0000,0x6306,0x6306,0x0000,0x0000,0x0000,0x0000,
+        0x6306,0x6306,0x0000,0x6306,0x0001,0x6306,0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,0x0002,0x0001,0x0003,0x0002,0x0000,0x0004,
+        0x0002,0x0001,0x0000,0x9e02,0x0000,0x0008,0x0000,0x0000,0x0008,0x9e02,0x0001,0x0008,
+        0x0002,0x0001,0x0000,0x0002,0x0001,0x0005,0x0000,0x0000,0x0000,0x0002,0x0000,0x0003,
+        0x0000,0x0000,0x0004,0x0002,0x0001,0x6304,0x0000,0x0000,0x0008,0x0000,0x0000,0x0000,
+        0x9e02,0x0000,0x0008,0x0002,0x0001,0x6303,0x0002,0x0000,0x0008,0x6302,0x0001,0x0000,
+        0x0002,0x0001,0x0000,0x0002,0x0001,0x6308,0x0000,0x0000,0x0000,0x9e02,0x0001,0x6308,
+        0x9e02,0x0000,0x0008,0x9e02,0x0001,0x0000,0x0000,0x0000,0x0000,0x0002,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x6305,0x6305,0x0000,0x0000,0x0000,0x0000,
+        0x6303,0x6303,0x0000,0x6305,0x0001,0x6305,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6305,0x0000,0x0000,0x0000,0x0000,0x6303,0x6303,0x0000,0x0002,0x9e04,0x0004,
+        0x0000,0x0001,0x0000,0x6303,0x6303,0x6303,0x0002,0x0000,0x0008,0x0001,0x0001,0x0000,
+        0x0000,0x6303,0x0000,0x6308,0x0008,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0006,0x0000,0x6103,0x0000,0x0000,0x0006,0x6306,0x6306,0x6306,0x0000,0x0000,0x9e06,
+        0x0000,0x0000,0x0000,0x6306,0x0000,0x6306,0x6103,0x9e06,0x6303,0x0006,0x0000,0x0006,
+        0x6306,0x6306,0x0000,0x0000,0x0000,0x6103,0x0000,0x0000,0x0000,0x6306,0x0000,0x6306,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6306,0x0002,0x0000,0x6303,
+        0x0000,0x0000,0x0006,0x6306,0x0001,0x0001,0x6106,0x6106,0x6106,0x0006,0x0000,0x0006,
+        0x6306,0x6306,0x0000,0x9e06,0x0000,0x9e06,0x0000,0x0000,0x9e06,0x6306,0x6306,0x6306,
+        0x6106,0x6106,0x0000,0x0006,0x0006,0x0006,0x0000,0x6306,0x0000,0x0000,0x0000,0x0004,
+        0x0000,0x0000,0x0000,0x9e02,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x0002,0x0000,0x6303,0x0000,0x0000,0x0005,0x6302,0x0001,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,
+        0x6302,0x0000,0x0001,0x9e02,0x0000,0x0004,0x0000,0x0000,0x0004,0x9e02,0x0001,0x6304,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0002,0x0001,0x6303,
+        0x0002,0x0000,0x0007,0x6302,0x0001,0x0000,0x6303,0x6303,0x6303,0x0002,0x0000,0x0004,
+        0x0001,0x0001,0x0000,0x6303,0x0000,0x6303,0x0000,0x0000,0x0007,0x0001,0x0000,0x0001,
+        0x6303,0x6303,0x0000,0x0002,0x0005,0x0005,0x0000,0x0001,0x0000,0x6303,0x0000,0x6303,
+        0x0000,0x0000,0x0004,0x0001,0x0000,0x0001,0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x6303,0x0001,0x6303,0x0002,0x0000,0x0007,0x0001,0x0000,0x0000,
+        0x6303,0x6303,0x0000,0x6307,0x6307,0x6307,0x0000,0x0001,0x0000,0x6303,0x6303,0x6303,
+        0x6307,0x0000,0x0007,0x0001,0x0001,0x0000,0x0000,0x6303,0x0000,0x6307,0x0007,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0004,0x0000,0x0000,0x0000,0x6306,0x0000,0x6306,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x6103,0x0000,0x6303,
+        0x0000,0x0000,0x0006,0x6306,0x6306,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x6306,0x0000,0x0001,0x0004,0x0000,0x0004,
+        0x0000,0x0000,0x0004,0x6306,0x6306,0x6306,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0001,0x6103,0x0006,0x6303,0x0006,0x0000,0x0006,0x6306,0x0006,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,
+        0x6302,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0004,0x0000,0x0000,0x0000,
+        0x9e02,0x0000,0x0004,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,
+        0x0002,0x0000,0x0003,0x0000,0x0000,0x0001,0x0002,0x0001,0x0001,0x6303,0x0000,0x6303,
+        0x0000,0x0000,0x0004,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x6303,0x6303,0x6303,0x0002,0x0000,0x0005,0x0001,0x0001,0x0000,
+        0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x0003,0x0000,0x0000,0x0001,
+        0x0001,0x0000,0x0001,0x6303,0x6303,0x6303,0x0004,0x0000,0x0004,0x0001,0x0001,0x0000,
+        0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x6303,0x0003,0x0000,
+        0x0002,0x0001,0x0001,0x0000,0x0001,0x0000,0x6106,0x9e06,0x6106,0x0006,0x0000,0x0006,
+        0x6306,0x6306,0x0000,0x6106,0x0000,0x6106,0x0000,0x0000,0x0006,0x6306,0x6306,0x6306,
+        0x6106,0x9e06,0x0000,0x0006,0x9e06,0x0006,0x0000,0x6306,0x0000,0x0002,0x0000,0x6103,
+        0x0000,0x0000,0x0006,0x6306,0x0001,0x6306,0x0000,0x0000,0x0006,0x0000,0x0000,0x0000,
+        0x6306,0x0000,0x0006,0x0002,0x0001,0x6303,0x0002,0x0000,0x0006,0x6306,0x0001,0x0000,
+        0x6306,0x6306,0x0000,0x6306,0x6306,0x6306,0x0000,0x6306,0x0000,0x6306,0x6306,0x6306,
+        0x6306,0x0000,0x0006,0x6306,0x0006,0x0000,0x0000,0x6306,0x0000,0x6306,0x0006,0x0000,
+        0x0000,0x0000,0x0000,0x9e02,0x0000,0x0004,0x0000,0x0000,0x0004,0x9e02,0x0001,0x6304,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0002,0x0001,0x6303,
+        0x0002,0x0000,0x0005,0x6302,0x0001,0x0000,0x0000,0x0000,0x0004,0x0000,0x0000,0x0000,
+        0x9e02,0x0000,0x0004,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,
+        0x0002,0x0000,0x0003,0x0000,0x0000,0x0001,0x0002,0x0001,0x0001,0x9e02,0x0001,0x0004,
+        0x9e02,0x0000,0x0004,0x9e02,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,
+        0x0001,0x0001,0x0000,0x0002,0x0001,0x0000,0x0002,0x0001,0x0001,0x0000,0x0000,0x0000,
+        0x6303,0x6303,0x0000,0x6305,0x6305,0x6305,0x0000,0x0001,0x0000,0x6303,0x6303,0x6303,
+        0x6305,0x0000,0x0005,0x0001,0x0001,0x0000,0x0000,0x6303,0x0000,0x6305,0x0005,0x0000,
+        0x0000,0x0000,0x0000,0x6303,0x0001,0x6303,0x0002,0x0000,0x0004,0x0001,0x0000,0x0000,
+        0x6303,0x0000,0x0003,0x0000,0x0000,0x0001,0x0001,0x0000,0x0001,0x6303,0x0001,0x0000,
+        0x0002,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x6106,0x6106,0x0000,
+        0x0002,0x9e06,0x6305,0x0000,0x6306,0x0000,0xa007,0x9e06,0x6305,0x9e06,0x0000,0x6305,
+        0x6306,0x6306,0x0000,0x0000,0x6306,0x0000,0x6306,0x6306,0x0000,0x0000,0x0000,0x0000,
+        0x6106,0x6106,0x6106,0xa006,0x0000,0x0006,0x6306,0x6306,0x0000,0xa007,0x0000,0x0007,
+        0x0000,0x0000,0x0007,0x6306,0x6306,0x6306,0x6306,0x6306,0x0000,0x6306,0x6306,0x6306,
+        0x0000,0x6306,0x0000,0x0000,0x6106,0x0000,0x6302,0x9e06,0x0000,0x0000,0x0000,0x0000,
+        0x6302,0x9e06,0x0000,0x6302,0x0001,0x0001,0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,0x0002,0x0001,0x6305,0x0002,0x0000,0x6305,
+        0x6102,0x0001,0x0000,0x9e02,0x0000,0x6305,0x0000,0x0000,0x6305,0x9e02,0x0001,0x6305,
+        0x6102,0x0001,0x0000,0x0002,0x0001,0x6305,0x0000,0x0000,0x0000,0x9e02,0x0000,0x0007,
+        0x0000,0x0000,0x0007,0x9e02,0x0001,0x6304,0x0000,0x0000,0x0007,0x0000,0x0000,0x0000,
+        0x9e02,0x0000,0x0007,0x9e02,0x0001,0x6303,0x9e02,0x0000,0x0007,0x6302,0x0001,0x0000,
+        0x6302,0x0001,0x0000,0x6302,0x0001,0x0001,0x0000,0x0000,0x0000,0x6302,0x0001,0x0001,
+        0x6302,0x0000,0x0001,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,0x6302,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x6304,0x6304,0x0000,0x0000,0x0000,0x0000,
+        0x6303,0x6303,0x0000,0x9e02,0x0001,0x6305,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x6303,0x6303,0x0000,0x6304,0x6304,0x6304,
+        0x0000,0x0001,0x0000,0x6303,0x6303,0x6303,0x9e02,0x0000,0x0007,0x0001,0x0001,0x0000,
+        0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x6302,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0xa004,0x9e06,0x6305,0xa004,0x0000,0x6305,0x6306,0x6306,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,0x6306,0x6306,0x0000,0x6306,0x6306,0x6306,
+        0x0000,0x6306,0x0000,0x9e06,0x0000,0x9e06,0x0000,0x0000,0x9e06,0x6306,0x6306,0x6306,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x6306,0x6306,0x6306,
+        0x6306,0x0000,0x0006,0x6306,0x0006,0x0000,0x6302,0x9e06,0x0000,0x6302,0x9e06,0x0001,
+        0x0000,0x6306,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,
+        0x0000,0x6306,0x0000,0x6306,0x0006,0x0000,0x0000,0x0000,0x0000,0x9e02,0x0000,0x6305,
+        0x0000,0x0000,0x6305,0x9e02,0x0001,0x6304,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0001,0x9e02,0x0001,0x6303,0x9e02,0x0000,0x0005,0x6302,0x0001,0x0000,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,
+        0x0001,0x0001,0x0000,0x6302,0x0001,0x0001,0x6302,0x0000,0x0001,0x6302,0x0001,0x0000,
+        0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,0x6302,0x0001,0x0000,
+        0x0002,0x0001,0x0001,0x0000,0x0000,0x0000,0x6303,0x6303,0x0000,0x6304,0x6304,0x6304,
+        0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x6303,0x6303,0x6303,
+        0x6304,0x0000,0x0004,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,
+        0x0000,0x6303,0x0000,0x6302,0x0004,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,
+        0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x6106,0x0000,0x6106,0x9e06,0x0000,0x0000,0x0000,0x0000,
+        0x6106,0x9e06,0x0000,0x0002,0x0001,0x6305,0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,0x6106,0x6106,0x0000,0x0006,0x9e06,0x0006,
+        0x0000,0x6306,0x0000,0x0006,0x9e06,0x0006,0x0002,0x0000,0x0006,0x6306,0x0006,0x0000,
+        0x0000,0x6306,0x0000,0x6306,0x0006,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,0x0000,0x6306,0x0000,0x6306,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0002,0x0001,0x0000,0x0002,0x0001,0x6305,0x0000,0x0000,0x0000,0x0002,0x0001,0x6305,
+        0x0002,0x0000,0x0005,0x0002,0x0001,0x0000,0x0000,0x0000,0x0000,0x0002,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0002,0x0001,0x0003,0x0002,0x0000,0x0004,0x0002,0x0001,0x0000,
+        0x0002,0x0000,0x0003,0x0000,0x0000,0x0001,0x0002,0x0001,0x0001,0x0002,0x0001,0x0000,
+        0x0002,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6302,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x6302,0x0001,0x0000,0x0002,0x0001,0x0001,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x6305,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6303,0x0000,0x6304,0x0004,0x0000,0x0000,0x0000,0x0000,0x6303,0x0003,0x0000,
+        0x0002,0x0001,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x5f06,0x5f04,0x0000,0x5f06,0x5f04,0x6306,
+        0x0000,0x6109,0x0000,0x5f02,0xa003,0x6306,0xa002,0x0000,0x6306,0x6106,0x6109,0x0000,
+        0x0000,0x6307,0x0000,0x6307,0x6307,0x0000,0x0000,0x0000,0x0000,0x5f06,0x5f08,0x6306,
+        0x5f04,0x0000,0x6306,0x6106,0x5f08,0x0000,0x0008,0x0000,0x6306,0x0000,0x0000,0x6306,
+        0x6106,0x0008,0x6306,0x6307,0x6307,0x0000,0x6307,0x6307,0x6306,0x0000,0x6307,0x0000,
+        0x0000,0x6107,0x0000,0x6106,0x5f04,0x0000,0x0000,0x0000,0x0000,0x6106,0x0003,0x0000,
+        0x6102,0x0001,0x6306,0x0000,0x6106,0x0000,0x0000,0x0000,0x0000,0x0000,0x6307,0x0000,
+        0x0000,0x0000,0x0000,0x0002,0x0004,0x6104,0x0009,0x0000,0x0009,0x6104,0x0004,0x0000,
+        0x0008,0x0000,0x6108,0x0000,0x0000,0x9e05,0x0008,0x0008,0x6108,0x6307,0x6307,0x0000,
+        0x6307,0x6307,0x6307,0x0000,0x6307,0x0000,0x0007,0x0000,0x0007,0x0000,0x0000,0x9e04,
+        0x0007,0x9e04,0x6304,0x0000,0x0000,0x9e03,0x0000,0x0000,0x0000,0x9e02,0x0000,0x9e07,
+        0x6307,0x6307,0x6303,0x6307,0x0000,0x6307,0x6302,0x6307,0x0000,0x6108,0x0003,0x0000,
+        0x0009,0x9e04,0x6308,0x0000,0x0004,0x0000,0x6108,0x9e03,0x6308,0x9e02,0x0000,0x6308,
+        0x6108,0x0008,0x0000,0x0000,0x6307,0x0000,0x6307,0x6307,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6104,0x0000,0x6302,0x6104,0x0000,0x0000,0x0000,0x0000,0x6302,0x0003,0x0000,
+        0x6302,0x0001,0x0001,0x0000,0x6309,0x0000,0x0000,0x0000,0x0000,0x0000,0x6307,0x0000,
+        0x0000,0x0000,0x0000,0x6302,0x6108,0x0000,0x6302,0x9e04,0x0001,0x0000,0x6309,0x0000,
+        0x6302,0x9e03,0x0001,0x6302,0x0000,0x0001,0x6302,0x6309,0x0000,0x0000,0x6307,0x0000,
+        0x6302,0x6307,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6307,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x6307,0x0000,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x5f06,0x0006,0x6306,
+        0x5f08,0x0000,0x6306,0x6106,0x6109,0x0000,0x5f08,0x0000,0x6306,0x0000,0x0000,0x6306,
+        0x6106,0x6109,0x6306,0x6106,0x6108,0x0000,0x6106,0x6108,0x6306,0x0000,0x6106,0x0000,
+        0x5f06,0x0000,0x6306,0x0000,0x0000,0x6306,0x6106,0x9e06,0x6306,0x0000,0x0000,0x6306,
+        0x0000,0x0000,0x0000,0x6106,0x0000,0x6306,0x6106,0x9e06,0x6306,0x6106,0x0000,0x6306,
+        0x6302,0x9e06,0x0000,0x6102,0x0006,0x0000,0x6102,0x0004,0x6306,0x0000,0x6109,0x0000,
+        0x6102,0x0003,0x6306,0x6102,0x0000,0x6306,0x6106,0x6109,0x0000,0x0000,0x6108,0x0000,
+        0x6106,0x6108,0x0000,0x0000,0x0000,0x0000,0x0005,0x0000,0x0005,0x0000,0x0000,0x9e04,
+        0x0005,0x0005,0x6304,0x0000,0x0000,0x9e03,0x0000,0x0000,0x0000,0x9e02,0x0000,0x9e05,
+        0x0005,0x0005,0x6303,0x9e02,0x0000,0x9e05,0x6302,0x0005,0x0000,0x0000,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,
+        0x6108,0x0003,0x6308,0x0009,0x0000,0x6308,0x6102,0x0004,0x0000,0x6108,0x0000,0x6308,
+        0x0000,0x0000,0x6308,0x6108,0x0008,0x6308,0x6102,0x0003,0x0000,0x0009,0x0009,0x6308,
+        0x0000,0x0008,0x0000,0x6302,0x6108,0x0000,0x6302,0x0004,0x0001,0x0000,0x6309,0x0000,
+        0x6302,0x0003,0x0001,0x6302,0x0000,0x0001,0x6302,0x6309,0x0000,0x0000,0x6308,0x0000,
+        0x6302,0x6308,0x0000,0x0000,0x0000,0x0000,0x6302,0x6108,0x0001,0x6302,0x0000,0x0001,
+        0x6302,0x6309,0x0000,0x6302,0x0000,0x0001,0x0000,0x0000,0x0000,0x6302,0x6309,0x0001,
+        0x6302,0x6308,0x0000,0x6302,0x6308,0x0001,0x0000,0x6308,0x0000,0x0000,0x6108,0x0000,
+        0x6302,0x0004,0x0000,0x0000,0x0000,0x0000,0x6302,0x0003,0x0000,0x6302,0x0001,0x0001,
+        0x0000,0x6309,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6304,0x0000,0x6304,0x6304,0x0000,0x0000,0x0000,0x0000,0x6106,0xa003,0x0000,
+        0xa002,0x0001,0x6306,0x0000,0x6106,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x6304,0x6304,0x0000,0x6304,0x6304,0x6306,0x0000,0x6304,0x0000,
+        0x0002,0x9e06,0x6306,0xa002,0x0000,0x6306,0x6106,0x0008,0x0000,0x0000,0x0001,0x0000,
+        0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6306,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x6306,0x0000,0x6306,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x6304,0x0000,
+        0x6304,0x6304,0x6304,0x0000,0x6304,0x0000,0x0008,0x9e03,0x6108,0x9e02,0x0000,0x9e05,
+        0x0008,0x0008,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x6304,0x6304,0x6304,0x6304,0x0000,0x6304,0x6304,0x6304,0x0000,0x0008,0x0000,0x0008,
+        0x0000,0x0000,0x9e08,0x0008,0x0008,0x0008,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0001,0x0000,0x0000,0x6304,0x0000,0x6304,0x6304,0x0000,0x0000,0x0000,0x0000,
+        0x6108,0x9e03,0x0000,0x9e02,0x0001,0x6308,0x0000,0x0008,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x6305,0x0000,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,
+        0x6302,0x6304,0x0000,0x0000,0x0000,0x0000,0x6302,0x9e03,0x0000,0x6302,0x0001,0x0001,
+        0x0000,0x6309,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x5f02,0xa005,0x6306,0x0004,0x0000,0x6306,0x6106,0x0005,0x0000,
+        0xa006,0x0000,0x6306,0x0000,0x0000,0x6306,0x6106,0x9e06,0x6306,0x6307,0x6307,0x0000,
+        0x6307,0x6307,0x6306,0x0000,0x6307,0x0000,0xa002,0x0000,0x6306,0x0000,0x0000,0x6306,
+        0x6102,0x0001,0x6306,0x0000,0x0000,0x6306,0x0000,0x0000,0x0000,0x9e06,0x0000,0x6306,
+        0x6307,0x0001,0x6306,0x6307,0x0000,0x6306,0x6302,0x0001,0x0000,0x6106,0x6107,0x0000,
+        0x6106,0x0004,0x6306,0x0000,0x6106,0x0000,0x6106,0x9e06,0x6306,0x9e06,0x0000,0x6306,
+        0x6106,0x6106,0x0000,0x0000,0x6307,0x0000,0x6307,0x6307,0x0000,0x0000,0x0000,0x0000,
+        0x0004,0x0000,0x6104,0x0000,0x0000,0x9e04,0x6104,0x9e04,0x6304,0x0000,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x6307,0x6307,0x6303,0x6307,0x0000,0x6307,
+        0x6302,0x6307,0x0000,0x0000,0x0000,0x9e03,0x0000,0x0000,0x0000,0x9e02,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x6307,0x0000,0x6303,
+        0x0000,0x0000,0x6307,0x6302,0x0001,0x0001,0x0004,0x0004,0x6104,0x9e02,0x0000,0x9e04,
+        0x6104,0x0004,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,
+        0x6307,0x6307,0x0000,0x6307,0x6307,0x6307,0x0000,0x6307,0x0000,0x6302,0x0005,0x0000,
+        0x6302,0x9e04,0x0001,0x0000,0x6309,0x0000,0x6302,0x9e03,0x0001,0x6302,0x0000,0x0001,
+        0x6302,0x6309,0x0000,0x0000,0x6307,0x0000,0x6302,0x6307,0x0000,0x0000,0x0000,0x0000,
+        0x6302,0x0001,0x0001,0x6302,0x0000,0x0001,0x6302,0x0001,0x0000,0x6302,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x6302,0x0001,0x0001,0x6302,0x0001,0x0000,0x6302,0x0001,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x6307,0x0000,0x6302,0x6307,0x0000,0x0000,0x0000,0x0000,
+        0x6302,0x6307,0x0000,0x6302,0x0001,0x0001,0x0000,0x6307,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6307,0x0000,0x0000,0x0000,0x0000,0x0006,0x0000,0x6306,0x0000,0x0000,0x6306,
+        0x6106,0x0005,0x6306,0x0000,0x0000,0x6306,0x0000,0x0000,0x0000,0x6106,0x0000,0x6306,
+        0x6102,0x0005,0x6306,0x0006,0x0000,0x6306,0x6302,0x0005,0x0000,0x0000,0x0000,0x6306,
+        0x0000,0x0000,0x0000,0x9e06,0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6306,0x9e06,0x0000,0x6306,0x0000,0x0000,0x6306,0x6302,0x0001,0x0001,
+        0x0006,0x0006,0x6306,0x0006,0x0000,0x6306,0x6106,0x0006,0x0000,0x0006,0x0000,0x6306,
+        0x0000,0x0000,0x6306,0x6106,0x0006,0x6306,0x6102,0x0006,0x0000,0x0006,0x0006,0x6306,
+        0x0000,0x0006,0x0000,0x0000,0x0000,0x9e03,0x0000,0x0000,0x0000,0x9e02,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0005,0x0000,0x6303,
+        0x0000,0x0000,0x9e05,0x6302,0x0005,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0004,0x0000,0x0004,
+        0x0000,0x0000,0x9e04,0x0004,0x0004,0x6304,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0001,0x0002,0x0003,0x6303,0x0009,0x0000,0x0009,0x6302,0x0009,0x0000,
+        0x6302,0x0005,0x0001,0x6302,0x0000,0x0001,0x6302,0x6309,0x0000,0x6302,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x6302,0x6309,0x0001,0x6302,0x0005,0x0000,0x6302,0x0005,0x0001,
+        0x0000,0x6309,0x0000,0x6302,0x0000,0x0001,0x0000,0x0000,0x0000,0x6302,0x0001,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,0x6302,0x0001,0x0001,
+        0x6302,0x0000,0x0001,0x6302,0x0001,0x0000,0x6302,0x0003,0x0000,0x6302,0x0004,0x0001,
+        0x0000,0x6309,0x0000,0x6302,0x0003,0x0001,0x6302,0x0000,0x0001,0x6302,0x0009,0x0000,
+        0x0000,0x0003,0x0000,0x6302,0x0009,0x0000,0x0000,0x0000,0x0000,0x6304,0x6304,0x0000,
+        0x6304,0x6304,0x6306,0x0000,0x6304,0x0000,0x6106,0x9e06,0x6306,0x9e06,0x0000,0x6306,
+        0x6106,0x9e06,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x6304,0x0001,0x6306,0x6304,0x0000,0x6306,0x6304,0x0001,0x0000,0x9e06,0x0000,0x6306,
+        0x0000,0x0000,0x6306,0x9e06,0x0001,0x6306,0x0001,0x0000,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x6306,0x0000,0x6306,0x6306,0x0000,0x0000,0x0000,0x0000,
+        0x6306,0x6306,0x0000,0x6306,0x0001,0x6306,0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x6304,0x6304,0x6304,0x6304,0x0000,0x6304,
+        0x6304,0x6304,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,
+        0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x6304,0x0000,0x6304,
+        0x0000,0x0000,0x6304,0x6304,0x0001,0x6304,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0001,0x0000,0x0000,
+        0x6304,0x6304,0x0000,0x6304,0x6304,0x6304,0x0000,0x6304,0x0000,0x0001,0x0001,0x0000,
+        0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x6302,0x6304,0x0000,0x0000,0x0000,0x0000,
+        0x6302,0x6305,0x0000,0x6302,0x0001,0x0001,0x0000,0x6305,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x6302,0x0001,0x0000,0x6302,0x0001,0x0001,
+        0x0000,0x0000,0x0000,0x6302,0x0001,0x0001,0x6302,0x0000,0x0001,0x6302,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6309,0x0000,0x6309,0x6309,0x0000,0x0000,0x0000,0x0000,0x6309,0x6309,0x0000,
+        0x6309,0x0001,0x6306,0x0000,0x6309,0x0000,0x0000,0x0000,0x0000,0x0000,0x6306,0x0000,
+        0x0000,0x0000,0x0000,0x6309,0x6309,0x0000,0x6309,0x6309,0x6306,0x0000,0x6309,0x0000,
+        0x6309,0x6309,0x6306,0x6309,0x0000,0x6306,0x6309,0x6309,0x0000,0x0000,0x6306,0x0000,
+        0x6306,0x6306,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6309,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x6309,0x0000,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6309,0x6309,0x0000,
+        0x6309,0x6309,0x6305,0x0000,0x6309,0x0000,0x6309,0x6309,0x6305,0x6309,0x0000,0x6305,
+        0x6309,0x6309,0x0000,0x0000,0x6307,0x0000,0x6307,0x6307,0x0000,0x0000,0x0000,0x0000,
+        0x6309,0x6309,0x6309,0x6309,0x0000,0x6309,0x6309,0x6309,0x0000,0x6309,0x0000,0x6309,
+        0x0000,0x0000,0x6309,0x6309,0x6309,0x6309,0x6307,0x6307,0x0000,0x6307,0x6307,0x6307,
+        0x0000,0x6307,0x0000,0x0000,0x6309,0x0000,0x6302,0x6309,0x0000,0x0000,0x0000,0x0000,
+        0x6302,0x6309,0x0000,0x6302,0x0001,0x0001,0x0000,0x6309,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6307,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x6309,0x0000,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,
+        0x6302,0x6304,0x0000,0x0000,0x0000,0x0000,0x6302,0x6309,0x0000,0x6302,0x0001,0x0001,
+        0x0000,0x6309,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x6309,0x6309,0x0000,0x6309,0x6309,0x6306,0x0000,0x6309,0x0000,
+        0x6309,0x6309,0x6306,0x6309,0x0000,0x6306,0x6309,0x6309,0x0000,0x0000,0x6306,0x0000,
+        0x6306,0x6306,0x0000,0x0000,0x0000,0x0000,0x6309,0x6309,0x6306,0x6309,0x0000,0x6306,
+        0x6309,0x6309,0x0000,0x6309,0x0000,0x6306,0x0000,0x0000,0x6306,0x6309,0x6309,0x6306,
+        0x6306,0x6306,0x0000,0x6306,0x6306,0x6306,0x0000,0x6306,0x0000,0x0000,0x6309,0x0000,
+        0x6302,0x6309,0x0000,0x0000,0x0000,0x0000,0x6302,0x6309,0x0000,0x6302,0x0001,0x0001,
+        0x0000,0x6309,0x0000,0x0000,0x0000,0x0000,0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,
+        0x6309,0x6309,0x6305,0x6309,0x0000,0x6305,0x6309,0x6309,0x0000,0x6309,0x0000,0x6305,
+        0x0000,0x0000,0x6305,0x6309,0x6309,0x6305,0x6309,0x6309,0x0000,0x6309,0x6309,0x6305,
+        0x0000,0x6309,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0001,0x0000,
+        0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x6302,0x6309,0x0000,0x6302,0x6309,0x0001,
+        0x0000,0x6309,0x0000,0x6302,0x6309,0x0001,0x6302,0x0000,0x0001,0x6302,0x0009,0x0000,
+        0x0000,0x6309,0x0000,0x6302,0x0009,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,
+        0x6302,0x6304,0x0000,0x0000,0x0000,0x0000,0x6302,0x6309,0x0000,0x6302,0x0001,0x0001,
+        0x0000,0x6309,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x6302,0x6304,0x0000,0x6302,0x6304,0x0001,0x0000,0x6304,0x0000,0x6302,0x6309,0x0001,
+        0x6302,0x0000,0x0001,0x6302,0x0009,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6309,0x0000,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x6309,0x0000,0x6309,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,
+        0x6304,0x6304,0x0000,0x0000,0x0000,0x0000,0x6309,0x6309,0x0000,0x6309,0x0001,0x6306,
+        0x0000,0x6309,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x6304,0x6304,0x0000,0x0000,0x0000,0x0000,
+        0x6309,0x6309,0x0000,0x6309,0x0001,0x6305,0x0000,0x6309,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x6304,0x6304,0x0000,0x6304,0x6304,0x6304,
+        0x0000,0x6304,0x0000,0x6309,0x6309,0x6309,0x6309,0x0000,0x0009,0x6309,0x0009,0x0000,
+        0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x6309,0x0000,0x6302,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6309,0x0000,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x5f06,0x0006,0x6306,
+        0x5f06,0x0000,0x6306,0x6102,0x0006,0x0000,0x0006,0x0000,0x6306,0x0000,0x0000,0x6306,
+        0x0006,0x0006,0x6306,0x6307,0x6307,0x0000,0x6307,0x6307,0x6306,0x0000,0x6307,0x0000,
+        0x5f04,0x0000,0x6306,0x0000,0x0000,0x6306,0x6102,0x0008,0x6306,0x0000,0x0000,0x6306,
+        0x0000,0x0000,0x0000,0x0006,0x0000,0x6306,0x6307,0x6307,0x6306,0x6307,0x0000,0x6306,
+        0x6302,0x6307,0x0000,0x6106,0x6107,0x0000,0x6106,0x9e06,0x6306,0x0000,0x6107,0x0000,
+        0x6106,0x0003,0x6306,0x9e06,0x0000,0x6306,0x6106,0x0006,0x0000,0x0000,0x6307,0x0000,
+        0x6307,0x6307,0x0000,0x0000,0x0000,0x0000,0x0003,0x0000,0x0003,0x0000,0x0000,0x0001,
+        0x6104,0x0004,0x6304,0x0000,0x0000,0x9e03,0x0000,0x0000,0x0000,0x0008,0x0000,0x0008,
+        0x6307,0x6307,0x6303,0x0001,0x0000,0x0001,0x6302,0x6307,0x0000,0x0000,0x0000,0x9e03,
+        0x0000,0x0000,0x0000,0x0007,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x9e07,0x6307,0x0000,0x6303,0x0000,0x0000,0x0001,0x6302,0x6307,0x0001,
+        0x0003,0x0003,0x6308,0x0001,0x0000,0x0001,0x6102,0x0004,0x0000,0x9e02,0x0000,0x6308,
+        0x0000,0x0000,0x0001,0x0008,0x0008,0x6308,0x6307,0x6307,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x6307,0x0000,0x6302,0x6104,0x0000,0x6302,0x6104,0x0001,0x0000,0x6104,0x0000,
+        0x6302,0x0003,0x0001,0x6302,0x0000,0x0001,0x6302,0x0005,0x0000,0x0000,0x6307,0x0000,
+        0x6302,0x6307,0x0000,0x0000,0x0000,0x0000,0x6302,0x0008,0x0001,0x6302,0x0000,0x0001,
+        0x6302,0x0008,0x0000,0x6302,0x0000,0x0001,0x0000,0x0000,0x0000,0x6302,0x0008,0x0001,
+        0x6302,0x6307,0x0000,0x6302,0x6307,0x0001,0x0000,0x6307,0x0000,0x0000,0x6307,0x0000,
+        0x6302,0x6307,0x0000,0x0000,0x0000,0x0000,0x6302,0x6307,0x0000,0x6302,0x0001,0x0001,
+        0x0000,0x6307,0x0000,0x0000,0x0000,0x0000,0x0000,0x6307,0x0000,0x0000,0x0000,0x0000,
+        0x0006,0x0000,0x6306,0x0000,0x0000,0x6306,0x6102,0x0006,0x6306,0x0000,0x0000,0x6306,
+        0x0000,0x0000,0x0000,0x0006,0x0000,0x6306,0x6106,0x0006,0x6306,0x6106,0x0000,0x6306,
+        0x6302,0x0006,0x0000,0x0000,0x0000,0x6306,0x0000,0x0000,0x0000,0x0006,0x0000,0x6306,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6306,0x6106,0x0000,0x6306,
+        0x0000,0x0000,0x6306,0x6302,0x9e06,0x0001,0x6102,0x0006,0x6306,0x0006,0x0000,0x6306,
+        0x6102,0x0006,0x0000,0x6102,0x0000,0x6306,0x0000,0x0000,0x6306,0x6102,0x0006,0x6306,
+        0x6106,0x0006,0x0000,0x6106,0x0006,0x6306,0x0000,0x0006,0x0000,0x0000,0x0000,0x9e03,
+        0x0000,0x0000,0x0000,0x0005,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x9e05,0x9e02,0x0000,0x6303,0x0000,0x0000,0x0001,0x6302,0x0005,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0000,0x0003,0x0000,0x6308,0x0000,0x0000,0x0001,0x6102,0x0004,0x6304,
+        0x0000,0x0000,0x6308,0x0000,0x0000,0x0000,0x0008,0x0000,0x0008,0x0003,0x0003,0x6303,
+        0x0001,0x0000,0x0001,0x6302,0x0008,0x0000,0x6302,0x0003,0x0001,0x6302,0x0000,0x0001,
+        0x6302,0x0004,0x0000,0x6302,0x0000,0x0001,0x0000,0x0000,0x0000,0x6302,0x0005,0x0001,
+        0x6302,0x6308,0x0000,0x6302,0x6308,0x0001,0x0000,0x6308,0x0000,0x6302,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x6302,0x0008,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x6302,0x0000,0x0001,0x6302,0x6308,0x0001,0x6302,0x0000,0x0001,0x6302,0x0008,0x0000,
+        0x6302,0x0003,0x0000,0x6302,0x0004,0x0001,0x0000,0x0004,0x0000,0x6302,0x0003,0x0001,
+        0x6302,0x0000,0x0001,0x6302,0x0008,0x0000,0x0000,0x6308,0x0000,0x6302,0x0008,0x0000,
+        0x0000,0x0000,0x0000,0x6304,0x6304,0x0000,0x6304,0x6304,0x6306,0x0000,0x6304,0x0000,
+        0x6106,0xa003,0x6306,0x9e06,0x0000,0x6306,0x6106,0x0006,0x0000,0x0000,0x0001,0x0000,
+        0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x6304,0x6304,0x6306,0x6304,0x0000,0x6306,
+        0x6304,0x6304,0x0000,0xa006,0x0000,0x6306,0x0000,0x0000,0x6306,0x0006,0x0008,0x6306,
+        0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x6306,0x0000,
+        0x6306,0x6306,0x0000,0x0000,0x0000,0x0000,0x6306,0x6306,0x0000,0x6306,0x0001,0x6306,
+        0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x6304,0x6304,0x6304,0x0001,0x0000,0x0001,0x6304,0x6304,0x0000,0x9e02,0x0000,0x9e03,
+        0x0000,0x0000,0x0001,0x0008,0x0008,0x0008,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x6304,0x0000,0x6304,0x0000,0x0000,0x0001,0x6304,0x6304,0x6304,
+        0x0000,0x0000,0x9e03,0x0000,0x0000,0x0000,0x0008,0x0000,0x0008,0x0001,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,0x6304,0x6304,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x6304,0x0000,0x9e02,0x9e03,0x6308,0x0001,0x0000,0x0001,0x0008,0x0008,0x0000,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,
+        0x6302,0x6304,0x0000,0x0000,0x0000,0x0000,0x6302,0x6305,0x0000,0x6302,0x0001,0x0001,
+        0x0000,0x6305,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x6302,0x6304,0x0000,0x6302,0x6304,0x0001,0x0000,0x6304,0x0000,0x6302,0x9e03,0x0001,
+        0x6302,0x0000,0x0001,0x6302,0x0008,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x5f04,0x0000,0x6306,0x0000,0x0000,0x6306,
+        0x6102,0x0005,0x6306,0x0000,0x0000,0x6306,0x0000,0x0000,0x0000,0x0006,0x0000,0x6306,
+        0x6307,0x6307,0x6306,0x6307,0x0000,0x6306,0x6302,0x6307,0x0000,0x0000,0x0000,0x6306,
+        0x0000,0x0000,0x0000,0x6102,0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6306,0x6307,0x0000,0x6306,0x0000,0x0000,0x6306,0x6302,0x0001,0x0001,
+        0x6106,0x6107,0x6306,0x6106,0x0000,0x6306,0x6106,0x6107,0x0000,0x6106,0x0000,0x6306,
+        0x0000,0x0000,0x6306,0x6106,0x0006,0x6306,0x6307,0x6307,0x0000,0x6307,0x6307,0x6306,
+        0x0000,0x6307,0x0000,0x0000,0x0000,0x9e03,0x0000,0x0000,0x0000,0x6104,0x0000,0x6304,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x6307,0x0000,0x6303,
+        0x0000,0x0000,0x0001,0x6302,0x6307,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,0x9e02,0x0000,0x9e03,
+        0x0000,0x0000,0x0001,0x6104,0x0004,0x6304,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0001,0x6307,0x6307,0x6303,0x0001,0x0000,0x0001,0x6302,0x0007,0x0000,
+        0x6302,0x0005,0x0001,0x6302,0x0000,0x0001,0x6302,0x0005,0x0000,0x6302,0x0000,0x0001,
+        0x0000,0x0000,0x0000,0x6302,0x0005,0x0001,0x6302,0x6307,0x0000,0x6302,0x6307,0x0001,
+        0x0000,0x6307,0x0000,0x6302,0x0000,0x0001,0x0000,0x0000,0x0000,0x6302,0x0001,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,0x6302,0x0001,0x0001,
+        0x6302,0x0000,0x0001,0x6302,0x0001,0x0000,0x6302,0x6307,0x0000,0x6302,0x6307,0x0001,
+        0x0000,0x6307,0x0000,0x6302,0x6307,0x0001,0x6302,0x0000,0x0001,0x6302,0x0007,0x0000,
+        0x0000,0x6307,0x0000,0x6302,0x0007,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6306,
+        0x0000,0x0000,0x0000,0x6102,0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6306,0x6102,0x0000,0x6306,0x0000,0x0000,0x6306,0x6302,0x0005,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6306,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6306,0x0000,0x0000,0x0000,
+        0x6302,0x0000,0x0001,0x0006,0x0000,0x6306,0x0000,0x0000,0x6306,0x6102,0x0006,0x6306,
+        0x0000,0x0000,0x6306,0x0000,0x0000,0x0000,0x0006,0x0000,0x0006,0x6102,0x0006,0x6306,
+        0x0006,0x0000,0x0006,0x6302,0x0006,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x6303,0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x9e03,0x0000,0x0000,0x0000,0x0004,0x0000,0x0004,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0003,0x0000,0x0003,0x0000,0x0000,0x0001,
+        0x0002,0x0001,0x0001,0x6302,0x0000,0x0001,0x0000,0x0000,0x0000,0x6302,0x0005,0x0001,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6302,0x0000,0x0001,0x6302,0x0005,0x0001,
+        0x6302,0x0000,0x0001,0x6302,0x0005,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x6302,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x6302,0x0000,0x0001,0x0000,0x0000,0x0000,0x0002,0x0001,0x0001,0x6302,0x0003,0x0001,
+        0x6302,0x0000,0x0001,0x6302,0x0004,0x0000,0x6302,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0002,0x0001,0x0001,0x6302,0x0003,0x0000,0x0002,0x0001,0x0001,0x0000,0x0001,0x0000,
+        0x6304,0x6304,0x6306,0x6304,0x0000,0x6306,0x6304,0x6304,0x0000,0x6106,0x0000,0x6306,
+        0x0000,0x0000,0x6306,0x6106,0x9e06,0x6306,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0001,0x0000,0x6304,0x0000,0x6306,0x0000,0x0000,0x6306,0x6304,0x0001,0x6306,
+        0x0000,0x0000,0x6306,0x0000,0x0000,0x0000,0x9e06,0x0000,0x0006,0x0001,0x0000,0x0001,
+        0x0000,0x0000,0x0001,0x0001,0x0000,0x0000,0x6306,0x6306,0x0000,0x6306,0x6306,0x6306,
+        0x0000,0x6306,0x0000,0x6306,0x6306,0x6306,0x6306,0x0000,0x0006,0x6306,0x0006,0x0000,
+        0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x6304,
+        0x0000,0x0000,0x0001,0x6304,0x6304,0x6304,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x6304,0x0000,0x0004,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0001,0x6304,0x6304,0x6304,0x0001,0x0000,0x0001,0x6304,0x0004,0x0000,
+        0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x6302,0x6304,0x0000,0x6302,0x6304,0x0001,
+        0x0000,0x6304,0x0000,0x6302,0x6305,0x0001,0x6302,0x0000,0x0001,0x6302,0x0005,0x0000,
+        0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x6302,0x0001,0x0001,
+        0x6302,0x0000,0x0001,0x6302,0x0001,0x0000,0x6302,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0002,0x0001,0x0001,0x0001,0x0000,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,
+        0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x6106,0x6104,0x0000,0x6106,0x9e06,0x6306,0x0000,0x6104,0x0000,
+        0x6102,0x0003,0x6306,0x9e06,0x0000,0x6306,0x6102,0x0006,0x0000,0x0000,0x6306,0x0000,
+        0x6306,0x6306,0x0000,0x0000,0x0000,0x0000,0x6106,0x6104,0x6306,0x6106,0x0000,0x6306,
+        0x6106,0x6104,0x0000,0x0006,0x0000,0x6306,0x0000,0x0000,0x6306,0x0006,0x0006,0x6306,
+        0x6306,0x6306,0x0000,0x6306,0x6306,0x6306,0x0000,0x6306,0x0000,0x0000,0x6106,0x0000,
+        0x6302,0x9e06,0x0000,0x0000,0x0000,0x0000,0x6302,0x0003,0x0000,0x6302,0x0001,0x0001,
+        0x0000,0x0006,0x0000,0x0000,0x0000,0x0000,0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,
+        0x0003,0x0003,0x6305,0x0001,0x0000,0x0001,0x6102,0x0004,0x0000,0x0003,0x0000,0x6305,
+        0x0000,0x0000,0x0001,0x0002,0x0005,0x6305,0x6307,0x6307,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x6307,0x0000,0x9e02,0x0000,0x9e03,0x0000,0x0000,0x0001,0x0007,0x0007,0x6304,
+        0x0000,0x0000,0x9e03,0x0000,0x0000,0x0000,0x0007,0x0000,0x0007,0x6307,0x6307,0x6303,
+        0x0001,0x0000,0x0001,0x6302,0x0007,0x0000,0x6302,0x0003,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x0004,0x0000,0x6302,0x0003,0x0001,0x0001,0x0000,0x0000,0x6302,0x0007,0x0000,
+        0x0000,0x6307,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,
+        0x6302,0x6304,0x0000,0x0000,0x0000,0x0000,0x6302,0x0003,0x0000,0x6302,0x0001,0x0001,
+        0x0000,0x0005,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x6302,0x6304,0x0000,0x6302,0x6304,0x0001,0x0000,0x6304,0x0000,0x6302,0x0003,0x0001,
+        0x6302,0x0000,0x0001,0x6302,0x0007,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6307,0x0000,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6106,0x0006,0x6306,0x6106,0x0000,0x6306,
+        0x6106,0x0006,0x0000,0x6102,0x0000,0x6306,0x0000,0x0000,0x6306,0x6102,0x0006,0x6306,
+        0x6306,0x6306,0x0000,0x6306,0x6306,0x6306,0x0000,0x6306,0x0000,0x6106,0x0000,0x6306,
+        0x0000,0x0000,0x6306,0x6106,0x0006,0x6306,0x0000,0x0000,0x6306,0x0000,0x0000,0x0000,
+        0x0006,0x0000,0x0006,0x6306,0x6306,0x6306,0x6306,0x0000,0x0006,0x6306,0x0006,0x0000,
+        0x6302,0x0006,0x0000,0x6302,0x9e06,0x0001,0x0000,0x0006,0x0000,0x6302,0x0003,0x0001,
+        0x6302,0x0000,0x0001,0x6302,0x0006,0x0000,0x0000,0x6306,0x0000,0x6306,0x0006,0x0000,
+        0x0000,0x0000,0x0000,0x9e02,0x0000,0x6305,0x0000,0x0000,0x0001,0x0005,0x0005,0x6304,
+        0x0000,0x0000,0x6305,0x0000,0x0000,0x0000,0x0005,0x0000,0x0005,0x9e02,0x9e03,0x6303,
+        0x0001,0x0000,0x0001,0x6302,0x0005,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,
+        0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,0x6302,0x0003,0x0001,
+        0x0001,0x0000,0x0000,0x6302,0x0004,0x0000,0x6302,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0002,0x0001,0x0001,0x6302,0x0003,0x0000,0x0001,0x0001,0x0000,0x0000,0x0001,0x0000,
+        0x6302,0x6304,0x0000,0x6302,0x6304,0x0001,0x0000,0x6304,0x0000,0x6302,0x0003,0x0001,
+        0x6302,0x0000,0x0001,0x6302,0x0005,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x6302,0x6304,0x0001,0x6302,0x0000,0x0001,0x6302,0x0004,0x0000,
+        0x6302,0x0000,0x0001,0x0000,0x0000,0x0000,0x0002,0x0001,0x0001,0x0001,0x0001,0x0000,
+        0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x6304,0x0000,0x6302,0x0004,0x0000,
+        0x0000,0x0000,0x0000,0x6302,0x0003,0x0000,0x0002,0x0001,0x0001,0x0000,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,
+        0x6304,0x6304,0x0000,0x0000,0x0000,0x0000,0x6106,0x0003,0x0000,0x9e06,0x0001,0x6306,
+        0x0000,0x0006,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x6304,0x6304,0x0000,0x6304,0x6304,0x6306,0x0000,0x6304,0x0000,0x0006,0x0003,0x6306,
+        0x9e06,0x0000,0x0006,0x0006,0x0006,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6306,0x0000,0x6306,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x6304,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x6304,0x0000,0x0003,0x0003,0x6305,0x0001,0x0000,0x0001,0x0002,0x0005,0x0000,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x6304,0x6304,
+        0x0001,0x0000,0x0001,0x6304,0x0004,0x0000,0x0003,0x0000,0x0003,0x0000,0x0000,0x0001,
+        0x0002,0x0001,0x0001,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,
+        0x0000,0x6304,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x6302,0x0003,0x0000,
+        0x0001,0x0001,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6305,0x0000,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x6302,0x0004,0x0000,
+        0x0000,0x0000,0x0000,0x6302,0x0003,0x0000,0x0002,0x0001,0x0001,0x0000,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6308,0x0000,0x6308,0x6308,0x0000,0x0000,0x0000,0x0000,0x6308,0x6308,0x0000,
+        0x6308,0x0001,0x6306,0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,0x0000,0x6307,0x0000,
+        0x0000,0x0000,0x0000,0x6308,0x6308,0x0000,0x6308,0x6308,0x6306,0x0000,0x6306,0x0000,
+        0x6308,0x6308,0x6306,0x6308,0x0000,0x6306,0x6306,0x6306,0x0000,0x0000,0x6307,0x0000,
+        0x6307,0x6307,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x6308,0x0000,0x6308,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x6308,0x0000,
+        0x6308,0x6308,0x6308,0x0000,0x6308,0x0000,0x6308,0x6308,0x6308,0x6308,0x0000,0x6308,
+        0x6308,0x6308,0x0000,0x0000,0x6307,0x0000,0x6307,0x6307,0x0000,0x0000,0x0000,0x0000,
+        0x6308,0x6308,0x6308,0x6308,0x0000,0x6308,0x6308,0x6308,0x0000,0x6308,0x0000,0x6308,
+        0x0000,0x0000,0x6308,0x6308,0x6308,0x6308,0x6307,0x6307,0x0000,0x6307,0x6307,0x6307,
+        0x0000,0x6307,0x0000,0x0000,0x6308,0x0000,0x6308,0x6308,0x0000,0x0000,0x0000,0x0000,
+        0x6308,0x6308,0x0000,0x6308,0x0001,0x6308,0x0000,0x6308,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6307,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,
+        0x6302,0x6308,0x0000,0x0000,0x0000,0x0000,0x6302,0x6303,0x0000,0x6302,0x0001,0x0001,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x6307,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x6308,0x6308,0x0000,0x6308,0x6308,0x6306,0x0000,0x6306,0x0000,
+        0x6308,0x6308,0x6306,0x6308,0x0000,0x6306,0x6306,0x6306,0x0000,0x0000,0x6308,0x0000,
+        0x6308,0x6308,0x0000,0x0000,0x0000,0x0000,0x6308,0x6308,0x6306,0x6308,0x0000,0x6306,
+        0x6306,0x6306,0x0000,0x6308,0x0000,0x6306,0x0000,0x0000,0x6306,0x6306,0x6306,0x6306,
+        0x6308,0x6308,0x0000,0x6308,0x6308,0x6306,0x0000,0x6306,0x0000,0x0000,0x6308,0x0000,
+        0x6308,0x6308,0x0000,0x0000,0x0000,0x0000,0x6308,0x6308,0x0000,0x6308,0x0001,0x6306,
+        0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x0000,0x0000,0x0000,0x0000,
+        0x6308,0x6308,0x6308,0x6308,0x0000,0x6308,0x6308,0x6308,0x0000,0x6308,0x0000,0x6308,
+        0x0000,0x0000,0x6308,0x6308,0x6308,0x6308,0x6308,0x6308,0x0000,0x6308,0x6308,0x6308,
+        0x0000,0x6308,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0001,0x0000,
+        0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x6308,0x6308,0x0000,0x6308,0x6308,0x6308,
+        0x0000,0x6308,0x0000,0x6308,0x6308,0x6308,0x6308,0x0000,0x0008,0x6308,0x0008,0x0000,
+        0x0000,0x6308,0x0000,0x6308,0x0008,0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,
+        0x6302,0x6308,0x0000,0x0000,0x0000,0x0000,0x6302,0x6303,0x0000,0x6302,0x0001,0x0001,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x0000,0x0000,0x0000,0x0000,
+        0x6302,0x6303,0x0000,0x6302,0x6308,0x0001,0x0000,0x0001,0x0000,0x6302,0x6303,0x0001,
+        0x6302,0x0000,0x0001,0x0001,0x0001,0x0000,0x0000,0x6303,0x0000,0x6302,0x0008,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6303,0x0000,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x6308,0x0000,0x6308,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,
+        0x6304,0x6304,0x0000,0x0000,0x0000,0x0000,0x6308,0x6308,0x0000,0x6308,0x0001,0x6306,
+        0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x6304,0x6304,0x0000,0x0000,0x0000,0x0000,
+        0x6308,0x6308,0x0000,0x6308,0x0001,0x6308,0x0000,0x6308,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x6304,0x6304,0x0000,0x6304,0x6304,0x6304,
+        0x0000,0x6304,0x0000,0x6308,0x6308,0x6308,0x6308,0x0000,0x0008,0x6308,0x0008,0x0000,
+        0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x6308,0x0000,0x6308,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6303,0x0000,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6106,0xa005,0x0000,
+        0x0002,0x9e06,0x6306,0x0000,0x6306,0x0000,0x6106,0x9e06,0x6306,0x9e06,0x0000,0x6306,
+        0x6306,0x6306,0x0000,0x0000,0x6307,0x0000,0x6307,0x6307,0x0000,0x0000,0x0000,0x0000,
+        0xa002,0x0001,0x6306,0xa002,0x0000,0x6306,0x6306,0x0001,0x0000,0x9e06,0x0000,0x6306,
+        0x0000,0x0000,0x6306,0x6306,0x0001,0x6306,0x6307,0x0001,0x0000,0x6307,0x0001,0x6306,
+        0x0000,0x0000,0x0000,0x0000,0x6106,0x0000,0x6106,0x0004,0x0000,0x0000,0x0000,0x0000,
+        0x6106,0x9e06,0x0000,0x9e06,0x0001,0x6306,0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6307,0x0000,0x0000,0x0000,0x0000,0x0004,0x9e03,0x6104,0x0004,0x0000,0x0004,
+        0x6104,0x9e04,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,
+        0x6307,0x6307,0x0000,0x6307,0x6307,0x6307,0x0000,0x6307,0x0000,0x9e02,0x0000,0x9e03,
+        0x0000,0x0000,0x9e04,0x9e02,0x0001,0x6304,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0001,0x6307,0x0001,0x6303,0x6307,0x0000,0x0007,0x6302,0x0001,0x0000,
+        0x0004,0x0004,0x0000,0x0004,0x0004,0x0004,0x0000,0x0004,0x0000,0x0001,0x0001,0x0000,
+        0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x6307,0x0000,0x6307,0x0007,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x6302,0x9e04,0x0000,0x0000,0x0000,0x0000,
+        0x6302,0x6303,0x0000,0x6302,0x0001,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6307,0x0000,0x0000,0x0000,0x0000,0x6302,0x0001,0x0000,0x6302,0x0001,0x0001,
+        0x0000,0x0000,0x0000,0x6302,0x0001,0x0001,0x6302,0x0000,0x0001,0x0001,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6307,0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x6302,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x6106,0xa005,0x6306,0xa006,0x0000,0x6306,0x6306,0x6306,0x0000,0x6106,0x0000,0x6306,
+        0x0000,0x0000,0x6306,0x6306,0x6306,0x6306,0x6106,0x0005,0x0000,0x0006,0x0005,0x6306,
+        0x0000,0x6306,0x0000,0x9e06,0x0000,0x6306,0x0000,0x0000,0x6306,0x6306,0x0001,0x6306,
+        0x0000,0x0000,0x6306,0x0000,0x0000,0x0000,0x6306,0x0000,0x0006,0x9e06,0x0001,0x6306,
+        0x9e06,0x0000,0x0006,0x6306,0x0001,0x0000,0x6106,0x0006,0x0000,0x0006,0x0004,0x6306,
+        0x0000,0x6306,0x0000,0x6106,0x9e06,0x6306,0x9e06,0x0000,0x0006,0x6306,0x0006,0x0000,
+        0x0000,0x0006,0x0000,0x0006,0x0006,0x0000,0x0000,0x0000,0x0000,0x9e02,0x0000,0x9e03,
+        0x0000,0x0000,0x9e04,0x9e02,0x9e04,0x6304,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0001,0x0005,0x0005,0x6303,0x0005,0x0000,0x0005,0x6302,0x0005,0x0000,
+        0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,
+        0x0001,0x0001,0x0000,0x0004,0x0004,0x0004,0x0004,0x0000,0x0004,0x0004,0x0004,0x0000,
+        0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,0x0002,0x0003,0x0000,
+        0x0002,0x0001,0x0001,0x0000,0x0001,0x0000,0x6302,0x6303,0x0000,0x6302,0x9e04,0x0001,
+        0x0000,0x0001,0x0000,0x6302,0x6303,0x0001,0x6302,0x0000,0x0001,0x0001,0x0001,0x0000,
+        0x0000,0x6303,0x0000,0x6302,0x0005,0x0000,0x0000,0x0000,0x0000,0x6302,0x0001,0x0001,
+        0x6302,0x0000,0x0001,0x0001,0x0000,0x0000,0x6302,0x0000,0x0001,0x0000,0x0000,0x0000,
+        0x0001,0x0000,0x0001,0x6302,0x0001,0x0000,0x0002,0x0001,0x0001,0x0000,0x0000,0x0000,
+        0x0000,0x6303,0x0000,0x6302,0x0004,0x0000,0x0000,0x0000,0x0000,0x6302,0x0003,0x0000,
+        0x0002,0x0001,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x6304,0x6304,0x0000,0x0000,0x0000,0x0000,
+        0x6106,0x9e06,0x0000,0x9e06,0x0001,0x6306,0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x6304,0x0001,0x0000,0x6304,0x0001,0x6306,
+        0x0000,0x0000,0x0000,0x9e06,0x0001,0x6306,0x9e06,0x0000,0x0006,0x6306,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6306,0x0000,0x0000,0x0000,0x0000,0x0000,0x6306,0x0000,0x6306,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x6304,0x6304,0x0000,0x6304,0x6304,0x6304,0x0000,0x6304,0x0000,0x0001,0x0001,0x0000,
+        0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x6304,0x0001,0x6304,0x6304,0x0000,0x0004,0x6304,0x0001,0x0000,
+        0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,0x0001,0x0000,0x0000,
+        0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x6304,0x0000,0x6304,0x0004,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x6304,0x0000,0x0000,0x0000,0x0000,0x0000,0x6303,0x0000,0x6302,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x6302,0x0001,0x0000,0x0000,0x0000,0x0000,0x6302,0x0001,0x0000,
+        0x0002,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,
+        0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,
+        0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,
+        0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,
+        0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0001,0x0001,0x0001,0x0000,
+        0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,
+        0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,
+        0x0001,0x0000,0x0001,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+        0x0000,0x0000,0x0000,
+    },
+};
@@ -0,0 +1,267 @@
+/*
+ * Position benchmark
+ * ------------------
+ * The suite below is part of the source so the benchmark needs no data files.
+ * Positions are written row by row, rows separated by '/', with 'x', 'o' and
+ * '.' for an empty cell; 'x' moves first, so the side to move follows from
+ * the stone counts.
+ *
+ * The signature is an FNV-1a hash of every position's move and score: a
+ * change means the engine now answers some position differently. Node counts
+ * are reported separately since move-ordering work changes them on purpose.
+ * BENCH_SIGNATURE is the expected value; update it together with a change
+ * that is meant to alter the engine's answers.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+#include "bench.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "../Kernels/board_kernel.h"
+
+/* Largest board side the suite format is parsed into. */
+#define BENCH_MAX_SIZE 8
+
+/* Signature of the full suite when the search limits are the defaults. */
+#define BENCH_SIGNATURE 0x1dc8d07e3310ced0ULL
+
+/* Per-run budget of the playout benchmark when the config sets none. */
+#define PLAYOUT_BENCH_DEFAULT_MS 1000
+
+typedef struct
+{
+    const char *kind; /* opening, midgame or tactical */
+    const char *cells;
+} BenchPosition;
+
+static const BenchPosition benchSuite[] = {
+    /* 3x3 */
+    {"opening", "x../.../..."},
+    {"opening", ".../.x./..."},
+    {"opening", ".x./.../..."},
+    {"opening", "x../.o./..."},
+    {"midgame", "x../.o./..x"},
+    {"midgame", "x.o/.x./o.."},
+    {"midgame", "xo./.o./.x."},
+    {"tactical", "xo./.x./..."},
+    {"tactical", "o.x/.x./..."},
+    {"tactical", "xx./oo./..."},
+    {"tactical", "xo./xo./..."},
+    {"tactical", "x.o/.../x.o"},
+    /* 4x4 */
+    {"opening", "..../.x../..../...."},
+    {"opening", "x.../..../..../...."},
+    {"opening", ".x../..../..../...."},
+    {"opening", "..../.x../..o./...."},
+    {"midgame", "x..o/.x../..o./...."},
+    {"midgame", "..../.xo./.ox./...."},
+    {"midgame", "x.../.o../..x./...o"},
+    {"midgame", "xo../.x../..o./...."},
+    {"midgame", "...x/.xo./.o../...."},
+    {"tactical", "xxx./ooo./..../...."},
+    {"tactical", "xxx./oo../o.../...."},
+    {"tactical", "x.o./.xo./..x./...."},
+    {"tactical", "oxx./.o../..o./x..."},
+    {"tactical", "xo.x/.ox./..o./...."},
+    {"tactical", "x..x/.oo./..../...."},
+};
+
+#define BENCH_POSITION_COUNT ((int)(sizeof(benchSuite) / sizeof(benchSuite[0])))
+
+/*
+ * Parse a suite position into a flat row-major board (' ' for empty); the
+ * first row gives the board side. Returns the side, or 0 if the position is
+ * not square.
+ */
+static int parsePosition(const char *text, char out_cells[BENCH_MAX_SIZE * BENCH_MAX_SIZE], char *out_player)
+{
+    int size = (int)strcspn(text, "/");
+    if (size < 1 || size > BENCH_MAX_SIZE || parseBoardText(text, size, out_cells, out_player) != 0)
+        return 0;
+    return size;
+}
+
+/* Fold one value into an FNV-1a hash. */
+static uint64_t hashValue(uint64_t hash, int value)
+{
+    uint32_t bits = (uint32_t)value;
+    for (int i = 0; i < 4; ++i)
+    {
+        hash ^= (bits >> (8 * i)) & 0xFF;
+        hash *= 0x100000001B3ULL;
+    }
+    return hash;
+}
+
+/*
+ * Whether `config` searches every position to the same answer as the
+ * kernel's defaults: threads, table size, symmetry and the root driver only
+ * change the work, but depth, node, time and candidate limits may change the
+ * move or score.
+ */
+static int hasDefaultLimits(const BoardKernel *kernel, const MiniMaxConfig *config)
+{
+    MiniMaxConfig defaults;
+    kernel->defaultConfig(&defaults);
+    return config->maxDepth == defaults.maxDepth && config->maxNodes == defaults.maxNodes
+        && config->moveTimeMs == defaults.moveTimeMs && config->solveEmpties == defaults.solveEmpties
+        && config->evalDepth == defaults.evalDepth && config->candidateRadius == defaults.candidateRadius;
+}
+
+int runBenchmark(const MiniMaxConfig *config)
+{
+    MiniMaxConfig benchConfig = *config;
+    benchConfig.usePerfectTable = 0;
+    benchConfig.tablebase = NULL;
+    benchConfig.solvedCache = NULL;
+
+    const BoardKernel *kernel = NULL;
+    MiniMaxEngine *engine = NULL;
+    uint64_t signature = 0xCBF29CE484222325ULL;
+    unsigned long long totalNodes = 0;
+    double totalSeconds = 0.0;
+    int searched = 0;
+    int status = 0;
+
+    printf("%-4s %-5s %-9s %-20s %-8s %6s %10s %10s %12s\n",
+           "#", "board", "kind", "position", "move c,r", "score", "nodes", "time ms", "nodes/s");
+
+    for (int i = 0; i < BENCH_POSITION_COUNT; ++i)
+    {
+        const BenchPosition *position = &benchSuite[i];
+        char cells[BENCH_MAX_SIZE * BENCH_MAX_SIZE];
+        char player;
+        int size = parsePosition(position->cells, cells, &player);
+        if (size == 0)
+        {
+            fprintf(stderr, "Invalid benchmark position %d: %s\n", i + 1, position->cells);
+            status = 1;
+            break;
+        }
+
+        if (kernel == NULL || kernel->size != size)
+        {
+            if (engine != NULL)
+                kernel->destroyEngine(engine);
+            engine = NULL;
+            kernel = findBoardKernel(size);
+            if (kernel == NULL)
+            {
+                printf("%-4d %dx%d   skipped (size not built)\n", i + 1, size, size);
+                continue;
+            }
+            engine = kernel->createEngine(&benchConfig);
+            if (engine == NULL)
+            {
+                fprintf(stderr, "Could not create the search engine.\n");
+                status = 1;
+                break;
+            }
+        }
+
+        struct timespec startTime;
+        struct timespec endTime;
+        MoveResult result;
+        kernel->clearEngineCache(engine);
+        clock_gettime(CLOCK_MONOTONIC, &startTime);
+        kernel->getAiMove(engine, cells, player, &result);
+        clock_gettime(CLOCK_MONOTONIC, &endTime);
+
+        if (result.row < 0)
+        {
+            fprintf(stderr, "Benchmark position %d is already decided: %s\n", i + 1, position->cells);
+            status = 1;
+            break;
+        }
+
+        double seconds = (endTime.tv_sec - startTime.tv_sec) + (endTime.tv_nsec - startTime.tv_nsec) / 1e9;
+        double rate = seconds > 0 ? result.counters.nodes / seconds : 0.0;
+        char board[32];
+        char move[32];
+        snprintf(board, sizeof(board), "%dx%d", size, size);
+        snprintf(move, sizeof(move), "%c %d,%d", player, result.col + 1, result.row + 1);
+        printf("%-4d %-5s %-9s %-20s %-8s %6d %10llu %10.3f %12.0f\n", i + 1, board, position->kind,
+               position->cells, move, result.score, result.counters.nodes, seconds * 1e3, rate);
+
+        signature = hashValue(signature, size);
+        signature = hashValue(signature, result.row * size + result.col);
+        signature = hashValue(signature, result.score);
+        totalNodes += result.counters.nodes;
+        totalSeconds += seconds;
+        ++searched;
+    }
+
+    if (engine != NULL)
+        kernel->destroyEngine(engine);
+
+    if (status == 0)
+    {
+        printf("Positions: %d, nodes: %llu, time: %.3f s, nodes/s: %.0f\n", searched, totalNodes, totalSeconds,
+               totalSeconds > 0 ? totalNodes / totalSeconds : 0.0);
+        printf("Signature: %016llx\n", (unsigned long long)signature);
+        if (searched < BENCH_POSITION_COUNT || !hasDefaultLimits(kernel, config))
+        {
+            printf("Signature not checked (sizes skipped or search limits changed)\n");
+        }
+        else if (signature != BENCH_SIGNATURE)
+        {
+            fprintf(stderr, "Signature mismatch: expected %016llx\n", BENCH_SIGNATURE);
+            status = 1;
+        }
+    }
+    return status;
+}
+
+int runPlayoutBenchmark(const MiniMaxConfig *config, int size)
+{
+    const BoardKernel *kernel = findBoardKernel(size);
+    if (kernel == NULL || size > BENCH_MAX_SIZE)
+    {
+        fprintf(stderr, "Board size %d was not built.\n", size);
+        return 1;
+    }
+
+    MiniMaxConfig benchConfig = *config;
+    benchConfig.backend = SEARCH_BACKEND_MCTS;
+    if (benchConfig.maxPlayouts == 0 && benchConfig.moveTimeMs <= 0)
+        benchConfig.moveTimeMs = PLAYOUT_BENCH_DEFAULT_MS;
+
+    char cells[BENCH_MAX_SIZE * BENCH_MAX_SIZE];
+    memset(cells, ' ', sizeof(cells));
+    double baseRate = 0.0;
+
+    printf("MCTS playouts on the empty %dx%d board, %s playouts, cores online: %ld\n", size, size,
+           benchConfig.lightPlayouts ? "light" : "random", sysconf(_SC_NPROCESSORS_ONLN));
+    printf("%7s %12s %10s %12s %12s %8s %10s\n", "threads", "playouts", "time ms", "playouts/s", "per thread", "speedup", "efficiency");
+
+    for (int threads = 1; threads <= PLAYOUT_BENCH_MAX_THREADS; threads *= 2)
+    {
+        benchConfig.searchThreads = threads;
+        MiniMaxEngine *engine = kernel->createEngine(&benchConfig);
+        if (engine == NULL)
+        {
+            fprintf(stderr, "Could not create the search engine with %d threads.\n", threads);
+            return 1;
+        }
+
+        struct timespec startTime;
+        struct timespec endTime;
+        MoveResult result;
+        clock_gettime(CLOCK_MONOTONIC, &startTime);
+        kernel->getAiMove(engine, cells, 'x', &result);
+        clock_gettime(CLOCK_MONOTONIC, &endTime);
+        kernel->destroyEngine(engine);
+
+        double seconds = (endTime.tv_sec - startTime.tv_sec) + (endTime.tv_nsec - startTime.tv_nsec) / 1e9;
+        double rate = seconds > 0 ? result.counters.playouts / seconds : 0.0;
+        if (threads == 1)
+            baseRate = rate;
+        double speedup = baseRate > 0 ? rate / baseRate : 0.0;
+        printf("%7d %12llu %10.3f %12.0f %12.0f %8.2f %9.0f%%\n", threads, result.counters.playouts, seconds * 1e3,
+               rate, rate / threads, speedup, 100.0 * speedup / threads);
+    }
+    return 0;
+}
@@ -0,0 +1,51 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+/*
+ * Position benchmark
+ * ------------------
+ * A fixed suite of openings, midgames and tactical positions on 3x3 and 4x4
+ * boards, searched one by one through the board-size kernels. Each position
+ * starts from an empty transposition table, so its result does not depend on
+ * the positions before it.
+ *
+ * The Monte Carlo backend has its own benchmark: playout throughput and how
+ * it scales with threads.
+ */
+
+#include "../MiniMax/mini_max.h"
+
+/**
+ * Search every suite position whose board size was built and print, per
+ * position, the move, score, nodes, time and nodes per second, then the
+ * totals and a signature of all moves and scores.
+ *
+ * `config` applies to every size. The perfect-play table, tablebase and
+ * solved-position cache are bypassed, so every position is searched. With the default (serial, unlimited) options
+ * the moves, scores and node counts are reproducible on any machine.
+ *
+ * Returns 0 on success, 1 if an engine could not be created, a position is
+ * invalid or the signature differs from the expected one. The signature is
+ * only checked when every position was searched with the default search
+ * limits.
+ */
+int runBenchmark(const MiniMaxConfig *config);
+
+/* Thread counts the playout benchmark goes up to, doubling from 1. */
+#define PLAYOUT_BENCH_MAX_THREADS 32
+
+/**
+ * Measure the Monte Carlo backend's playout rate on the empty size x size
+ * board with 1, 2, 4, ... PLAYOUT_BENCH_MAX_THREADS search threads and print,
+ * per thread count, the playouts, playouts per second overall and per thread,
+ * and the speedup and efficiency against one thread.
+ *
+ * `config` applies with the thread count replaced; each run is one move with
+ * its playout or time budget (1 second when neither is set).
+ *
+ * Returns 0 on success, 1 if the size was not built or an engine could not
+ * be created.
+ */
+int runPlayoutBenchmark(const MiniMaxConfig *config, int size);
+
+#endif
@@ -0,0 +1,424 @@
+/*
+ * Board-size kernel instantiation
+ * -------------------------------
+ * Compiled once per supported size with -DBOARD_KERNEL=N (see board_kernel.h).
+ *
+ * Responsibilities in this file:
+ *  - Adapt the fixed-size engine and solver APIs to the flat boards of the
+ *    BoardKernel table
+ *  - Interactive human vs AI loop on the global game state
+ *  - Self-play benchmarking over threads, one GameState and engine each
+ *  - Search statistics reports for --stats and move analysis for --analyze
+ *  - Export this size's table as boardKernel (renamed boardKernel_N)
+ */
+
+#define _POSIX_C_SOURCE 199309L
+#include "board_kernel.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifndef BOARD_KERNEL
+#error "board_kernel.c must be compiled with -DBOARD_KERNEL=N"
+#endif
+
+/* getAiMoveEx on a flat row-major board. */
+static int getAiMoveFlat(MiniMaxEngine *engine, const char *cells, char aiPlayer, MoveResult *out_result)
+{
+    if (cells == NULL)
+        return -1;
+
+    char grid[BOARD_ROWS][BOARD_COLS];
+    memcpy(grid, cells, sizeof(grid));
+    return getAiMoveEx(engine, grid, aiPlayer, out_result);
+}
+
+/* getAiMovesBatch on `count` flat row-major boards stored back to back. */
+static int getAiMovesBatchFlat(MiniMaxEngine *engine, const char *cells, const char *players, MoveResult *out_results, size_t count)
+{
+    if (cells == NULL && count > 0)
+        return -1;
+
+    return getAiMovesBatch(engine, (const char(*)[BOARD_ROWS][BOARD_COLS])cells, players, out_results, count);
+}
+
+/* analyzeMovesEx on a flat row-major board. */
+static int analyzeMovesFlat(MiniMaxEngine *engine, const char *cells, char aiPlayer, MoveScore *out_scores, int *out_count)
+{
+    if (cells == NULL)
+        return -1;
+
+    char grid[BOARD_ROWS][BOARD_COLS];
+    memcpy(grid, cells, sizeof(grid));
+    return analyzeMovesEx(engine, grid, aiPlayer, out_scores, out_count);
+}
+
+/* solvePosition on a flat row-major board. */
+static int solvePositionFlat(const char *cells, char player, size_t ttMegabytes, unsigned long long maxNodes, SolveResult *out_result)
+{
+    if (cells == NULL)
+        return -1;
+
+    char grid[BOARD_ROWS][BOARD_COLS];
+    memcpy(grid, cells, sizeof(grid));
+    return solvePosition(grid, player, ttMegabytes, maxNodes, out_result);
+}
+
+/* Pick the AI move for `player` on the given board with the given engine. */
+static void chooseAiMove(MiniMaxEngine *engine, char cells[BOARD_ROWS][BOARD_COLS], char player, int *out_row, int *out_col)
+{
+    MoveResult result;
+    getAiMoveEx(engine, cells, player, &result);
+    *out_row = result.row;
+    *out_col = result.col;
+}
+
+/* Add the statistics of one engine to a running total. */
+static void accumulateStats(SearchStats *total, const SearchStats *stats)
+{
+    total->nodes += stats->nodes;
+    for (int i = 0; i < SEARCH_STATS_PLIES; ++i)
+        total->nodesAtPly[i] += stats->nodesAtPly[i];
+    total->movesSearched += stats->movesSearched;
+    total->cutoffs += stats->cutoffs;
+    for (int i = 0; i < SEARCH_STATS_MOVE_SLOTS; ++i)
+        total->cutoffsAtMove[i] += stats->cutoffsAtMove[i];
+    total->winShortcuts += stats->winShortcuts;
+    total->tieShortcuts += stats->tieShortcuts;
+}
+
+/*
+ * Print search statistics: the effective branching factor (moves tried per
+ * interior node), where in the ordered move list beta cutoffs happen, the
+ * moves settled without a search and the node count of every ply.
+ */
+static void printSearchStats(const SearchStats *stats)
+{
+    double branching = stats->nodes > 0 ? (double)stats->movesSearched / (double)stats->nodes : 0.0;
+    printf("Search stats: %llu nodes, %llu moves tried, branching factor %.2f\n",
+           stats->nodes, stats->movesSearched, branching);
+
+    printf("  Beta cutoffs: %llu, by move", stats->cutoffs);
+    for (int i = 0; i < SEARCH_STATS_MOVE_SLOTS; ++i)
+    {
+        double share = stats->cutoffs > 0 ? 100.0 * (double)stats->cutoffsAtMove[i] / (double)stats->cutoffs : 0.0;
+        printf(" %d%s: %.1f%%", i + 1, i == SEARCH_STATS_MOVE_SLOTS - 1 ? "+" : "", share);
+    }
+    printf("\n  Shortcuts: %llu wins, %llu ties\n", stats->winShortcuts, stats->tieShortcuts);
+
+    printf("  Nodes per ply:");
+    for (int i = 0; i < SEARCH_STATS_PLIES; ++i)
+    {
+        if (stats->nodesAtPly[i] != 0)
+            printf(" %d%s: %llu", i + 1, i == SEARCH_STATS_PLIES - 1 ? "+" : "", stats->nodesAtPly[i]);
+    }
+    printf("\n");
+}
+
+/*
+ * Describe a MoveScore score: a forced result and its distance in plies, or
+ * else "even" (a draw, or a balanced horizon) or the evaluation.
+ */
+static void describeScore(int score, char *out_text, size_t size)
+{
+    if (score > SCORE_EVAL_LIMIT)
+        snprintf(out_text, size, "win in %d", SCORE_WIN - score);
+    else if (score < -SCORE_EVAL_LIMIT)
+        snprintf(out_text, size, "loss in %d", SCORE_WIN + score);
+    else if (score == 0)
+        snprintf(out_text, size, "even");
+    else
+        snprintf(out_text, size, "eval %+d", score);
+}
+
+/* Print the score of every move `player` has, best first, as (col, row) like the prompt. */
+static void printMoveAnalysis(MiniMaxEngine *engine, char cells[BOARD_ROWS][BOARD_COLS], char player)
+{
+    MoveScore scores[MAX_MOVES];
+    int count = 0;
+    if (analyzeMovesEx(engine, cells, player, scores, &count) != 0 || count == 0)
+        return;
+
+    printf("Your moves, best first:\n");
+    for (int i = 0; i < count; ++i)
+    {
+        char text[32];
+        describeScore(scores[i].score, text, sizeof(text));
+        printf("  (%d, %d) %s\n", scores[i].col + 1, scores[i].row + 1, text);
+    }
+}
+
+/*
+ * Interactive human vs AI loop. Prompts the user to choose a symbol, then
+ * alternates between human input and AI selection until the game ends.
+ * With showStats, the search statistics of each AI move follow it; with
+ * showAnalysis, every human turn starts with the scores of all moves.
+ */
+static int playGame(const MiniMaxConfig *config, int showStats, int showAnalysis)
+{
+    MiniMaxEngine *engine = createMiniMaxEngine(config);
+    if (engine == NULL)
+    {
+        fprintf(stderr, "Could not create the search engine.\n");
+        return 1;
+    }
+
+    while (1)
+    {
+        restartGame();
+        choosePlayerSymbol();
+        if (player_turn != ai_symbol)
+            printBoard();
+
+        while (1)
+        {
+            int row, col;
+
+            if (player_turn == human_symbol)
+            {
+                if (showAnalysis)
+                    printMoveAnalysis(engine, board, human_symbol);
+                getMove(&row, &col);
+                makeMove(row, col);
+                GameResult result = checkWinner(row, col);
+
+                if (result != GAME_CONTINUE)
+                {
+                    printGameResult(result);
+                    break;
+                }
+            }
+            else
+            {
+                int ai_row, ai_col;
+                resetEngineCounters(engine);
+                chooseAiMove(engine, board, ai_symbol, &ai_row, &ai_col);
+                makeMove(ai_row, ai_col);
+                printf("AI plays (%d, %d)\n", ai_col + 1, ai_row + 1);
+                if (showStats)
+                {
+                    SearchStats stats;
+                    getEngineStats(engine, &stats);
+                    printSearchStats(&stats);
+                }
+                GameResult result = checkWinner(ai_row, ai_col);
+
+                if (result != GAME_CONTINUE)
+                {
+                    printGameResult(result);
+                    break;
+                }
+                else
+                {
+                    printBoard();
+                }
+            }
+        }
+
+        if (!askRestart())
+            break;
+    }
+
+    destroyMiniMaxEngine(engine);
+    return 0;
+}
+
+/* One thread's share of a self-play run and its results. */
+typedef struct
+{
+    int gameCount;
+    int ai1Wins;
+    int ai2Wins;
+    int ties;
+    MiniMaxEngine *engine;
+} SelfPlayShard;
+
+/* Play shard->gameCount AI vs AI games on a private GameState and engine. */
+static void *playSelfPlayShard(void *arg)
+{
+    SelfPlayShard *shard = arg;
+    GameState state = {0};
+
+    for (int g = 0; g < shard->gameCount; ++g)
+    {
+        restartGameState(&state);
+
+        while (1)
+        {
+            int currentRow = -1;
+            int currentCol = -1;
+            char currentPlayer = state.player_turn;
+
+            chooseAiMove(shard->engine, state.board, currentPlayer, &currentRow, &currentCol);
+            makeMoveState(&state, currentRow, currentCol);
+            GameResult result = checkWinnerState(&state, currentRow, currentCol);
+
+            if (result != GAME_CONTINUE)
+            {
+                if (result == GAME_TIE)
+                    ++shard->ties;
+                else if (currentPlayer == 'x')
+                    ++shard->ai1Wins;
+                else
+                    ++shard->ai2Wins;
+                break;
+            }
+        }
+    }
+
+    return NULL;
+}
+
+/*
+ * Self-play benchmarking: runs gameCount AI vs AI games starting from an empty
+ * board, alternating turns. Games are split evenly over threadCount threads,
+ * each with its own GameState and MiniMaxEngine, so shards share no state.
+ * Collects win/tie stats and (optionally) prints timing, throughput and
+ * search node counts.
+ *
+ * Parameters:
+ *  - config:      engine configuration for every shard
+ *  - gameCount:   number of games to run
+ *  - quiet:       when non-zero, suppress timing output
+ *  - threadCount: number of threads to shard the games over (>= 1)
+ *  - showStats:   when non-zero, print the search statistics of all games
+ */
+static int selfPlay(const MiniMaxConfig *config, int gameCount, int quiet, int threadCount, int showStats)
+{
+    struct timespec startTime;
+    struct timespec endTime;
+
+    if (threadCount < 1)
+        threadCount = 1;
+    if (threadCount > gameCount && gameCount > 0)
+        threadCount = gameCount;
+
+    SelfPlayShard *shards = calloc((size_t)threadCount, sizeof(SelfPlayShard));
+    pthread_t *threads = calloc((size_t)threadCount, sizeof(pthread_t));
+    if (shards == NULL || threads == NULL)
+    {
+        fprintf(stderr, "Out of memory.\n");
+        free(shards);
+        free(threads);
+        return 1;
+    }
+
+    for (int t = 0; t < threadCount; ++t)
+    {
+        shards[t].gameCount = gameCount / threadCount + (t < gameCount % threadCount ? 1 : 0);
+        shards[t].engine = createMiniMaxEngine(config);
+        if (shards[t].engine == NULL)
+        {
+            fprintf(stderr, "Could not create the search engine.\n");
+            for (int u = 0; u < t; ++u)
+                destroyMiniMaxEngine(shards[u].engine);
+            free(shards);
+            free(threads);
+            return 1;
+        }
+    }
+
+    if (!quiet)
+        clock_gettime(CLOCK_MONOTONIC, &startTime);
+
+    /* shard 0 runs on the calling thread */
+    int started = 1;
+    for (; started < threadCount; ++started)
+    {
+        if (pthread_create(&threads[started], NULL, playSelfPlayShard, &shards[started]) != 0)
+            break;
+    }
+    for (int t = started; t < threadCount; ++t)
+    {
+        shards[0].gameCount += shards[t].gameCount;
+        shards[t].gameCount = 0;
+    }
+
+    playSelfPlayShard(&shards[0]);
+
+    int ai1Wins = shards[0].ai1Wins;
+    int ai2Wins = shards[0].ai2Wins;
+    int ties = shards[0].ties;
+    for (int t = 1; t < started; ++t)
+    {
+        pthread_join(threads[t], NULL);
+        ai1Wins += shards[t].ai1Wins;
+        ai2Wins += shards[t].ai2Wins;
+        ties += shards[t].ties;
+    }
+
+    if (!quiet)
+    {
+        clock_gettime(CLOCK_MONOTONIC, &endTime);
+        double elapsed = (endTime.tv_sec - startTime.tv_sec) + (endTime.tv_nsec - startTime.tv_nsec) / 1e9;
+        double throughput = elapsed > 0 ? (gameCount / elapsed) : 0.0;
+        printf("Self-play finished: %d games. AI1Wins=%d AI2Wins=%d Ties=%d\n", gameCount, ai1Wins, ai2Wins, ties);
+        printf("Elapsed: %.3f s, Throughput: %.1f games/s, Threads: %d\n", elapsed, throughput, started);
+
+        SearchCounters searchCounters = {0};
+        for (int t = 0; t < threadCount; ++t)
+        {
+            SearchCounters shardCounters;
+            getEngineCounters(shards[t].engine, &shardCounters);
+            searchCounters.nodes += shardCounters.nodes;
+            searchCounters.tableHits += shardCounters.tableHits;
+            searchCounters.symmetricHits += shardCounters.symmetricHits;
+            searchCounters.playouts += shardCounters.playouts;
+        }
+        if (config->backend == SEARCH_BACKEND_MCTS)
+        {
+            /* every game thread drives searchThreads threads of its own */
+            int searchThreads = started * (config->searchThreads > 1 ? config->searchThreads : 1);
+            double playoutRate = elapsed > 0 ? searchCounters.playouts / elapsed : 0.0;
+            printf("Playouts: %llu, %.0f playouts/s, %.0f per thread (%d threads), tree nodes: %llu\n",
+                   searchCounters.playouts, playoutRate, playoutRate / searchThreads, searchThreads, searchCounters.nodes);
+        }
+        else
+        {
+            printf("Search nodes: %llu, table hits: %llu (%llu via symmetric positions)\n",
+                   searchCounters.nodes, searchCounters.tableHits, searchCounters.symmetricHits);
+        }
+    }
+
+    if (showStats)
+    {
+        SearchStats searchStats = {0};
+        for (int t = 0; t < threadCount; ++t)
+        {
+            SearchStats shardStats;
+            getEngineStats(shards[t].engine, &shardStats);
+            accumulateStats(&searchStats, &shardStats);
+        }
+        printSearchStats(&searchStats);
+    }
+
+    for (int t = 0; t < threadCount; ++t)
+        destroyMiniMaxEngine(shards[t].engine);
+    free(shards);
+    free(threads);
+    return 0;
+}
+
+const BoardKernel boardKernel = {
+    .size = BOARD_SIZE,
+    .defaultConfig = defaultMiniMaxConfig,
+    .createEngine = createMiniMaxEngine,
+    .destroyEngine = destroyMiniMaxEngine,
+    .getAiMove = getAiMoveFlat,
+    .getAiMovesBatch = getAiMovesBatchFlat,
+    .analyzeMoves = analyzeMovesFlat,
+    .getEngineCounters = getEngineCounters,
+    .getEngineStats = getEngineStats,
+    .resetEngineCounters = resetEngineCounters,
+    .clearEngineCache = clearEngineCache,
+    .playGame = playGame,
+    .selfPlay = selfPlay,
+    .buildTablebase = buildTablebase,
+    .openTablebase = openTablebase,
+    .closeTablebase = closeTablebase,
+    .openSolvedCache = openSolvedCache,
+    .closeSolvedCache = closeSolvedCache,
+    .solvePosition = solvePositionFlat,
+};
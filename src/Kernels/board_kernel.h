@@ -0,0 +1,88 @@
+#ifndef BOARD_KERNEL_H
+#define BOARD_KERNEL_H
+
+/*
+ * Board-size kernels
+ * ------------------
+ * The engine is specialized for one board size at compile time: bitboard
+ * widths, line tables and every inner loop bound are constants. To serve
+ * several sizes from one binary, the game helpers, the engine, the tablebase,
+ * the solved-position cache, the proof-number solver and board_kernel.c are
+ * compiled once per size with -DBOARD_KERNEL=N (see the Makefile). Each instantiation exports one BoardKernel table; callers
+ * pick the table for a size once and call through it, so each call pays one
+ * indirect jump and the search itself is the fixed-size code.
+ *
+ * Boards cross the table as flat row-major arrays of size * size cells
+ * ('x', 'o' or ' '); a batch is `count` such boards back to back. Engines are
+ * only valid with the kernel that created them.
+ */
+
+#include "../MiniMax/mini_max.h"
+#include "../ProofSearch/proof_search.h"
+
+/* Sizes built when the Makefile does not pass its own list (KERNEL_SIZES). */
+#ifndef BOARD_KERNEL_SIZES
+#define BOARD_KERNEL_SIZES(X) X(3) X(4) X(5) X(6) X(7) X(8)
+#endif
+
+/** Entry points of one board size. */
+typedef struct
+{
+    int size; /* the board is size x size */
+
+    /* Search engine on flat boards; see the MiniMaxEngine API in mini_max.h. */
+    void (*defaultConfig)(MiniMaxConfig *out_config);
+    MiniMaxEngine *(*createEngine)(const MiniMaxConfig *config);
+    void (*destroyEngine)(MiniMaxEngine *engine);
+    int (*getAiMove)(MiniMaxEngine *engine, const char *cells, char aiPlayer, MoveResult *out_result);
+    int (*getAiMovesBatch)(MiniMaxEngine *engine, const char *cells, const char *players, MoveResult *out_results, size_t count);
+    int (*analyzeMoves)(MiniMaxEngine *engine, const char *cells, char aiPlayer, MoveScore *out_scores, int *out_count);
+    void (*getEngineCounters)(const MiniMaxEngine *engine, SearchCounters *out_counters);
+    void (*getEngineStats)(const MiniMaxEngine *engine, SearchStats *out_stats);
+    void (*resetEngineCounters)(MiniMaxEngine *engine);
+    void (*clearEngineCache)(MiniMaxEngine *engine);
+
+    /*
+     * CLI modes; each engine they create uses `config`. showStats prints
+     * SearchStats; showAnalysis scores the human's moves before each turn.
+     */
+    int (*playGame)(const MiniMaxConfig *config, int showStats, int showAnalysis);
+    int (*selfPlay)(const MiniMaxConfig *config, int gameCount, int quiet, int threadCount, int showStats);
+
+    /* Tablebase of this size; see tablebase.h. */
+    int (*buildTablebase)(const char *path);
+    Tablebase *(*openTablebase)(const char *path);
+    void (*closeTablebase)(Tablebase *tablebase);
+
+    /* Solved-position cache of this size; see solved_cache.h. */
+    SolvedCache *(*openSolvedCache)(const char *path, int candidateRadius, int readOnly);
+    int (*closeSolvedCache)(SolvedCache *cache);
+
+    /* Proof-number solver on flat boards; see proof_search.h. */
+    int (*solvePosition)(const char *cells, char player, size_t ttMegabytes, unsigned long long maxNodes, SolveResult *out_result);
+} BoardKernel;
+
+#ifdef BOARD_KERNEL
+/** The table of the size being compiled (boardKernel_N after renaming). */
+extern const BoardKernel boardKernel;
+#endif
+
+/** Every built kernel in ascending size order, terminated by NULL. */
+extern const BoardKernel *const boardKernels[];
+
+/** Kernel for a size x size board, or NULL if that size was not built. */
+const BoardKernel *findBoardKernel(int size);
+
+/**
+ * Parse a board written row by row as 'x', 'o' and '.' (empty), with '/'
+ * allowed between rows, into size * size flat cells. out_cells may be `text`
+ * itself, so a field can be converted in place.
+ *
+ * Unless out_player is NULL, it gets the side to move from the stone counts
+ * ('x' moves first), and counts no game reaches are rejected.
+ *
+ * Returns 0 on success, -1 if the text is not a size x size board.
+ */
+int parseBoardText(const char *text, int size, char *out_cells, char *out_player);
+
+#endif
@@ -0,0 +1,80 @@
+/*
+ * Per-size symbol names for board-size kernels
+ * --------------------------------------------
+ * Included by tic_tac_toe.h when a source is compiled with -DBOARD_KERNEL=N.
+ * Every external symbol of the game helpers, the engine, the tablebase, the
+ * solved-position cache, the proof-number solver and the kernel table gets an
+ * _N suffix (getAiMoveEx -> getAiMoveEx_4), so the same sources compiled for
+ * several sizes link into one binary.
+ *
+ * A new public function or global of those modules must be added here.
+ */
+
+#ifndef KERNEL_NAMES_H
+#define KERNEL_NAMES_H
+
+#define KERNEL_NAME_PASTE(name, size) name##_##size
+#define KERNEL_NAME_EXPAND(name, size) KERNEL_NAME_PASTE(name, size)
+#define KERNEL_NAME(name) KERNEL_NAME_EXPAND(name, BOARD_KERNEL)
+
+/* TicTacToe/tic_tac_toe.h */
+#define board KERNEL_NAME(board)
+#define player_turn KERNEL_NAME(player_turn)
+#define move_count KERNEL_NAME(move_count)
+#define human_symbol KERNEL_NAME(human_symbol)
+#define ai_symbol KERNEL_NAME(ai_symbol)
+#define initializeBoard KERNEL_NAME(initializeBoard)
+#define printBoard KERNEL_NAME(printBoard)
+#define printGameResult KERNEL_NAME(printGameResult)
+#define getMove KERNEL_NAME(getMove)
+#define makeMove KERNEL_NAME(makeMove)
+#define checkWinner KERNEL_NAME(checkWinner)
+#define restartGame KERNEL_NAME(restartGame)
+#define makeMoveState KERNEL_NAME(makeMoveState)
+#define checkWinnerState KERNEL_NAME(checkWinnerState)
+#define restartGameState KERNEL_NAME(restartGameState)
+#define askRestart KERNEL_NAME(askRestart)
+#define choosePlayerSymbol KERNEL_NAME(choosePlayerSymbol)
+
+/* MiniMax/mini_max.h */
+#define getAiMove KERNEL_NAME(getAiMove)
+#define getAiMoveTimed KERNEL_NAME(getAiMoveTimed)
+#define setTranspositionTableSize KERNEL_NAME(setTranspositionTableSize)
+#define setSearchThreads KERNEL_NAME(setSearchThreads)
+#define clearTranspositionTable KERNEL_NAME(clearTranspositionTable)
+#define setSymmetryCache KERNEL_NAME(setSymmetryCache)
+#define getSearchCounters KERNEL_NAME(getSearchCounters)
+#define resetSearchCounters KERNEL_NAME(resetSearchCounters)
+#define getSearchStats KERNEL_NAME(getSearchStats)
+#define defaultMiniMaxConfig KERNEL_NAME(defaultMiniMaxConfig)
+#define createMiniMaxEngine KERNEL_NAME(createMiniMaxEngine)
+#define destroyMiniMaxEngine KERNEL_NAME(destroyMiniMaxEngine)
+#define configureMiniMaxEngine KERNEL_NAME(configureMiniMaxEngine)
+#define getAiMoveEx KERNEL_NAME(getAiMoveEx)
+#define getAiMovesBatch KERNEL_NAME(getAiMovesBatch)
+#define analyzeMoves KERNEL_NAME(analyzeMoves)
+#define analyzeMovesEx KERNEL_NAME(analyzeMovesEx)
+#define clearEngineCache KERNEL_NAME(clearEngineCache)
+#define getEngineCounters KERNEL_NAME(getEngineCounters)
+#define getEngineStats KERNEL_NAME(getEngineStats)
+#define resetEngineCounters KERNEL_NAME(resetEngineCounters)
+
+/* Tablebase/tablebase.h */
+#define buildTablebase KERNEL_NAME(buildTablebase)
+#define openTablebase KERNEL_NAME(openTablebase)
+#define closeTablebase KERNEL_NAME(closeTablebase)
+#define probeTablebase KERNEL_NAME(probeTablebase)
+
+/* SolvedCache/solved_cache.h */
+#define openSolvedCache KERNEL_NAME(openSolvedCache)
+#define probeSolvedCache KERNEL_NAME(probeSolvedCache)
+#define recordSolvedCache KERNEL_NAME(recordSolvedCache)
+#define closeSolvedCache KERNEL_NAME(closeSolvedCache)
+
+/* ProofSearch/proof_search.h */
+#define solvePosition KERNEL_NAME(solvePosition)
+
+/* Kernels/board_kernel.h */
+#define boardKernel KERNEL_NAME(boardKernel)
+
+#endif
@@ -0,0 +1,54 @@
+/*
+ * Registry of the board-size kernels linked into the program, and the board
+ * text format shared by the CLI, the benchmark and the server.
+ * Compiled once, without BOARD_KERNEL; the Makefile passes the built sizes
+ * through BOARD_KERNEL_SIZES.
+ */
+
+#include "board_kernel.h"
+#include <stddef.h>
+
+#define DECLARE_KERNEL(size) extern const BoardKernel boardKernel_##size;
+BOARD_KERNEL_SIZES(DECLARE_KERNEL)
+#undef DECLARE_KERNEL
+
+#define LIST_KERNEL(size) &boardKernel_##size,
+const BoardKernel *const boardKernels[] = {BOARD_KERNEL_SIZES(LIST_KERNEL) NULL};
+#undef LIST_KERNEL
+
+const BoardKernel *findBoardKernel(int size)
+{
+    for (int i = 0; boardKernels[i] != NULL; ++i)
+    {
+        if (boardKernels[i]->size == size)
+            return boardKernels[i];
+    }
+    return NULL;
+}
+
+int parseBoardText(const char *text, int size, char *out_cells, char *out_player)
+{
+    int count = 0;
+    int xCount = 0;
+    int oCount = 0;
+    for (const char *symbol = text; *symbol != '\0'; ++symbol)
+    {
+        if (*symbol == '/')
+            continue;
+        if ((*symbol != 'x' && *symbol != 'o' && *symbol != '.') || count == size * size)
+            return -1;
+        xCount += *symbol == 'x';
+        oCount += *symbol == 'o';
+        out_cells[count++] = *symbol == '.' ? ' ' : *symbol;
+    }
+
+    if (count != size * size)
+        return -1;
+    if (out_player != NULL)
+    {
+        if (xCount != oCount && xCount != oCount + 1)
+            return -1;
+        *out_player = xCount == oCount ? 'x' : 'o';
+    }
+    return 0;
+}
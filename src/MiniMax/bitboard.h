@@ -0,0 +1,154 @@
+/*
+ * Bitboard helpers for the Minimax engine
+ * ---------------------------------------
+ * A position is stored as one bitmask per player, with bit (row * BOARD_COLS + col)
+ * set when that player occupies the cell. The mask spans as many 64-bit words as
+ * MAX_MOVES requires, so every board up to 8x8 fits in a single word and the
+ * helpers below compile down to plain integer operations.
+ *
+ * Internal to the engine; not part of the public API.
+ */
+
+#ifndef BITBOARD_H
+#define BITBOARD_H
+
+#include <stdint.h>
+#include "../TicTacToe/tic_tac_toe.h"
+
+#define BITBOARD_WORDS ((MAX_MOVES + 63) / 64)
+
+/* Vertical neighbours are one row (BOARD_COLS bits) apart; shifts stay below a word. */
+#if BOARD_COLS >= 64
+#error "bitboards support at most 63 columns"
+#endif
+
+typedef struct
+{
+    uint64_t words[BITBOARD_WORDS];
+} Bitboard;
+
+/* Bitboard with no cells set. */
+static inline Bitboard bitboardEmpty(void)
+{
+    Bitboard result;
+    for (int w = 0; w < BITBOARD_WORDS; ++w)
+        result.words[w] = 0;
+    return result;
+}
+
+/* Bitboard with every cell of the board set. */
+static inline Bitboard bitboardFull(void)
+{
+    Bitboard result;
+    for (int w = 0; w < BITBOARD_WORDS; ++w)
+    {
+        int bits = MAX_MOVES - w * 64;
+        result.words[w] = bits >= 64 ? ~(uint64_t)0 : (((uint64_t)1 << bits) - 1);
+    }
+    return result;
+}
+
+/* Flip a single cell; used for both make and unmake. */
+static inline void bitboardToggle(Bitboard *board, int cell)
+{
+    board->words[cell >> 6] ^= (uint64_t)1 << (cell & 63);
+}
+
+/* Non-zero if the cell is set. */
+static inline int bitboardTest(Bitboard board, int cell)
+{
+    return (int)((board.words[cell >> 6] >> (cell & 63)) & 1);
+}
+
+static inline Bitboard bitboardOr(Bitboard a, Bitboard b)
+{
+    for (int w = 0; w < BITBOARD_WORDS; ++w)
+        a.words[w] |= b.words[w];
+    return a;
+}
+
+static inline Bitboard bitboardAnd(Bitboard a, Bitboard b)
+{
+    for (int w = 0; w < BITBOARD_WORDS; ++w)
+        a.words[w] &= b.words[w];
+    return a;
+}
+
+/* Cells set in a but not in b. */
+static inline Bitboard bitboardAndNot(Bitboard a, Bitboard b)
+{
+    for (int w = 0; w < BITBOARD_WORDS; ++w)
+        a.words[w] &= ~b.words[w];
+    return a;
+}
+
+/* Non-zero if every cell of mask is also set in board. */
+static inline int bitboardContains(Bitboard board, Bitboard mask)
+{
+    for (int w = 0; w < BITBOARD_WORDS; ++w)
+    {
+        if ((board.words[w] & mask.words[w]) != mask.words[w])
+            return 0;
+    }
+    return 1;
+}
+
+static inline int bitboardIsEmpty(Bitboard board)
+{
+    for (int w = 0; w < BITBOARD_WORDS; ++w)
+    {
+        if (board.words[w] != 0)
+            return 0;
+    }
+    return 1;
+}
+
+static inline int bitboardCount(Bitboard board)
+{
+    int count = 0;
+    for (int w = 0; w < BITBOARD_WORDS; ++w)
+        count += __builtin_popcountll(board.words[w]);
+    return count;
+}
+
+/*
+ * Move every cell `bits` positions up (towards higher cell indices), for
+ * 0 < bits < 64. Bits pushed past the last word are dropped; callers mask off
+ * cells beyond MAX_MOVES and any wrap between rows.
+ */
+static inline Bitboard bitboardShiftUp(Bitboard board, int bits)
+{
+    for (int w = BITBOARD_WORDS - 1; w > 0; --w)
+        board.words[w] = (board.words[w] << bits) | (board.words[w - 1] >> (64 - bits));
+    board.words[0] <<= bits;
+    return board;
+}
+
+/* Move every cell `bits` positions down (towards lower cell indices), for 0 < bits < 64. */
+static inline Bitboard bitboardShiftDown(Bitboard board, int bits)
+{
+    for (int w = 0; w < BITBOARD_WORDS - 1; ++w)
+        board.words[w] = (board.words[w] >> bits) | (board.words[w + 1] << (64 - bits));
+    board.words[BITBOARD_WORDS - 1] >>= bits;
+    return board;
+}
+
+/*
+ * Remove and return the lowest set cell (row-major order), or -1 when empty.
+ * Iterating with this visits cells in the same order as a row-major scan.
+ */
+static inline int bitboardPopLowest(Bitboard *board)
+{
+    for (int w = 0; w < BITBOARD_WORDS; ++w)
+    {
+        uint64_t word = board->words[w];
+        if (word != 0)
+        {
+            board->words[w] = word & (word - 1);
+            return w * 64 + __builtin_ctzll(word);
+        }
+    }
+    return -1;
+}
+
+#endif
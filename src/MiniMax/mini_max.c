@@ -3,510 +3,2900 @@
  * -------------------------------------------------------
  *
  * This file implements a deterministic Minimax engine with:
- *  - Alpha–beta pruning
+ *  - Bitboard position representation (one occupancy mask per player)
+ *  - Negamax alpha–beta search with principal variation (null-window) search
+ *  - Zobrist-hashed transposition table (exact/lower/upper bounds, best move)
+ *  - Symmetry-canonical table keys: the 8 rotations/reflections share entries
+ *    (the 4 that keep a rectangular board in place)
+ *  - Windowed k-in-a-row wins on rectangular boards (m,n,k games)
  *  - Lightweight move ordering (center > diagonals/adjacent > others)
+ *  - Neighbourhood-restricted candidate moves for large k-in-a-row boards
  *  - Early cutoffs via last-move win checks and last-move tie shortcut
  *  - Depth-adjusted terminal scoring (prefer faster wins, delay losses)
+ *  - Depth-limited search with a line-potential evaluation for large boards
  *  - Simple opening heuristic: play center on empty board
+ *  - Time-budgeted iterative deepening (getAiMoveTimed)
+ *  - Optional parallel root search over a pthread worker pool
+ *  - Batches of positions, deduplicated and spread over the same pool
+ *  - Multi-PV analysis: exact scores for every root move (analyzeMoves)
+ *  - Build-time perfect-play table for 3x3 (see perfect_table_gen.c)
+ *  - Optional memory-mapped retrograde tablebase for boards up to 4x4
+ *  - Optional persistent cache of solved root positions (solved_cache.c)
+ *  - Monte Carlo tree search backend: UCT over a node arena, random or light
+ *    playouts, threads sharing one tree through virtual loss
  *
- * Public entry point: getAiMove(...)
+ * Public entry points: getAiMoveEx(...), getAiMovesBatch(...) and
+ * analyzeMovesEx(...) on a MiniMaxEngine, and the classic
+ * getAiMove(...), getAiMoveTimed(...), analyzeMoves(...) on a shared default
+ * engine
  */
 
+#define _POSIX_C_SOURCE 199309L
 #include "mini_max.h"
+#include "bitboard.h"
 #include <limits.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
 
-/* A single board coordinate (row, col). */
+/*
+ * Winning lines are the windows of WIN_LENGTH consecutive cells in each row,
+ * column and diagonal direction. With WIN_LENGTH equal to the board side these
+ * are just the rows, columns and the two long diagonals.
+ */
+#define WINDOW_STARTS(length) ((length) - WIN_LENGTH + 1)
+#define NUM_LINES (BOARD_ROWS * WINDOW_STARTS(BOARD_COLS) +       \
+                   BOARD_COLS * WINDOW_STARTS(BOARD_ROWS) +       \
+                   2 * WINDOW_STARTS(BOARD_ROWS) * WINDOW_STARTS(BOARD_COLS))
+
+/* Each cell lies in at most WIN_LENGTH windows per direction. */
+#define MAX_CELL_LINES (4 * WIN_LENGTH)
+
+/* Player indices into Position.stones. */
+enum
+{
+    SIDE_X = 0,
+    SIDE_O = 1
+};
+
+/*
+ * Rotations and reflections of the board: the dihedral group D4 on a square
+ * board, only the identity, the half turn and the two mirrors on a rectangle.
+ */
+#if BOARD_ROWS == BOARD_COLS
+#define SYMMETRY_COUNT 8
+#else
+#define SYMMETRY_COUNT 4
+#endif
+
+/*
+ * Search position: one occupancy bitboard per player plus the Zobrist hash of
+ * the position seen through each board symmetry (hashes[0] is the identity).
+ * Per-line stone counts, the list of empty cells and the raw line-potential
+ * score are kept in step with every move, so win and tie detection, move
+ * generation and the static evaluation never rescan the board.
+ */
+typedef struct
+{
+    Bitboard stones[2];
+    uint64_t hashes[SYMMETRY_COUNT];
+    int symmetryCount; /* orientations kept up to date: SYMMETRY_COUNT, or 1 when sharing is off */
+    uint8_t lineCounts[2][NUM_LINES]; /* stones of each player on each line */
+    int empties;
+    int emptyNext[MAX_MOVES + 1]; /* empty cells linked in static move order; */
+    int emptyPrev[MAX_MOVES + 1]; /* index MAX_MOVES is the list head */
+    int lineScore; /* open-line potential from 'x''s point of view (see evaluatePosition) */
+} Position;
+
+/* Remaining-depth budget that means "search to the end of the game". */
+#define FULL_DEPTH MAX_MOVES
+
+/* How many nodes to search between deadline checks. */
+#define DEADLINE_POLL_INTERVAL 1024
+
+/*
+ * Nodes a parallel root worker searches before adding them to the move's
+ * shared total, so a node budget overshoots by at most this much per thread.
+ */
+#define SHARED_NODES_INTERVAL 64
+
+/*
+ * Half width of the first aspiration window. Solved scores are 0 or a win or
+ * loss at some distance, so a window just around the guess either holds the
+ * score or fails at once.
+ */
+#define ASPIRATION_DELTA 2
+
+/* Killer moves remembered per ply. */
+#define KILLER_SLOTS 2
+
+/* History credits are halved once one passes this, keeping recent cutoffs dominant. */
+#define HISTORY_LIMIT (1u << 28)
+
+/*
+ * Layout of the move-ordering keys, highest bits first: the table move or
+ * killer rank, the weight bucket (moveWeight - 2), the history credit (which
+ * stays below 2^30, see HISTORY_LIMIT) and MAX_MOVES - 1 - cell.
+ */
+#define ORDER_RANK_SHIFT 48
+#define ORDER_WEIGHT_SHIFT 46
+#define ORDER_HISTORY_SHIFT 16
+
+/*
+ * Entries of a search's move stack. Each node pushes its candidates as one
+ * frame above its parent's and a node has at most one candidate per empty
+ * cell, so MAX_MOVES + (MAX_MOVES - 1) + ... + 1 entries cover any search.
+ */
+#define MOVE_STACK_SIZE (MAX_MOVES * (MAX_MOVES + 1) / 2)
+
+/* Count a search statistic; compiles to nothing unless SEARCH_STATS is set. */
+#if SEARCH_STATS
+#define COUNT_STAT(expression) ((void)(expression))
+#else
+#define COUNT_STAT(expression) ((void)0)
+#endif
+
+/*
+ * Per-search state threaded through the recursion: the owning engine, the
+ * position being searched, its counters and statistics, the move-ordering
+ * memory and the optional node/time limits. Engines keep these as preallocated scratch
+ * (one per search thread).
+ *
+ * Killers are the latest cells that caused a beta cutoff at each ply (-1 when
+ * unset); history credits every cutoff cell of each side with draft^2, so
+ * moves that refuted siblings elsewhere in the tree are tried early.
+ */
+typedef struct
+{
+    MiniMaxEngine *engine;
+    Position position;
+    SearchCounters counters;
+    SearchStats stats; /* only counted with SEARCH_STATS */
+    int killers[MAX_MOVES][KILLER_SLOTS]; /* indexed by ply from the root */
+    unsigned history[2][MAX_MOVES];       /* indexed by side and cell */
+    int *moveTop;                         /* first free entry of the move stack in use */
+    unsigned long long nodeLimit; /* 0 = unlimited */
+    atomic_ullong *sharedNodes;   /* parallel root search: nodes of the whole move, tested against nodeLimit */
+    unsigned long long sharedFlushed; /* counters.nodes already added to *sharedNodes */
+    int hasDeadline;
+    struct timespec deadline;
+    int pollCountdown;
+    int aborted;   /* a limit was hit; all scores from here on are meaningless */
+    int splitRoot; /* hand the root moves to the engine's worker pool */
+} SearchContext;
+
+/* Root moves in search order (cell indices); inner nodes use the move stack instead. */
+typedef struct
+{
+    int cells[MAX_MOVES];
+    int count;
+} MoveList;
+
+/*
+ * Helper constants used by the evaluation and search.
+ * Static evaluations stay within +-EVAL_SCORE_LIMIT and limited searches stop
+ * at MAX_LIMITED_DEPTH plies, so a real result (AI_WIN_SCORE - depth or
+ * PLAYER_WIN_SCORE + depth) always lies outside the evaluation range.
+ */
+typedef enum
+{
+    AI_WIN_SCORE = SCORE_WIN,
+    PLAYER_WIN_SCORE = -SCORE_WIN,
+    TIE_SCORE = 0,
+    CONTINUE_SCORE = 1,
+    EVAL_SCORE_LIMIT = SCORE_EVAL_LIMIT,
+    MAX_LIMITED_DEPTH = AI_WIN_SCORE - EVAL_SCORE_LIMIT - 1,
+    INF = INT_MAX
+} HelperScores;
+
+/* Defaults for MiniMaxConfig.solveEmpties and MiniMaxConfig.evalDepth. */
+#define DEFAULT_SOLVE_EMPTIES 16
+#define DEFAULT_EVAL_DEPTH 4
+
+/* Raw line potential at which the static evaluation reaches half its range. */
+#define EVAL_HALF_SCORE 16
+
+/* Default MiniMaxConfig.candidateRadius: restrict moves only on k-in-a-row boards. */
+#if WIN_LENGTH < BOARD_ROWS || WIN_LENGTH < BOARD_COLS
+#define DEFAULT_CANDIDATE_RADIUS 2
+#else
+#define DEFAULT_CANDIDATE_RADIUS 0
+#endif
+
+/* Bound type of a transposition table score. */
+typedef enum
+{
+    BOUND_NONE = 0,
+    BOUND_EXACT,
+    BOUND_LOWER, /* search failed high: true score >= stored score */
+    BOUND_UPPER  /* search failed low: true score <= stored score */
+} BoundType;
+
+/*
+ * Transposition table entry. Scores are stored from the point of view of the
+ * side to move and relative to the node (win distance counted from this
+ * position, not from the root), so an entry is valid at any search depth and
+ * across getAiMove calls.
+ */
+typedef struct
+{
+    int score;
+    BoundType bound;
+    int bestCell;  /* in the canonical orientation */
+    int transform; /* symmetry that mapped the storing position to canonical */
+    int draft;     /* remaining depth searched; >= empties means fully solved */
+} TTEntry;
+
+/* Packed slots keep the best cell in 10 bits. */
+#if MAX_MOVES > 1024
+#error "the transposition table supports boards of at most 1024 cells"
+#endif
+
+/*
+ * In-memory slot: the entry packed into one word, plus the key xored with it.
+ * Parallel searches share the table without locks; a slot torn by concurrent
+ * writers no longer satisfies check ^ data == key and simply reads as a miss.
+ */
+typedef struct
+{
+    _Atomic uint64_t check;
+    _Atomic uint64_t data;
+} TTSlot;
+
+#define DEFAULT_TT_MEGABYTES 16
+
+/* Default MiniMaxConfig.treeMegabytes, and the MCTS playout budget when no limit is set. */
+#define DEFAULT_TREE_MEGABYTES 64
+#define DEFAULT_MCTS_PLAYOUTS 100000
+
+/* UCT exploration constant for rewards between 0 and 1. */
+#define MCTS_EXPLORATION 1.4
+
+/* A tree leaf is expanded once this many playouts, in flight ones included, have entered it. */
+#define MCTS_EXPAND_VISITS 2
+
+/* MctsNode.state: children are published by the thread that moved the node to MCTS_EXPANDED. */
+enum
+{
+    MCTS_LEAF = 0,
+    MCTS_EXPANDING,
+    MCTS_EXPANDED
+};
+
+/* MctsNode.terminal: how the move into the node ended the game. */
+enum
+{
+    MCTS_OPEN = 0,
+    MCTS_WON,  /* the side that played it completed a line */
+    MCTS_DRAWN /* it filled the board */
+};
+
+/*
+ * Node of the Monte Carlo search tree, in the engine's node arena. Children of
+ * a node are allocated together, so firstChild and childCount describe them.
+ * visits is raised on the way down and rewards (half points for the side that
+ * played `cell`: 2 a win, 1 a draw) on the way back, so a playout still in
+ * flight counts as a loss: that virtual loss steers other threads elsewhere.
+ */
+typedef struct
+{
+    atomic_uint visits;
+    atomic_uint rewards;
+    atomic_int state;
+    uint32_t firstChild;
+    uint16_t childCount;
+    int16_t cell;
+    int8_t terminal;
+} MctsNode;
+
+
+/*
+ * One parallel root search: the ordered root moves are handed out one at a
+ * time through nextMove. Each move is searched with a window whose lower edge
+ * sits one below sharedAlpha (the best exact score so far), so a move that
+ * ties the current best is still scored exactly and the serial tie-breaking
+ * (earliest move wins) can be replayed on the results.
+ */
 typedef struct
 {
-    int row;
-    int col;
-} Move;
+    const SearchContext *base; /* position and deadline to copy */
+    int aiSide;
+    const MoveList *moves;
+    int remaining;
+    int exactScores; /* analysis: every move gets a full window and an exact score */
+    atomic_int nextMove;
+    atomic_int sharedAlpha;
+    atomic_int aborted;
+    atomic_ullong nodes; /* nodes of the whole move so far, for the node limit */
+    int scores[MAX_MOVES];
+    int exact[MAX_MOVES]; /* scores[i] is the true value, not an upper bound */
+    SearchCounters counters;
+    SearchStats stats;
+    pthread_mutex_t countersMutex;
+} RootJob;
+
+typedef struct WorkerPool WorkerPool;
+
+/* Work run by every thread of the pool on its own context and move stack. */
+typedef void (*PoolTask)(void *job, SearchContext *context, int *moveStack);
+
+/* A helper thread of the pool together with its own search scratch. */
+typedef struct
+{
+    WorkerPool *pool;
+    pthread_t thread;
+    SearchContext context;
+    int moveStack[MOVE_STACK_SIZE];
+} WorkerSlot;
+
+/* Persistent helper threads of one engine for parallel root and batch searches. */
+struct WorkerPool
+{
+    WorkerSlot *slots;
+    int helperCount;
+    pthread_mutex_t mutex;
+    pthread_cond_t workReady;
+    pthread_cond_t workDone;
+    unsigned long generation;
+    int pending;
+    int shutdown;
+    PoolTask task;
+    void *job;
+};
+
+/*
+ * Engine state: configuration, the transposition table, the worker pool and
+ * the scratch context reused by every search. An engine runs one search at a
+ * time; independent engines share nothing but the read-only tables below.
+ */
+struct MiniMaxEngine
+{
+    MiniMaxConfig config;
+    TTSlot *ttEntries;
+    size_t ttMask; /* entry count - 1 (count is a power of two) */
+    WorkerPool pool;
+    SearchContext scratch;
+    int moveStack[MOVE_STACK_SIZE]; /* scratch's, and the calling thread's in parallel searches */
+    SearchCounters totals; /* cumulative since the last resetEngineCounters() */
+    SearchStats stats;     /* likewise */
+    unsigned history[2][MAX_MOVES]; /* carried between searches when config.keepHistory is set */
+    int lastScore;  /* score of the previous search, seeding the next root driver guess */
+    char lastPlayer; /* side that search was for, or 0 when there is none */
+    MctsNode *treeNodes; /* MCTS node arena, reused by every move; NULL with minimax */
+    size_t treeCapacity;
+};
+
+/* Engine behind the classic getAiMove()-style API; calls are serialized by the mutex. */
+static MiniMaxEngine *defaultEngine = NULL;
+static pthread_mutex_t defaultEngineMutex = PTHREAD_MUTEX_INITIALIZER;
+
+/* Precomputed masks, filled once by initTables(). */
+static Bitboard fullMask;
+static Bitboard firstColumnMask;
+static Bitboard lastColumnMask;
+static int cellLines[MAX_MOVES][MAX_CELL_LINES]; /* windows through the cell, by direction */
+static int lineCells[NUM_LINES][WIN_LENGTH];     /* cells of each window */
+static int cellLineCount[MAX_MOVES];
+static Bitboard weightMasks[3];             /* move-ordering buckets: weight 4, 3, 2 */
+static uint64_t staticOrderKeys[MAX_MOVES]; /* geometric part of the move-ordering keys (see orderMoves) */
+static int staticOrder[MAX_MOVES];          /* every cell, by descending static key */
+static uint64_t zobristKeys[2][MAX_MOVES];
+static uint64_t zobristSideKey; /* xored in when 'o' is to move */
+static int symmetryMap[SYMMETRY_COUNT][MAX_MOVES];        /* cell -> transformed cell */
+static int inverseSymmetryMap[SYMMETRY_COUNT][MAX_MOVES]; /* transformed cell -> cell */
+static pthread_once_t tablesOnce = PTHREAD_ONCE_INIT;
+
+/*
+ * Generated by perfect_table_gen; the Makefile defines HAVE_PERFECT_TABLE for
+ * every size kernel, but the table only describes classic 3x3.
+ */
+#if defined(HAVE_PERFECT_TABLE) && BOARD_ROWS == 3 && BOARD_COLS == 3 && WIN_LENGTH == 3
+#include "perfect_table.h"
+#endif
+
+/* SplitMix64: small deterministic generator for the Zobrist keys. */
+static uint64_t nextRandom(uint64_t *state)
+{
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+/* Distance from index to the nearer of the one or two middle indices of length. */
+static int distanceToMiddle(int index, int length)
+{
+    int lowerMiddle = (length - 1) / 2;
+    int upperMiddle = length / 2;
+
+    int distanceToLowerMiddle = index - lowerMiddle;
+    if (distanceToLowerMiddle < 0)
+        distanceToLowerMiddle = -distanceToLowerMiddle;
+
+    int distanceToUpperMiddle = index - upperMiddle;
+    if (distanceToUpperMiddle < 0)
+        distanceToUpperMiddle = -distanceToUpperMiddle;
+
+    return distanceToLowerMiddle < distanceToUpperMiddle ? distanceToLowerMiddle : distanceToUpperMiddle;
+}
+
+/*
+ * Heuristic weight for move ordering:
+ *  - 4: exact center (Manhattan distance 0 to center)
+ *  - 3: on a diagonal through the center OR Manhattan distance 1 from center
+ *  - 2: everything else
+ * Works for odd and even sides by using two central indices per axis; on a
+ * square board the diagonals through the center are the two long diagonals.
+ */
+static int moveWeight(int row, int col)
+{
+    int minimalRowDistance = distanceToMiddle(row, BOARD_ROWS);
+    int minimalColumnDistance = distanceToMiddle(col, BOARD_COLS);
+
+    int manhattanDistanceToCenter = minimalRowDistance + minimalColumnDistance;
+
+    if (manhattanDistanceToCenter == 0)
+        return 4;
+
+    if (minimalRowDistance == minimalColumnDistance)
+        return 3;
+
+    if (manhattanDistanceToCenter == 1)
+        return 3;
+
+    return 2;
+}
+
+/*
+ * Build the per-cell line index, the static move order and the hash keys.
+ * Runs once per process through pthread_once.
+ * Windows are numbered direction by direction (rows, columns, main and anti
+ * diagonals), each in row-major order of its first cell; on a classic board
+ * this matches the scan order of the original char-board evaluation.
+ */
+static void initTables(void)
+{
+    static const int directions[4][2] = {{0, 1}, {1, 0}, {1, 1}, {1, -1}};
+
+    fullMask = bitboardFull();
+    firstColumnMask = bitboardEmpty();
+    lastColumnMask = bitboardEmpty();
+    for (int weight = 0; weight < 3; ++weight)
+        weightMasks[weight] = bitboardEmpty();
+
+    for (int row = 0; row < BOARD_ROWS; ++row)
+    {
+        for (int col = 0; col < BOARD_COLS; ++col)
+        {
+            int cell = row * BOARD_COLS + col;
+            cellLineCount[cell] = 0;
+            int weight = moveWeight(row, col);
+            bitboardToggle(&weightMasks[4 - weight], cell);
+            staticOrderKeys[cell] = ((uint64_t)(weight - 2) << ORDER_WEIGHT_SHIFT) | (uint64_t)(MAX_MOVES - 1 - cell);
+        }
+        bitboardToggle(&firstColumnMask, row * BOARD_COLS);
+        bitboardToggle(&lastColumnMask, row * BOARD_COLS + BOARD_COLS - 1);
+    }
+
+    int ordered = 0;
+    for (int bucket = 0; bucket < 3; ++bucket)
+    {
+        Bitboard cells = weightMasks[bucket];
+        int cell;
+        while ((cell = bitboardPopLowest(&cells)) >= 0)
+            staticOrder[ordered++] = cell;
+    }
+
+    int line = 0;
+    for (int d = 0; d < 4; ++d)
+    {
+        int dr = directions[d][0];
+        int dc = directions[d][1];
+        for (int row = 0; row < BOARD_ROWS; ++row)
+        {
+            for (int col = 0; col < BOARD_COLS; ++col)
+            {
+                int lastRow = row + dr * (WIN_LENGTH - 1);
+                int lastCol = col + dc * (WIN_LENGTH - 1);
+                if (lastRow >= BOARD_ROWS || lastCol < 0 || lastCol >= BOARD_COLS)
+                    continue;
+
+                for (int i = 0; i < WIN_LENGTH; ++i)
+                {
+                    int cell = (row + dr * i) * BOARD_COLS + col + dc * i;
+                    cellLines[cell][cellLineCount[cell]++] = line;
+                    lineCells[line][i] = cell;
+                }
+                ++line;
+            }
+        }
+    }
+
+    for (int row = 0; row < BOARD_ROWS; ++row)
+    {
+        for (int col = 0; col < BOARD_COLS; ++col)
+        {
+            int lastRow = BOARD_ROWS - 1;
+            int lastCol = BOARD_COLS - 1;
+#if BOARD_ROWS == BOARD_COLS
+            int images[SYMMETRY_COUNT][2] = {
+                {row, col},                     /* identity */
+                {col, lastCol - row},           /* rotate 90 */
+                {lastRow - row, lastCol - col}, /* rotate 180 */
+                {lastCol - col, row},           /* rotate 270 */
+                {row, lastCol - col},           /* mirror left-right */
+                {lastRow - row, col},           /* mirror top-bottom */
+                {col, row},                     /* main-diagonal transpose */
+                {lastCol - col, lastRow - row}  /* anti-diagonal transpose */
+            };
+#else
+            int images[SYMMETRY_COUNT][2] = {
+                {row, col},                     /* identity */
+                {lastRow - row, lastCol - col}, /* rotate 180 */
+                {row, lastCol - col},           /* mirror left-right */
+                {lastRow - row, col}            /* mirror top-bottom */
+            };
+#endif
+            int cell = row * BOARD_COLS + col;
+            for (int t = 0; t < SYMMETRY_COUNT; ++t)
+            {
+                int image = images[t][0] * BOARD_COLS + images[t][1];
+                symmetryMap[t][cell] = image;
+                inverseSymmetryMap[t][image] = cell;
+            }
+        }
+    }
+
+    uint64_t seed = 0x4D696E694D6178ULL;
+    for (int side = 0; side < 2; ++side)
+    {
+        for (int cell = 0; cell < MAX_MOVES; ++cell)
+            zobristKeys[side][cell] = nextRandom(&seed);
+    }
+    zobristSideKey = nextRandom(&seed);
+}
+
+/* Toggle a stone in the bitboard and the Zobrist hashes of every orientation. */
+static inline void toggleStone(Position *position, int side, int cell)
+{
+    bitboardToggle(&position->stones[side], cell);
+    for (int t = 0; t < position->symmetryCount; ++t)
+        position->hashes[t] ^= zobristKeys[side][symmetryMap[t][cell]];
+}
+
+/*
+ * Change of a line's potential (see evaluatePosition), from `side`'s point of
+ * view, when `side` adds a stone to a line that held `own` of its stones and
+ * `opposing` of the opponent's: an open line grows from own^2 to (own+1)^2, a
+ * line open only to the opponent stops counting against `side`.
+ */
+static inline int lineScoreGain(int own, int opposing)
+{
+    if (opposing == 0)
+        return 2 * own + 1;
+    if (own == 0)
+        return opposing * opposing;
+    return 0;
+}
+
+/*
+ * Make a move: place a stone on an empty cell and update the line counts.
+ * The cell is unlinked from the empty list but keeps its own links, which
+ * removeStone uses to put it back.
+ */
+static inline void placeStone(Position *position, int side, int cell)
+{
+    toggleStone(position, side, cell);
+    int gain = 0;
+    for (int i = 0; i < cellLineCount[cell]; ++i)
+    {
+        int line = cellLines[cell][i];
+        gain += lineScoreGain(position->lineCounts[side][line]++, position->lineCounts[!side][line]);
+    }
+    position->lineScore += (side == SIDE_X) ? gain : -gain;
+
+    position->emptyNext[position->emptyPrev[cell]] = position->emptyNext[cell];
+    position->emptyPrev[position->emptyNext[cell]] = position->emptyPrev[cell];
+    position->empties--;
+}
+
+/*
+ * Unmake a move placed with placeStone. Moves are unmade in reverse order, so
+ * the cell's neighbours in the empty list are its neighbours again.
+ */
+static inline void removeStone(Position *position, int side, int cell)
+{
+    toggleStone(position, side, cell);
+    int gain = 0;
+    for (int i = 0; i < cellLineCount[cell]; ++i)
+    {
+        int line = cellLines[cell][i];
+        gain += lineScoreGain(--position->lineCounts[side][line], position->lineCounts[!side][line]);
+    }
+    position->lineScore -= (side == SIDE_X) ? gain : -gain;
+
+    position->emptyNext[position->emptyPrev[cell]] = cell;
+    position->emptyPrev[position->emptyNext[cell]] = cell;
+    position->empties++;
+}
+
+/* Convert the public char board into per-player bitboards. */
+static void loadPosition(const char board[BOARD_ROWS][BOARD_COLS], int symmetryCount, Position *out_position)
+{
+    out_position->symmetryCount = symmetryCount;
+    out_position->stones[SIDE_X] = bitboardEmpty();
+    out_position->stones[SIDE_O] = bitboardEmpty();
+    for (int t = 0; t < SYMMETRY_COUNT; ++t)
+        out_position->hashes[t] = 0;
+    memset(out_position->lineCounts, 0, sizeof(out_position->lineCounts));
+    out_position->empties = MAX_MOVES;
+    int previous = MAX_MOVES;
+    for (int i = 0; i < MAX_MOVES; ++i)
+    {
+        out_position->emptyNext[previous] = staticOrder[i];
+        out_position->emptyPrev[staticOrder[i]] = previous;
+        previous = staticOrder[i];
+    }
+    out_position->emptyNext[previous] = MAX_MOVES;
+    out_position->emptyPrev[MAX_MOVES] = previous;
+    out_position->lineScore = 0;
+    for (int row = 0; row < BOARD_ROWS; ++row)
+    {
+        for (int col = 0; col < BOARD_COLS; ++col)
+        {
+            if (board[row][col] == 'x')
+                placeStone(out_position, SIDE_X, row * BOARD_COLS + col);
+            else if (board[row][col] == 'o')
+                placeStone(out_position, SIDE_O, row * BOARD_COLS + col);
+        }
+    }
+}
+
+/* Cells within `radius` rows and columns (Chebyshev distance) of a stone. */
+static Bitboard neighbourhood(Bitboard stones, int radius)
+{
+    Bitboard area = stones;
+    for (int step = 0; step < radius; ++step)
+    {
+        Bitboard right = bitboardAndNot(bitboardShiftUp(area, 1), firstColumnMask);
+        Bitboard left = bitboardAndNot(bitboardShiftDown(area, 1), lastColumnMask);
+        area = bitboardOr(area, bitboardOr(right, left));
+    }
+    for (int step = 0; step < radius; ++step)
+        area = bitboardOr(area, bitboardOr(bitboardShiftUp(area, BOARD_COLS), bitboardShiftDown(area, BOARD_COLS)));
+    return bitboardAnd(area, fullMask);
+}
+
+/*
+ * Collect the candidate cells of a node in static order (weight bucket, then
+ * row-major) for orderMoves: every empty cell, read off the empty list, or
+ * with a positive radius only the empty cells near a stone, unless there are
+ * none. Returns the number of cells written to out_cells.
+ */
+static int generateMoves(const Position *position, int radius, int *out_cells)
+{
+    if (radius > 0 && position->empties < MAX_MOVES)
+    {
+        Bitboard stones = bitboardOr(position->stones[SIDE_X], position->stones[SIDE_O]);
+        Bitboard nearby = bitboardAndNot(neighbourhood(stones, radius), stones);
+        if (!bitboardIsEmpty(nearby))
+        {
+            int count = 0;
+            for (int bucket = 0; bucket < 3; ++bucket)
+            {
+                Bitboard candidates = bitboardAnd(nearby, weightMasks[bucket]);
+                int cell;
+                while ((cell = bitboardPopLowest(&candidates)) >= 0)
+                    out_cells[count++] = cell;
+            }
+            return count;
+        }
+    }
+
+    int count = 0;
+    for (int cell = position->emptyNext[MAX_MOVES]; cell != MAX_MOVES; cell = position->emptyNext[cell])
+        out_cells[count++] = cell;
+    return count;
+}
+
+/*
+ * Fast win check based on the last move applied.
+ * Only tests the counts of the windows passing through the affected cell.
+ */
+static inline int didLastMoveWin(const Position *position, int side, int cell)
+{
+    for (int i = 0; i < cellLineCount[cell]; ++i)
+    {
+        if (position->lineCounts[side][cellLines[cell][i]] == WIN_LENGTH)
+            return 1;
+    }
+    return 0;
+}
+
+/*
+ * Terminal evaluation from the point of view of aiSide, used for the root
+ * position (inside the search, the move into a node has already been checked):
+ *  - +100 if a line completed by aiSide
+ *  - -100 if a line completed by opponent
+ *  -  0 for tie
+ *  -  1 (CONTINUE_SCORE) if the game is not terminal
+ */
+static int boardScore(const Position *position, int aiSide)
+{
+    for (int line = 0; line < NUM_LINES; ++line)
+    {
+        if (position->lineCounts[aiSide][line] == WIN_LENGTH)
+            return AI_WIN_SCORE;
+        if (position->lineCounts[!aiSide][line] == WIN_LENGTH)
+            return PLAYER_WIN_SCORE;
+    }
+
+    if (position->empties > 0)
+        return CONTINUE_SCORE;
+
+    return TIE_SCORE;
+}
+
+/*
+ * Static evaluation for depth-limited searches, from the point of view of
+ * `side`: a line still open for one player (no opposing stone on it) adds the
+ * square of that player's stone count, positive for `side` and negative for
+ * the opponent. The sum is maintained incrementally in lineScore; it is
+ * squashed into (-EVAL_SCORE_LIMIT, EVAL_SCORE_LIMIT) so real wins and losses
+ * dominate while boards with hundreds of windows keep telling positions apart.
+ */
+static inline int evaluatePosition(const Position *position, int side)
+{
+    int score = (side == SIDE_X) ? position->lineScore : -position->lineScore;
+    int magnitude = score < 0 ? -score : score;
+    return score * EVAL_SCORE_LIMIT / (magnitude + EVAL_HALF_SCORE);
+}
+
+/*
+ * Replace the engine's table with the largest power-of-two slot count that
+ * fits in the given number of megabytes. Zero disables the table.
+ * Returns 0 on success, -1 if the allocation failed (the table is then disabled).
+ */
+static int resizeTable(MiniMaxEngine *engine, size_t megabytes)
+{
+    free(engine->ttEntries);
+    engine->ttEntries = NULL;
+    engine->ttMask = 0;
+
+    if (megabytes > SIZE_MAX / (1024 * 1024))
+        return -1;
+
+    size_t budget = megabytes * 1024 * 1024 / sizeof(TTSlot);
+    if (budget == 0)
+        return 0;
+
+    size_t count = 1;
+    while (count * 2 <= budget)
+        count *= 2;
+
+    engine->ttEntries = calloc(count, sizeof(TTSlot));
+    if (engine->ttEntries == NULL)
+        return -1;
+
+    engine->ttMask = count - 1;
+    return 0;
+}
+
+/*
+ * Replace the engine's MCTS node arena with one of the given number of
+ * megabytes (never smaller than the root and its children); 0 frees it.
+ * Returns 0 on success, -1 if the allocation failed (the arena is then freed).
+ */
+static int resizeTree(MiniMaxEngine *engine, size_t megabytes)
+{
+    free(engine->treeNodes);
+    engine->treeNodes = NULL;
+    engine->treeCapacity = 0;
+
+    if (megabytes == 0)
+        return 0;
+    if (megabytes > SIZE_MAX / (1024 * 1024))
+        return -1;
+
+    size_t count = megabytes * 1024 * 1024 / sizeof(MctsNode);
+    if (count < MAX_MOVES + 1)
+        count = MAX_MOVES + 1;
+    if (count > UINT32_MAX)
+        count = UINT32_MAX;
+
+    engine->treeNodes = malloc(count * sizeof(MctsNode));
+    if (engine->treeNodes == NULL)
+        return -1;
+
+    engine->treeCapacity = count;
+    return 0;
+}
+
+/* Drop all stored positions and the kept history without changing the table size. */
+void clearEngineCache(MiniMaxEngine *engine)
+{
+    if (engine->ttEntries != NULL)
+        memset(engine->ttEntries, 0, (engine->ttMask + 1) * sizeof(TTSlot));
+    memset(engine->history, 0, sizeof(engine->history));
+    engine->lastPlayer = 0;
+}
+
+void getEngineCounters(const MiniMaxEngine *engine, SearchCounters *out_counters)
+{
+    *out_counters = engine->totals;
+}
+
+void getEngineStats(const MiniMaxEngine *engine, SearchStats *out_stats)
+{
+    *out_stats = engine->stats;
+    out_stats->nodes = engine->totals.nodes;
+}
+
+void resetEngineCounters(MiniMaxEngine *engine)
+{
+    engine->totals = (SearchCounters){0};
+    engine->stats = (SearchStats){0};
+}
+
+/*
+ * Canonical hash key of a node: the minimum over all orientations of the
+ * position hash plus side to move. Reports which orientation produced it so
+ * moves can be mapped to and from the canonical frame.
+ */
+static inline uint64_t nodeKey(const Position *position, int sideToMove, int *out_transform)
+{
+    uint64_t side = (sideToMove == SIDE_O) ? zobristSideKey : 0;
+    uint64_t best = position->hashes[0] ^ side;
+    int bestTransform = 0;
+    for (int t = 1; t < position->symmetryCount; ++t)
+    {
+        uint64_t key = position->hashes[t] ^ side;
+        if (key < best)
+        {
+            best = key;
+            bestTransform = t;
+        }
+    }
+    *out_transform = bestTransform;
+    return best;
+}
+
+/* Record a table cutoff; hits stored from another orientation count as symmetric. */
+static inline void countTableHit(SearchCounters *searchCounters, const TTEntry *entry, int transform)
+{
+    searchCounters->tableHits++;
+    if (entry->transform != transform)
+        searchCounters->symmetricHits++;
+}
+
+/* Add one set of search counters to another. */
+static void addCounters(SearchCounters *total, const SearchCounters *searchCounters)
+{
+    total->nodes += searchCounters->nodes;
+    total->tableHits += searchCounters->tableHits;
+    total->symmetricHits += searchCounters->symmetricHits;
+    total->playouts += searchCounters->playouts;
+}
+
+/* Add one set of search statistics to another (a no-op without SEARCH_STATS). */
+static void addStats(SearchStats *total, const SearchStats *stats)
+{
+#if SEARCH_STATS
+    for (int i = 0; i < SEARCH_STATS_PLIES; ++i)
+        total->nodesAtPly[i] += stats->nodesAtPly[i];
+    total->movesSearched += stats->movesSearched;
+    total->cutoffs += stats->cutoffs;
+    for (int i = 0; i < SEARCH_STATS_MOVE_SLOTS; ++i)
+        total->cutoffsAtMove[i] += stats->cutoffsAtMove[i];
+    total->winShortcuts += stats->winShortcuts;
+    total->tieShortcuts += stats->tieShortcuts;
+#else
+    (void)total;
+    (void)stats;
+#endif
+}
+
+/* Entry `index` of a statistics array of `count` entries, the last one collecting the rest. */
+static inline int statsSlot(int index, int count)
+{
+    return index < count ? index : count - 1;
+}
+
+/* Fill out_entry and return 1 if key is stored; 0 on a miss (or no table). */
+static inline int ttProbe(const MiniMaxEngine *engine, uint64_t key, TTEntry *out_entry)
+{
+    if (engine->ttEntries == NULL)
+        return 0;
+
+    TTSlot *slot = &engine->ttEntries[key & engine->ttMask];
+    uint64_t data = atomic_load_explicit(&slot->data, memory_order_relaxed);
+    uint64_t check = atomic_load_explicit(&slot->check, memory_order_relaxed);
+    if ((check ^ data) != key)
+        return 0;
+
+    out_entry->score = (int16_t)(data & 0xFFFF);
+    out_entry->bound = (BoundType)((data >> 16) & 0x3);
+    out_entry->bestCell = (int)((data >> 18) & 0x3FF);
+    out_entry->transform = (int)((data >> 28) & 0x7);
+    out_entry->draft = (int)((data >> 31) & 0xFF);
+    return out_entry->bound != BOUND_NONE;
+}
+
+/* Always-replace store. */
+static inline void ttStore(MiniMaxEngine *engine, uint64_t key, int transform, int draft, int score, BoundType bound, int bestCell)
+{
+    if (engine->ttEntries == NULL)
+        return;
+
+    uint64_t data = (uint64_t)(uint16_t)score |
+                    (uint64_t)bound << 16 |
+                    (uint64_t)symmetryMap[transform][bestCell] << 18 |
+                    (uint64_t)transform << 28 |
+                    (uint64_t)(draft > 0xFF ? 0xFF : draft) << 31;
+    TTSlot *slot = &engine->ttEntries[key & engine->ttMask];
+    atomic_store_explicit(&slot->check, key ^ data, memory_order_relaxed);
+    atomic_store_explicit(&slot->data, data, memory_order_relaxed);
+}
+
+/*
+ * Convert a side-to-move score between the root-relative form used by the
+ * search (AI_WIN_SCORE - depth) and the node-relative form kept in the table.
+ */
+static inline int scoreToTable(int score, int depth)
+{
+    if (score > EVAL_SCORE_LIMIT)
+        return score + depth;
+    if (score < -EVAL_SCORE_LIMIT)
+        return score - depth;
+    return score;
+}
+
+static inline int scoreFromTable(int score, int depth)
+{
+    if (score > EVAL_SCORE_LIMIT)
+        return score - depth;
+    if (score < -EVAL_SCORE_LIMIT)
+        return score + depth;
+    return score;
+}
+
+/* Move the table's best move (if present) to the front, keeping the rest in order. */
+static void promoteMove(MoveList *moves, int cell)
+{
+    for (int i = 0; i < moves->count; ++i)
+    {
+        if (moves->cells[i] == cell)
+        {
+            for (; i > 0; --i)
+                moves->cells[i] = moves->cells[i - 1];
+            moves->cells[0] = cell;
+            return;
+        }
+    }
+}
+
+/*
+ * Move ordering: the table's best move first, then this ply's killers (newest
+ * first), then the rest by weight bucket and, within a bucket, by descending
+ * history credit, with row-major order breaking the remaining ties. History
+ * ranks below the bucket because the geometric weight predicts cutoffs better
+ * on these boards: ahead of it, history searched ~3x more nodes solving 4x4
+ * from the first reply.
+ *
+ * Every cell gets one sort key; the static part (bucket and cell) comes from
+ * staticOrderKeys, and keys are distinct, so the result does not depend on
+ * the order the cells were generated in. generateMoves hands them over in
+ * static order, so only promoted cells move and the insertion sort stays
+ * near linear. The root passes no killers and no
+ * history and gets the plain static order.
+ */
+static void orderMoves(int *cells, int count, int hashCell, const int *killers, const unsigned *history)
+{
+    uint64_t keys[MAX_MOVES];
+
+    for (int i = 0; i < count; ++i)
+    {
+        int cell = cells[i];
+        uint64_t key = staticOrderKeys[cell];
+        if (cell == hashCell)
+            key |= (uint64_t)(KILLER_SLOTS + 1) << ORDER_RANK_SHIFT;
+        else if (killers != NULL)
+        {
+            for (int slot = 0; slot < KILLER_SLOTS; ++slot)
+            {
+                if (cell == killers[slot])
+                {
+                    key |= (uint64_t)(KILLER_SLOTS - slot) << ORDER_RANK_SHIFT;
+                    break;
+                }
+            }
+        }
+        if (history != NULL)
+            key |= (uint64_t)history[cell] << ORDER_HISTORY_SHIFT;
+
+        int j = i;
+        for (; j > 0 && keys[j - 1] < key; --j)
+        {
+            keys[j] = keys[j - 1];
+            cells[j] = cells[j - 1];
+        }
+        keys[j] = key;
+        cells[j] = cell;
+    }
+}
+
+/* Remember a cell that caused a beta cutoff at this ply as a killer and in the history. */
+static void recordCutoff(SearchContext *context, int side, int depth, int draft, int cell)
+{
+    int *killers = context->killers[depth];
+    if (killers[0] != cell)
+    {
+        for (int slot = KILLER_SLOTS - 1; slot > 0; --slot)
+            killers[slot] = killers[slot - 1];
+        killers[0] = cell;
+    }
+
+    unsigned *history = context->history[side];
+    history[cell] += (unsigned)(draft * draft);
+    if (history[cell] >= HISTORY_LIMIT)
+    {
+        for (int s = 0; s < 2; ++s)
+        {
+            for (int c = 0; c < MAX_MOVES; ++c)
+                context->history[s][c] /= 2;
+        }
+    }
+}
+
+/*
+ * Check the node and time limits. The clock is polled only every
+ * DEADLINE_POLL_INTERVAL nodes; once a limit is hit the search is marked
+ * aborted and unwinds without storing results. Workers of a parallel root
+ * search test the node limit against the shared total of the move, which
+ * they add to every SHARED_NODES_INTERVAL nodes.
+ */
+static int limitReached(SearchContext *context)
+{
+    if (context->nodeLimit != 0)
+    {
+        unsigned long long nodes = context->counters.nodes;
+        if (context->sharedNodes == NULL)
+        {
+            if (nodes >= context->nodeLimit)
+                context->aborted = 1;
+        }
+        else if (nodes - context->sharedFlushed >= SHARED_NODES_INTERVAL)
+        {
+            unsigned long long pending = nodes - context->sharedFlushed;
+            context->sharedFlushed = nodes;
+            if (atomic_fetch_add(context->sharedNodes, pending) + pending >= context->nodeLimit)
+                context->aborted = 1;
+        }
+    }
+
+    if (!context->hasDeadline || --context->pollCountdown > 0)
+        return context->aborted;
+
+    context->pollCountdown = DEADLINE_POLL_INTERVAL;
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    if (now.tv_sec > context->deadline.tv_sec ||
+        (now.tv_sec == context->deadline.tv_sec && now.tv_nsec >= context->deadline.tv_nsec))
+        context->aborted = 1;
+    return context->aborted;
+}
+
+/* Set deadline to `milliseconds` from now. */
+static void setDeadline(struct timespec *deadline, long milliseconds)
+{
+    clock_gettime(CLOCK_MONOTONIC, deadline);
+    deadline->tv_sec += milliseconds / 1000;
+    deadline->tv_nsec += (milliseconds % 1000) * 1000000L;
+    if (deadline->tv_nsec >= 1000000000L)
+    {
+        deadline->tv_sec += 1;
+        deadline->tv_nsec -= 1000000000L;
+    }
+}
+
+/*
+ * Negamax search with principal variation search (NegaScout).
+ * Returns the score from the point of view of `side`, the player to move,
+ * using the same depth-adjusted terminal values as before: a win for the side
+ * to move found at ply d scores AI_WIN_SCORE - d, a loss PLAYER_WIN_SCORE + d.
+ *
+ * The first move is searched with the full (alpha, beta) window; later moves
+ * get a null window (alpha, alpha + 1) that only proves they are no better,
+ * and are re-searched with the full window when that proof fails.
+ *
+ * `remaining` limits how many more plies are searched; when it runs out the
+ * position is scored by evaluatePosition. FULL_DEPTH never runs out.
+ */
+static int negamax(SearchContext *context, int side, int depth, int remaining, int alpha, int beta)
+{
+    Position *position = &context->position;
+
+    /*
+     * No terminal check here: the parent scored a winning move or the move
+     * onto the last empty cell itself, so every node entered is still open.
+     */
+    if (remaining == 0)
+        return evaluatePosition(position, side);
+    if (limitReached(context))
+        return TIE_SCORE;
+
+    context->counters.nodes++;
+    COUNT_STAT(context->stats.nodesAtPly[statsSlot(depth - 1, SEARCH_STATS_PLIES)]++);
+
+    /* a budget covering every empty cell is a full solve, whatever its size */
+    int empties = position->empties;
+    int draft = remaining < empties ? remaining : empties;
+
+    int transform;
+    uint64_t key = nodeKey(position, side, &transform);
+    int originalAlpha = alpha;
+    int hashCell = -1;
+    TTEntry entry;
+    if (ttProbe(context->engine, key, &entry))
+    {
+        int stored = scoreFromTable(entry.score, depth);
+        if (entry.draft >= draft &&
+            (entry.bound == BOUND_EXACT ||
+             (entry.bound == BOUND_LOWER && stored >= beta) ||
+             (entry.bound == BOUND_UPPER && stored <= alpha)))
+        {
+            countTableHit(&context->counters, &entry, transform);
+            return stored;
+        }
+        hashCell = inverseSymmetryMap[transform][entry.bestCell];
+    }
+
+    /* this node's frame of the move stack; children push theirs above it */
+    int *moves = context->moveTop;
+    int moveCount = generateMoves(position, context->engine->config.candidateRadius, moves);
+    orderMoves(moves, moveCount, hashCell, context->killers[depth], context->history[side]);
+    context->moveTop = moves + moveCount;
+    int bestScore = -INF;
+    int bestCell = moves[0];
+    int searchedFirst = 0;
+
+    for (int i = 0; i < moveCount; i++)
+    {
+        int cell = moves[i];
+        placeStone(position, side, cell);
+        COUNT_STAT(context->stats.movesSearched++);
+        int score;
+        if (didLastMoveWin(position, side, cell))
+        {
+            /* immediate win after this move; prefer faster wins */
+            score = AI_WIN_SCORE - (depth + 1);
+            COUNT_STAT(context->stats.winShortcuts++);
+        }
+        else if (position->empties == 0)
+        {
+            score = TIE_SCORE;
+            COUNT_STAT(context->stats.tieShortcuts++);
+        }
+        else if (!searchedFirst)
+        {
+            score = -negamax(context, !side, depth + 1, remaining - 1, -beta, -alpha);
+            searchedFirst = 1;
+        }
+        else
+        {
+            score = -negamax(context, !side, depth + 1, remaining - 1, -alpha - 1, -alpha);
+            if (score > alpha && score < beta)
+                score = -negamax(context, !side, depth + 1, remaining - 1, -beta, -alpha);
+        }
+        removeStone(position, side, cell);
+
+        if (context->aborted)
+        {
+            context->moveTop = moves;
+            return TIE_SCORE;
+        }
+
+        if (score > bestScore)
+        {
+            bestScore = score;
+            bestCell = cell;
+        }
+
+        if (score > alpha)
+            alpha = score;
+        if (beta <= alpha)
+        {
+            recordCutoff(context, side, depth, draft, cell);
+            COUNT_STAT(context->stats.cutoffs++);
+            COUNT_STAT(context->stats.cutoffsAtMove[statsSlot(i, SEARCH_STATS_MOVE_SLOTS)]++);
+            break;
+        }
+    }
+    context->moveTop = moves;
+
+    BoundType bound = BOUND_EXACT;
+    if (bestScore <= originalAlpha)
+        bound = BOUND_UPPER;
+    else if (bestScore >= beta)
+        bound = BOUND_LOWER;
+    ttStore(context->engine, key, transform, draft, scoreToTable(bestScore, depth), bound, bestCell);
+
+    return bestScore;
+}
+
+/*
+ * Reset `context` (keeping its engine), load the position into it with
+ * `moveStack` as its move stack and put the root moves (candidates within
+ * `radius` of a stone when positive) in out_moves in static order.
+ * Returns 0 if the game is already over.
+ */
+static int loadRoot(SearchContext *context, int *moveStack, const char board[BOARD_ROWS][BOARD_COLS], int aiSide, int radius, MoveList *out_moves)
+{
+    MiniMaxEngine *engine = context->engine;
+    *context = (SearchContext){.engine = engine, .moveTop = moveStack};
+    loadPosition(board, engine->config.useSymmetry ? SYMMETRY_COUNT : 1, &context->position);
+
+    if (boardScore(&context->position, aiSide) != CONTINUE_SCORE)
+        return 0;
+
+    out_moves->count = generateMoves(&context->position, radius, out_moves->cells);
+    orderMoves(out_moves->cells, out_moves->count, -1, NULL, NULL);
+    return 1;
+}
+
+/*
+ * Prepare a root search: load the root (see loadRoot) and settle the cases
+ * that need no search. Returns 1 with the ordered root moves in out_moves
+ * when a search is required; otherwise returns 0 with the answer in out_result:
+ *  - Terminal board -> (-1, -1)
+ *  - Empty board    -> center (even sides pick index side/2)
+ *  - One candidate  -> that cell
+ */
+static int prepareRoot(SearchContext *context, int *moveStack, const char board[BOARD_ROWS][BOARD_COLS], int aiSide, int radius, MoveList *out_moves, MoveResult *out_result)
+{
+    if (!loadRoot(context, moveStack, board, aiSide, radius, out_moves))
+    {
+        out_result->row = -1;
+        out_result->col = -1;
+        return 0;
+    }
+
+    if (context->position.empties == MAX_MOVES)
+    {
+        out_result->row = BOARD_ROWS / 2;
+        out_result->col = BOARD_COLS / 2;
+        return 0;
+    }
+
+    if (out_moves->count == 1)
+    {
+        out_result->row = out_moves->cells[0] / BOARD_COLS;
+        out_result->col = out_moves->cells[0] % BOARD_COLS;
+        return 0;
+    }
+
+    return 1;
+}
+
+/*
+ * Worker side of a parallel root search: repeatedly claim the next root move,
+ * search it on the given scratch context (a private copy of the position)
+ * with the given move stack, and publish the result.
+ */
+static void runRootJob(void *arg, SearchContext *context, int *moveStack)
+{
+    RootJob *job = arg;
+    *context = *job->base;
+    context->moveTop = moveStack;
+    context->counters = (SearchCounters){0};
+    context->stats = (SearchStats){0};
+    context->pollCountdown = DEADLINE_POLL_INTERVAL;
+    context->sharedNodes = &job->nodes;
+    context->sharedFlushed = 0;
+    Position *position = &context->position;
+    int aiSide = job->aiSide;
+
+    int index;
+    while (!atomic_load(&job->aborted) && (index = atomic_fetch_add(&job->nextMove, 1)) < job->moves->count)
+    {
+        int cell = job->moves->cells[index];
+        int shared = atomic_load(&job->sharedAlpha);
+        int lower = (shared == -INF || job->exactScores) ? -INF : shared - 1;
+
+        placeStone(position, aiSide, cell);
+        int score;
+        if (job->exactScores)
+        {
+            score = -negamax(context, !aiSide, 1, job->remaining - 1, -INF, INF);
+        }
+        else
+        {
+            score = -negamax(context, !aiSide, 1, job->remaining - 1, -lower - 1, -lower);
+            if (score > lower)
+                score = -negamax(context, !aiSide, 1, job->remaining - 1, -INF, -lower);
+        }
+        removeStone(position, aiSide, cell);
+
+        if (context->aborted)
+        {
+            atomic_store(&job->aborted, 1);
+            break;
+        }
+
+        job->scores[index] = score;
+        job->exact[index] = score > lower;
+        if (job->exact[index])
+        {
+            int current = atomic_load(&job->sharedAlpha);
+            while (score > current && !atomic_compare_exchange_weak(&job->sharedAlpha, &current, score))
+            {
+            }
+        }
+    }
+
+    pthread_mutex_lock(&job->countersMutex);
+    addCounters(&job->counters, &context->counters);
+    addStats(&job->stats, &context->stats);
+    pthread_mutex_unlock(&job->countersMutex);
+}
+
+/* Helper thread body: wait for a new job generation, run it, report back. */
+static void *workerMain(void *arg)
+{
+    WorkerSlot *slot = arg;
+    WorkerPool *pool = slot->pool;
+    unsigned long seen = 0;
+
+    pthread_mutex_lock(&pool->mutex);
+    for (;;)
+    {
+        while (pool->generation == seen && !pool->shutdown)
+            pthread_cond_wait(&pool->workReady, &pool->mutex);
+        if (pool->shutdown)
+            break;
+
+        seen = pool->generation;
+        PoolTask task = pool->task;
+        void *job = pool->job;
+        pthread_mutex_unlock(&pool->mutex);
+
+        task(job, &slot->context, slot->moveStack);
+
+        pthread_mutex_lock(&pool->mutex);
+        if (--pool->pending == 0)
+            pthread_cond_signal(&pool->workDone);
+    }
+    pthread_mutex_unlock(&pool->mutex);
+    return NULL;
+}
+
+/* Stop and join all helper threads of the pool. */
+static void stopWorkers(WorkerPool *pool)
+{
+    pthread_mutex_lock(&pool->mutex);
+    pool->shutdown = 1;
+    pthread_cond_broadcast(&pool->workReady);
+    pthread_mutex_unlock(&pool->mutex);
+
+    for (int i = 0; i < pool->helperCount; ++i)
+        pthread_join(pool->slots[i].thread, NULL);
+
+    free(pool->slots);
+    pool->slots = NULL;
+    pool->helperCount = 0;
+    pool->shutdown = 0;
+}
+
+/*
+ * Start `helpers` helper threads (the searching thread is the extra one).
+ * Returns 0 on success, -1 if they could not all be started (none are kept).
+ */
+static int startWorkers(WorkerPool *pool, int helpers)
+{
+    if (helpers <= 0)
+        return 0;
+
+    pool->slots = calloc((size_t)helpers, sizeof(WorkerSlot));
+    if (pool->slots == NULL)
+        return -1;
+
+    for (int i = 0; i < helpers; ++i)
+    {
+        pool->slots[i].pool = pool;
+        if (pthread_create(&pool->slots[i].thread, NULL, workerMain, &pool->slots[i]) != 0)
+        {
+            stopWorkers(pool);
+            return -1;
+        }
+        pool->helperCount++;
+    }
+    return 0;
+}
+
+/*
+ * Run `task` on every helper of the pool and on the calling thread, which
+ * uses the given context and move stack, and wait until all have returned.
+ */
+static void runOnPool(WorkerPool *pool, PoolTask task, void *job, SearchContext *context, int *moveStack)
+{
+    pthread_mutex_lock(&pool->mutex);
+    pool->task = task;
+    pool->job = job;
+    pool->pending = pool->helperCount;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->workReady);
+    pthread_mutex_unlock(&pool->mutex);
+
+    task(job, context, moveStack);
+
+    pthread_mutex_lock(&pool->mutex);
+    while (pool->pending > 0)
+        pthread_cond_wait(&pool->workDone, &pool->mutex);
+    pool->task = NULL;
+    pool->job = NULL;
+    pthread_mutex_unlock(&pool->mutex);
+}
+
+/*
+ * Run a root job prepared by the caller (base, side, moves, depth and mode)
+ * on the engine's worker pool and add its counters to the context's.
+ */
+static void runRootJobOnPool(SearchContext *context, RootJob *job)
+{
+    atomic_init(&job->nextMove, 0);
+    atomic_init(&job->sharedAlpha, -INF);
+    atomic_init(&job->aborted, 0);
+    atomic_init(&job->nodes, context->counters.nodes);
+    pthread_mutex_init(&job->countersMutex, NULL);
+
+    /*
+     * The calling thread works too, on a copy so the base context stays
+     * intact. The base context searches nothing meanwhile, so the copy
+     * borrows its move stack.
+     */
+    SearchContext callerContext;
+    runOnPool(&context->engine->pool, runRootJob, job, &callerContext, context->moveTop);
+
+    pthread_mutex_destroy(&job->countersMutex);
+    addCounters(&context->counters, &job->counters);
+    addStats(&context->stats, &job->stats);
+}
+
+/*
+ * Parallel full-window searchRoot over the engine's worker pool, with the same
+ * result and tie-breaking: immediate wins are settled serially first, then
+ * every move is scored and the earliest move with the highest exact score
+ * wins. Returns 0 if aborted by a limit, 1 otherwise.
+ */
+static int searchRootParallel(SearchContext *context, int aiSide, const MoveList *moves, int remaining, int *out_cell, int *out_score)
+{
+    for (int i = 0; i < moves->count; ++i)
+    {
+        int cell = moves->cells[i];
+        placeStone(&context->position, aiSide, cell);
+        int win = didLastMoveWin(&context->position, aiSide, cell);
+        removeStone(&context->position, aiSide, cell);
+        if (win)
+        {
+            *out_cell = cell;
+            *out_score = AI_WIN_SCORE - 1;
+            return 1;
+        }
+    }
+
+    RootJob job = {
+        .base = context,
+        .aiSide = aiSide,
+        .moves = moves,
+        .remaining = remaining,
+    };
+    runRootJobOnPool(context, &job);
+
+    if (atomic_load(&job.aborted))
+    {
+        context->aborted = 1;
+        return 0;
+    }
+
+    int bestIndex = -1;
+    for (int i = 0; i < moves->count; ++i)
+    {
+        if (job.exact[i] && (bestIndex < 0 || job.scores[i] > job.scores[bestIndex]))
+            bestIndex = i;
+    }
+
+    *out_cell = moves->cells[bestIndex];
+    *out_score = job.scores[bestIndex];
+    return 1;
+}
+
+/*
+ * Search the root moves to `remaining` plies within (alpha, beta) and report
+ * the best one. An immediate win is returned at once. A move only replaces
+ * the current best when it scores strictly higher, so ties go to the earlier
+ * move in `moves`. The score is fail-soft: at most alpha means every move is
+ * at most that good, at least beta means the reported move is at least that
+ * good (the search stops at the first such move). With the full window it is
+ * exact. Returns 0 if the search was aborted by a limit (outputs untouched).
+ */
+static int searchRootWindow(SearchContext *context, int aiSide, const MoveList *moves, int remaining, int alpha, int beta, int *out_cell, int *out_score)
+{
+    Position *position = &context->position;
+    int bestCell = moves->cells[0];
+    int bestScore = -INF;
+
+    for (int i = 0; i < moves->count; ++i)
+    {
+        int cell = moves->cells[i];
+        placeStone(position, aiSide, cell);
+
+        if (didLastMoveWin(position, aiSide, cell))
+        {
+            removeStone(position, aiSide, cell);
+            *out_cell = cell;
+            *out_score = AI_WIN_SCORE - 1;
+            return 1;
+        }
+
+        /* same PVS scheme as negamax: only a move that beats alpha gets a full window */
+        int score;
+        if (i == 0)
+        {
+            score = -negamax(context, !aiSide, 1, remaining - 1, -beta, -alpha);
+        }
+        else
+        {
+            score = -negamax(context, !aiSide, 1, remaining - 1, -alpha - 1, -alpha);
+            if (score > alpha && score < beta)
+                score = -negamax(context, !aiSide, 1, remaining - 1, -beta, -alpha);
+        }
+        removeStone(position, aiSide, cell);
+
+        if (context->aborted)
+            return 0;
+
+        if (score > bestScore)
+        {
+            bestScore = score;
+            bestCell = cell;
+            if (score > alpha)
+                alpha = score;
+            if (score >= beta)
+                break;
+        }
+    }
+
+    *out_cell = bestCell;
+    *out_score = bestScore;
+    return 1;
+}
+
+/*
+ * MTD(f): converge on the root score with null-window searches, starting at
+ * `guess`. Each search either fails high and raises the lower bound to its
+ * score, or fails low and lowers the upper bound, until the two meet. A
+ * null-window search that fails high stops at the earliest move reaching the
+ * bound, so the move of the last one is the earliest best move, as in the
+ * full-window search. Returns 0 if aborted by a limit.
+ */
+static int searchRootMtdf(SearchContext *context, int aiSide, const MoveList *moves, int remaining, int guess, int *out_cell, int *out_score)
+{
+    int lower = -INF;
+    int upper = INF;
+    int score = guess;
+    int bestCell = moves->cells[0];
+
+    while (lower < upper)
+    {
+        int beta = score == lower ? score + 1 : score;
+        int cell;
+        if (!searchRootWindow(context, aiSide, moves, remaining, beta - 1, beta, &cell, &score))
+            return 0;
+
+        if (score < beta)
+        {
+            upper = score;
+        }
+        else
+        {
+            lower = score;
+            bestCell = cell;
+        }
+    }
+
+    *out_cell = bestCell;
+    *out_score = lower;
+    return 1;
+}
+
+/*
+ * Aspiration window: search (guess - ASPIRATION_DELTA, guess + ASPIRATION_DELTA)
+ * and, when the score falls outside, search again with the failing side
+ * opened up to the fail-soft bound. The final window holds the score, so
+ * move and score match the full-window search. Returns 0 if aborted.
+ */
+static int searchRootAspiration(SearchContext *context, int aiSide, const MoveList *moves, int remaining, int guess, int *out_cell, int *out_score)
+{
+    int alpha = guess - ASPIRATION_DELTA;
+    int beta = guess + ASPIRATION_DELTA;
+
+    for (;;)
+    {
+        int cell;
+        int score;
+        if (!searchRootWindow(context, aiSide, moves, remaining, alpha, beta, &cell, &score))
+            return 0;
+
+        if (score <= alpha)
+        {
+            alpha = -INF;
+            beta = score + 1;
+        }
+        else if (score >= beta)
+        {
+            alpha = score - 1;
+            beta = INF;
+        }
+        else
+        {
+            *out_cell = cell;
+            *out_score = score;
+            return 1;
+        }
+    }
+}
+
+/*
+ * Search every root move to `remaining` plies and report the best one, with
+ * the engine's root driver seeded by `guess`. Parallel root searches always
+ * use the full window. Returns 0 if aborted by a limit (outputs untouched).
+ */
+static int searchRoot(SearchContext *context, int aiSide, const MoveList *moves, int remaining, int guess, int *out_cell, int *out_score)
+{
+    if (context->splitRoot)
+        return searchRootParallel(context, aiSide, moves, remaining, out_cell, out_score);
+
+    switch (context->engine->config.rootDriver)
+    {
+    case ROOT_DRIVER_MTDF:
+        return searchRootMtdf(context, aiSide, moves, remaining, guess, out_cell, out_score);
+    case ROOT_DRIVER_ASPIRATION:
+        return searchRootAspiration(context, aiSide, moves, remaining, guess, out_cell, out_score);
+    default:
+        return searchRootWindow(context, aiSide, moves, remaining, -INF, INF, out_cell, out_score);
+    }
+}
+
+/* Most empty cells an unlimited search solves outright (config.solveEmpties, clamped). */
+static int solveEmptiesLimit(const MiniMaxConfig *config)
+{
+    if (config->solveEmpties <= 0 || config->solveEmpties > MAX_LIMITED_DEPTH)
+        return MAX_LIMITED_DEPTH;
+    return config->solveEmpties;
+}
+
+/*
+ * Shared driver behind getAiMoveEx, getAiMove, getAiMoveTimed and batches,
+ * searching on `context` (whose engine supplies the table and configuration)
+ * with `moveStack`. splitRoot hands the root moves to the engine's worker pool.
+ * `guess` seeds the aspiration and MTD(f) root drivers; later iterations
+ * start from the previous iteration's score.
+ * Without limits it runs one full-depth search, unless more than solveEmpties
+ * cells are empty; then it searches evalDepth plies instead. With a depth,
+ * node or time limit it runs iterative deepening: each iteration searches one
+ * ply deeper with the previous best move tried first, and the move of the last
+ * completed iteration is returned. Deepening stops early once an iteration
+ * reaches every empty cell (the position is solved) or finds a forced win, and
+ * never goes past MAX_LIMITED_DEPTH.
+ */
+static int searchPosition(SearchContext *context, int *moveStack, int splitRoot, int guess, const char board[BOARD_ROWS][BOARD_COLS], char aiPlayer, int maxDepth, unsigned long long maxNodes, long moveTimeMs, MoveResult *out_result)
+{
+    pthread_once(&tablesOnce, initTables);
+
+    MiniMaxEngine *engine = context->engine;
+    int aiSide = (aiPlayer == 'x') ? SIDE_X : SIDE_O;
+    MoveList moves;
+    *out_result = (MoveResult){0};
+    if (!prepareRoot(context, moveStack, board, aiSide, engine->config.candidateRadius, &moves, out_result))
+        return 0;
+
+    context->splitRoot = splitRoot;
+    int empties = context->position.empties;
+    int bestCell = moves.cells[0];
+
+    /* kept history is halved per search so the previous position's credits fade */
+    memset(context->killers, -1, sizeof(context->killers));
+    if (engine->config.keepHistory)
+    {
+        for (int side = 0; side < 2; ++side)
+        {
+            for (int cell = 0; cell < MAX_MOVES; ++cell)
+                context->history[side][cell] = engine->history[side][cell] / 2;
+        }
+    }
+    int limited = maxDepth > 0 || maxNodes > 0 || moveTimeMs > 0;
+
+    if (!limited && empties > solveEmptiesLimit(&engine->config))
+    {
+        maxDepth = engine->config.evalDepth > 0 ? engine->config.evalDepth : DEFAULT_EVAL_DEPTH;
+        limited = 1;
+    }
+
+    if (!limited)
+    {
+        searchRoot(context, aiSide, &moves, FULL_DEPTH, guess, &bestCell, &out_result->score);
+        out_result->depth = empties;
+        out_result->solved = 1;
+        if (engine->config.solvedCache != NULL)
+            recordSolvedCache(engine->config.solvedCache, board, aiPlayer, bestCell, out_result->score);
+    }
+    else
+    {
+        if (moveTimeMs > 0)
+            setDeadline(&context->deadline, moveTimeMs);
+
+        int lastDepth = (maxDepth > 0 && maxDepth < empties) ? maxDepth : empties;
+        if (lastDepth > MAX_LIMITED_DEPTH)
+            lastDepth = MAX_LIMITED_DEPTH;
+        for (int remaining = 1; remaining <= lastDepth; ++remaining)
+        {
+            /* the first iteration always completes so there is a searched move to return */
+            context->hasDeadline = (moveTimeMs > 0 && remaining > 1);
+            context->nodeLimit = (remaining > 1) ? maxNodes : 0;
+            context->pollCountdown = DEADLINE_POLL_INTERVAL;
+
+            int cell;
+            int score;
+            if (!searchRoot(context, aiSide, &moves, remaining, guess, &cell, &score))
+                break;
+
+            bestCell = cell;
+            out_result->score = score;
+            out_result->depth = remaining;
+            guess = score;
+            promoteMove(&moves, bestCell);
+            if (score > EVAL_SCORE_LIMIT)
+            {
+                out_result->solved = 1;
+                break;
+            }
+        }
+        if (out_result->depth == empties)
+            out_result->solved = 1;
+    }
+
+    out_result->row = bestCell / BOARD_COLS;
+    out_result->col = bestCell % BOARD_COLS;
+    out_result->counters = context->counters;
+    return 1;
+}
+
+/*
+ * Score every root move exactly to `remaining` plies, in the order of
+ * `moves`. Immediate wins and the move onto the last empty cell are scored
+ * at once; the other moves each get a full window, on the worker pool when
+ * the context splits the root. There is no move to prune against, so every
+ * score is exact rather than a bound; the shared table still lets later
+ * moves reuse the subtrees of earlier ones.
+ */
+static void scoreRootMoves(SearchContext *context, int aiSide, const MoveList *moves, int remaining, int *out_scores)
+{
+    Position *position = &context->position;
+    MoveList open = {.count = 0};
+    int openIndex[MAX_MOVES];
+
+    for (int i = 0; i < moves->count; ++i)
+    {
+        int cell = moves->cells[i];
+        placeStone(position, aiSide, cell);
+        if (didLastMoveWin(position, aiSide, cell))
+        {
+            out_scores[i] = AI_WIN_SCORE - 1;
+        }
+        else if (position->empties == 0)
+        {
+            out_scores[i] = TIE_SCORE;
+        }
+        else
+        {
+            openIndex[open.count] = i;
+            open.cells[open.count++] = cell;
+        }
+        removeStone(position, aiSide, cell);
+    }
+
+    if (open.count > 1 && context->splitRoot)
+    {
+        RootJob job = {
+            .base = context,
+            .aiSide = aiSide,
+            .moves = &open,
+            .remaining = remaining,
+            .exactScores = 1,
+        };
+        runRootJobOnPool(context, &job);
+        for (int j = 0; j < open.count; ++j)
+            out_scores[openIndex[j]] = job.scores[j];
+        return;
+    }
+
+    for (int j = 0; j < open.count; ++j)
+    {
+        int cell = open.cells[j];
+        placeStone(position, aiSide, cell);
+        out_scores[openIndex[j]] = -negamax(context, !aiSide, 1, remaining - 1, -INF, INF);
+        removeStone(position, aiSide, cell);
+    }
+}
+
+/*
+ * Root driver guess for the engine's next search, for aiPlayer: the previous
+ * search's score, seen from aiPlayer, with a forced result one ply (the other
+ * side moves next) or two plies (aiPlayer moved and was answered) closer.
+ * Draw (0) without a previous search.
+ */
+static int scoreGuess(const MiniMaxEngine *engine, char aiPlayer)
+{
+    if (engine->lastPlayer == 0)
+        return TIE_SCORE;
+
+    int sameSide = engine->lastPlayer == aiPlayer;
+    int score = sameSide ? engine->lastScore : -engine->lastScore;
+    int plies = sameSide ? 2 : 1;
+    if (score > EVAL_SCORE_LIMIT)
+        return score + plies < AI_WIN_SCORE ? score + plies : AI_WIN_SCORE - 1;
+    if (score < -EVAL_SCORE_LIMIT)
+        return score - plies > PLAYER_WIN_SCORE ? score - plies : PLAYER_WIN_SCORE + 1;
+    return score;
+}
+
+/*
+ * Search on the engine's own scratch context (and worker pool), then add the
+ * work to its totals and keep the history and score for the next search.
+ */
+static void runSearch(MiniMaxEngine *engine, const char board[BOARD_ROWS][BOARD_COLS], char aiPlayer, int maxDepth, unsigned long long maxNodes, long moveTimeMs, MoveResult *out_result)
+{
+    SearchContext *context = &engine->scratch;
+    int guess = scoreGuess(engine, aiPlayer);
+    if (!searchPosition(context, engine->moveStack, engine->pool.helperCount > 0, guess, board, aiPlayer, maxDepth, maxNodes, moveTimeMs, out_result))
+        return;
+
+    engine->lastScore = out_result->score;
+    engine->lastPlayer = aiPlayer;
+    addCounters(&engine->totals, &context->counters);
+    addStats(&engine->stats, &context->stats);
+    if (engine->config.keepHistory)
+        memcpy(engine->history, context->history, sizeof(engine->history));
+}
+
+/* Fill config with the defaults used by getAiMove. */
+void defaultMiniMaxConfig(MiniMaxConfig *out_config)
+{
+    *out_config = (MiniMaxConfig){
+        .ttMegabytes = DEFAULT_TT_MEGABYTES,
+        .useSymmetry = 1,
+        .searchThreads = 1,
+        .maxDepth = 0,
+        .maxNodes = 0,
+        .moveTimeMs = 0,
+        .solveEmpties = DEFAULT_SOLVE_EMPTIES,
+        .evalDepth = DEFAULT_EVAL_DEPTH,
+        .candidateRadius = DEFAULT_CANDIDATE_RADIUS,
+        .keepHistory = 0,
+        .usePerfectTable = 1,
+        .tablebase = NULL,
+        .solvedCache = NULL,
+        .rootDriver = ROOT_DRIVER_PVS,
+        .backend = SEARCH_BACKEND_MINIMAX,
+        .maxPlayouts = 0,
+        .treeMegabytes = DEFAULT_TREE_MEGABYTES,
+        .lightPlayouts = 1,
+    };
+}
+
+/*
+ * Apply a new configuration: the table is reallocated (and so emptied) only
+ * when its size changes, cleared when symmetry sharing is toggled or the
+ * candidate radius changes (stored scores depend on both), and the worker
+ * pool is restarted when the thread count changes. Kept history is dropped
+ * whenever keepHistory is off. The MCTS node arena is kept only for the MCTS
+ * backend and reallocated when its size changes.
+ */
+int configureMiniMaxEngine(MiniMaxEngine *engine, const MiniMaxConfig *config)
+{
+    int result = 0;
+    MiniMaxConfig previous = engine->config;
+    engine->config = *config;
+
+    if (engine->ttEntries == NULL || config->ttMegabytes != previous.ttMegabytes)
+    {
+        if (resizeTable(engine, config->ttMegabytes) != 0)
+            result = -1;
+    }
+    else if ((config->useSymmetry != 0) != (previous.useSymmetry != 0) ||
+             config->candidateRadius != previous.candidateRadius)
+    {
+        clearEngineCache(engine);
+    }
+    if (!config->keepHistory)
+        memset(engine->history, 0, sizeof(engine->history));
+
+    if (config->backend != SEARCH_BACKEND_MCTS)
+    {
+        resizeTree(engine, 0);
+    }
+    else if (engine->treeNodes == NULL || config->treeMegabytes != previous.treeMegabytes)
+    {
+        if (resizeTree(engine, config->treeMegabytes) != 0)
+            result = -1;
+    }
+
+    int helpers = config->searchThreads > 1 ? config->searchThreads - 1 : 0;
+    if (helpers != engine->pool.helperCount)
+    {
+        stopWorkers(&engine->pool);
+        if (startWorkers(&engine->pool, helpers) != 0)
+            result = -1;
+    }
+
+    return result;
+}
+
+/* Create an engine; NULL config means defaultMiniMaxConfig(). */
+MiniMaxEngine *createMiniMaxEngine(const MiniMaxConfig *config)
+{
+    MiniMaxConfig defaults;
+    if (config == NULL)
+    {
+        defaultMiniMaxConfig(&defaults);
+        config = &defaults;
+    }
+
+    MiniMaxEngine *engine = calloc(1, sizeof(MiniMaxEngine));
+    if (engine == NULL)
+        return NULL;
+
+    pthread_mutex_init(&engine->pool.mutex, NULL);
+    pthread_cond_init(&engine->pool.workReady, NULL);
+    pthread_cond_init(&engine->pool.workDone, NULL);
+    engine->scratch.engine = engine;
+
+    if (configureMiniMaxEngine(engine, config) != 0)
+    {
+        destroyMiniMaxEngine(engine);
+        return NULL;
+    }
+    return engine;
+}
+
+/* Stop the engine's threads and free everything it owns. */
+void destroyMiniMaxEngine(MiniMaxEngine *engine)
+{
+    if (engine == NULL)
+        return;
+
+    stopWorkers(&engine->pool);
+    pthread_mutex_destroy(&engine->pool.mutex);
+    pthread_cond_destroy(&engine->pool.workReady);
+    pthread_cond_destroy(&engine->pool.workDone);
+    free(engine->ttEntries);
+    free(engine->treeNodes);
+    free(engine);
+}
+
+/*
+ * Answer a full-depth query from the generated perfect-play table: a base-3
+ * position code indexes the move and root score the search would return.
+ * Returns 1 on a hit; 0 when the position is not in the table or no table
+ * was built (other board sizes, or builds without HAVE_PERFECT_TABLE).
+ */
+static int perfectLookup(const char board[BOARD_ROWS][BOARD_COLS], char aiPlayer, MoveResult *out_result)
+{
+#ifdef PERFECT_TABLE_AVAILABLE
+    int code = 0;
+    int empties = 0;
+    for (int cell = MAX_MOVES - 1; cell >= 0; --cell)
+    {
+        char symbol = board[cell / BOARD_COLS][cell % BOARD_COLS];
+        code = code * 3 + (symbol == 'x' ? 1 : symbol == 'o' ? 2 : 0);
+        empties += symbol != 'x' && symbol != 'o';
+    }
+
+    uint16_t entry = perfectTable[aiPlayer == 'x' ? SIDE_X : SIDE_O][code];
+    if (entry == 0)
+        return 0;
+
+    int cell = (entry & 0xFF) - 2;
+    *out_result = (MoveResult){
+        .row = cell < 0 ? -1 : cell / BOARD_COLS,
+        .col = cell < 0 ? -1 : cell % BOARD_COLS,
+        .score = (int8_t)(entry >> 8),
+        .depth = empties,
+        .solved = 1,
+    };
+    return 1;
+#else
+    (void)board;
+    (void)aiPlayer;
+    (void)out_result;
+    return 0;
+#endif
+}
+
+/*
+ * Choose the move from the tablebase without searching: every root move is
+ * scored from the stored value of its successor, converted to the search's
+ * depth-adjusted scale, and the first best move in search order is kept, which
+ * is exactly the move the full search returns. `context` and `moveStack` hold
+ * the root position. Returns 1 when answered, 0 when a successor is not in the
+ * table (unreachable stone counts) or the board is too large for a tablebase.
+ */
+static int tablebaseMove(SearchContext *context, int *moveStack, const char board[BOARD_ROWS][BOARD_COLS], char aiPlayer, MoveResult *out_result)
+{
+#if MAX_MOVES <= TABLEBASE_MAX_CELLS
+    pthread_once(&tablesOnce, initTables);
+
+    const MiniMaxEngine *engine = context->engine;
+    int aiSide = (aiPlayer == 'x') ? SIDE_X : SIDE_O;
+    MoveList moves;
+    *out_result = (MoveResult){0};
+    /* the table knows every move, so none are left out */
+    if (!prepareRoot(context, moveStack, board, aiSide, 0, &moves, out_result))
+        return 1;
+
+    Position *position = &context->position;
+    uint32_t other = (uint32_t)position->stones[!aiSide].words[0];
+    int bestCell = moves.cells[0];
+    int bestScore = -INF;
+
+    for (int i = 0; i < moves.count; ++i)
+    {
+        int cell = moves.cells[i];
+        placeStone(position, aiSide, cell);
+        int score;
+        if (didLastMoveWin(position, aiSide, cell))
+        {
+            score = AI_WIN_SCORE - 1;
+        }
+        else
+        {
+            uint8_t reply = probeTablebase(engine->config.tablebase, other, (uint32_t)position->stones[aiSide].words[0]);
+            int plies = TABLEBASE_DISTANCE(reply) + 1;
+            switch (TABLEBASE_RESULT(reply))
+            {
+            case TABLEBASE_WIN:
+                score = PLAYER_WIN_SCORE + plies;
+                break;
+            case TABLEBASE_LOSS:
+                score = AI_WIN_SCORE - plies;
+                break;
+            case TABLEBASE_DRAW:
+                score = TIE_SCORE;
+                break;
+            default:
+                removeStone(position, aiSide, cell);
+                return 0;
+            }
+        }
+        removeStone(position, aiSide, cell);
+
+        if (score > bestScore)
+        {
+            bestScore = score;
+            bestCell = cell;
+        }
+    }
+
+    out_result->row = bestCell / BOARD_COLS;
+    out_result->col = bestCell % BOARD_COLS;
+    out_result->score = bestScore;
+    out_result->depth = moves.count;
+    out_result->solved = 1;
+    return 1;
+#else
+    (void)context;
+    (void)moveStack;
+    (void)board;
+    (void)aiPlayer;
+    (void)out_result;
+    return 0;
+#endif
+}
+
+/*
+ * Answer a full-depth query from the solved-position cache. Only positions
+ * the search would solve outright (at most solveEmpties empty cells) are
+ * looked up, since only those are recorded. Returns 1 on a hit.
+ */
+static int cachedMove(const MiniMaxConfig *config, const char board[BOARD_ROWS][BOARD_COLS], char aiPlayer, MoveResult *out_result)
+{
+    int empties = 0;
+    for (int cell = 0; cell < MAX_MOVES; ++cell)
+    {
+        char symbol = board[cell / BOARD_COLS][cell % BOARD_COLS];
+        empties += symbol != 'x' && symbol != 'o';
+    }
+    if (empties > solveEmptiesLimit(config))
+        return 0;
+
+    int cell;
+    int score;
+    if (!probeSolvedCache(config->solvedCache, board, aiPlayer, &cell, &score))
+        return 0;
+    if (score < -AI_WIN_SCORE || score > AI_WIN_SCORE)
+        return 0; /* not a score this engine records: a damaged file */
+
+    *out_result = (MoveResult){
+        .row = cell / BOARD_COLS,
+        .col = cell % BOARD_COLS,
+        .score = score,
+        .depth = empties,
+        .solved = 1,
+    };
+    return 1;
+}
+
+/*
+ * Answer from the perfect-play table, the tablebase or the solved-position
+ * cache when the engine's configuration allows it. Full-depth 3x3 queries use
+ * the perfect-play table; a configured tablebase answers regardless of
+ * limits; the cache answers full-depth queries. Returns 1 when answered.
+ */
+static int lookupMove(SearchContext *context, int *moveStack, const char board[BOARD_ROWS][BOARD_COLS], char aiPlayer, MoveResult *out_result)
+{
+    const MiniMaxConfig *config = &context->engine->config;
+    int unlimited = config->maxDepth <= 0 && config->maxNodes == 0 && config->moveTimeMs <= 0;
+    if (config->usePerfectTable && unlimited && perfectLookup(board, aiPlayer, out_result))
+        return 1;
+    if (config->tablebase != NULL && tablebaseMove(context, moveStack, board, aiPlayer, out_result))
+        return 1;
+    return config->solvedCache != NULL && unlimited && cachedMove(config, board, aiPlayer, out_result);
+}
 
-/* A trivial fixed-size container for generated legal moves. */
+/*
+ * One Monte Carlo search: the root position, the shared playout budget and
+ * deadline, and the arena's fill level. Every thread of the pool runs
+ * iterations on its own copy of the position until a limit is reached.
+ */
 typedef struct
 {
-    Move moves[MAX_MOVES];
-    int count;
-} MoveList;
+    MiniMaxEngine *engine;
+    Position root;
+    int rootSide;
+    uint64_t seed;
+    atomic_size_t treeUsed; /* arena nodes handed out; may overshoot the capacity */
+    atomic_int treeFull;    /* an expansion did not fit; the tree stops growing */
+    atomic_ullong claimed;  /* playouts started, checked against maxPlayouts */
+    atomic_int nextThread;
+    unsigned long long maxPlayouts; /* 0 = none */
+    int hasDeadline;
+    struct timespec deadline;
+    unsigned long long playouts; /* finished playouts, under mutex */
+    int depth;                   /* deepest tree ply reached, under mutex */
+    pthread_mutex_t mutex;
+} MctsJob;
+
+/* xorshift64*: the playout generator, one state per thread. */
+static inline uint64_t nextPlayoutRandom(uint64_t *state)
+{
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 0x2545F4914F6CDD1DULL;
+}
 
-/* Helper constants used by the evaluation and search. */
-typedef enum
+/* A random number below count (count > 0). */
+static inline int randomBelow(uint64_t *state, int count)
 {
-    AI_WIN_SCORE = 100,
-    PLAYER_WIN_SCORE = -100,
-    TIE_SCORE = 0,
-    CONTINUE_SCORE = 1,
-    INF = INT_MAX
-} HelperScores;
+    return (int)(((nextPlayoutRandom(state) >> 32) * (uint64_t)count) >> 32);
+}
 
-/* Collect all empty cells in row-major order. */
-static void findEmptySpots(const char board[BOARD_SIZE][BOARD_SIZE], MoveList *out_emptySpots)
+/*
+ * Light playout policy: a cell `side` must play, or -1. A line through
+ * ownLast that `side` can complete wins; a line through opponentLast that the
+ * opponent could complete next has to be blocked. Lines through older moves
+ * are not checked, so threats are only seen on the move after they appear.
+ */
+static int forcedCell(const Position *position, int side, int ownLast, int opponentLast)
 {
-    out_emptySpots->count = 0;
-    for (int i = 0; i < BOARD_SIZE; i++)
+    int lastCells[2] = {ownLast, opponentLast};
+    for (int k = 0; k < 2; ++k)
     {
-        for (int j = 0; j < BOARD_SIZE; j++)
+        int cell = lastCells[k];
+        int owner = k == 0 ? side : !side;
+        if (cell < 0)
+            continue;
+        for (int i = 0; i < cellLineCount[cell]; ++i)
         {
-            if (board[i][j] == ' ')
+            int line = cellLines[cell][i];
+            if (position->lineCounts[owner][line] != WIN_LENGTH - 1 || position->lineCounts[!owner][line] != 0)
+                continue;
+            Bitboard stones = bitboardOr(position->stones[SIDE_X], position->stones[SIDE_O]);
+            for (int j = 0; j < WIN_LENGTH; ++j)
             {
-                out_emptySpots->moves[out_emptySpots->count++] = (Move){i, j};
+                if (!bitboardTest(stones, lineCells[line][j]))
+                    return lineCells[line][j];
             }
         }
     }
+    return -1;
 }
 
 /*
- * Heuristic weight for move ordering:
- *  - 4: exact center (Manhattan distance 0 to center)
- *  - 3: on a diagonal OR Manhattan distance 1 from center
- *  - 2: everything else
- * Works for odd and even BOARD_SIZE by using two central indices.
+ * Play the game out from `position` with `side` to move: random moves over
+ * every empty cell, or with `light` the forced ones first (see forcedCell).
+ * ownLast and opponentLast are the last moves of the side to move and of its
+ * opponent (-1 when unknown). Returns the winning side, or -1 for a draw.
  */
-static int moveWeight(int row, int col)
+static int playout(Position *position, int side, int ownLast, int opponentLast, uint64_t *random, int light)
 {
-    int lowerMiddle = (BOARD_SIZE - 1) / 2;
-    int upperMiddle = BOARD_SIZE / 2;
-
-    int distanceRowToLowerMiddle = row - lowerMiddle;
-    if (distanceRowToLowerMiddle < 0)
-        distanceRowToLowerMiddle = -distanceRowToLowerMiddle;
-
-    int distanceRowToUpperMiddle = row - upperMiddle;
-    if (distanceRowToUpperMiddle < 0)
-        distanceRowToUpperMiddle = -distanceRowToUpperMiddle;
-
-    int minimalRowDistance = distanceRowToLowerMiddle < distanceRowToUpperMiddle ? distanceRowToLowerMiddle : distanceRowToUpperMiddle;
-
-    int distanceColumnToLowerMiddle = col - lowerMiddle;
-    if (distanceColumnToLowerMiddle < 0)
-        distanceColumnToLowerMiddle = -distanceColumnToLowerMiddle;
-
-    int distanceColumnToUpperMiddle = col - upperMiddle;
-    if (distanceColumnToUpperMiddle < 0)
-        distanceColumnToUpperMiddle = -distanceColumnToUpperMiddle;
-
-    int minimalColumnDistance = distanceColumnToLowerMiddle < distanceColumnToUpperMiddle ? distanceColumnToLowerMiddle : distanceColumnToUpperMiddle;
-
-    int manhattanDistanceToCenter = minimalRowDistance + minimalColumnDistance;
-
-    if (manhattanDistanceToCenter == 0)
-        return 4;
-
-    if (row == col || row + col == BOARD_SIZE - 1)
-        return 3;
-
-    if (manhattanDistanceToCenter == 1)
-        return 3;
+    int cells[MAX_MOVES];
+    int slots[MAX_MOVES]; /* index of each empty cell in cells */
+    int count = 0;
+    for (int cell = position->emptyNext[MAX_MOVES]; cell != MAX_MOVES; cell = position->emptyNext[cell])
+    {
+        slots[cell] = count;
+        cells[count++] = cell;
+    }
 
-    return 2;
+    while (count > 0)
+    {
+        int cell = light ? forcedCell(position, side, ownLast, opponentLast) : -1;
+        if (cell < 0)
+            cell = cells[randomBelow(random, count)];
+        int last = cells[--count];
+        cells[slots[cell]] = last;
+        slots[last] = slots[cell];
+
+        placeStone(position, side, cell);
+        if (didLastMoveWin(position, side, cell))
+            return side;
+        ownLast = opponentLast;
+        opponentLast = cell;
+        side = !side;
+    }
+    return -1;
 }
 
 /*
- * Fast win check based on the last move applied.
- * Only scans the affected row, column, and relevant diagonal(s).
+ * Give `node` (held in MCTS_EXPANDING by the caller) one child per candidate
+ * move of `position`, `side` to move, in static order. A move that wins on
+ * the spot is the only child kept: nothing else needs exploring. Publishes
+ * the children and returns 1, or returns the node to MCTS_LEAF and marks the
+ * tree full when the arena has no room.
  */
-static int didLastMoveWin(const char board[BOARD_SIZE][BOARD_SIZE], int row, int col)
+static int expandNode(MctsJob *job, MctsNode *node, Position *position, int side)
 {
-    char player = board[row][col];
-    if (player == ' ')
-        return 0;
+    MiniMaxEngine *engine = job->engine;
+    int cells[MAX_MOVES];
+    int count = generateMoves(position, engine->config.candidateRadius, cells);
+    orderMoves(cells, count, -1, NULL, NULL);
 
-    int win = 1;
-    for (int c = 0; c < BOARD_SIZE; ++c)
+    int terminal = position->empties == 1 ? MCTS_DRAWN : MCTS_OPEN;
+    for (int i = 0; i < count; ++i)
     {
-        if (board[row][c] != player)
+        placeStone(position, side, cells[i]);
+        int win = didLastMoveWin(position, side, cells[i]);
+        removeStone(position, side, cells[i]);
+        if (win)
         {
-            win = 0;
+            cells[0] = cells[i];
+            count = 1;
+            terminal = MCTS_WON;
             break;
         }
     }
-    if (win)
-        return 1;
 
-    win = 1;
-    for (int r = 0; r < BOARD_SIZE; ++r)
+    size_t first = atomic_fetch_add(&job->treeUsed, (size_t)count);
+    if (first + (size_t)count > engine->treeCapacity)
     {
-        if (board[r][col] != player)
-        {
-            win = 0;
-            break;
-        }
+        atomic_store(&job->treeFull, 1);
+        atomic_store(&node->state, MCTS_LEAF);
+        return 0;
     }
-    if (win)
-        return 1;
 
-    if (row == col)
+    for (int i = 0; i < count; ++i)
+    {
+        MctsNode *child = &engine->treeNodes[first + (size_t)i];
+        atomic_init(&child->visits, 0);
+        atomic_init(&child->rewards, 0);
+        atomic_init(&child->state, MCTS_LEAF);
+        child->firstChild = 0;
+        child->childCount = 0;
+        child->cell = (int16_t)cells[i];
+        child->terminal = (int8_t)terminal;
+    }
+    node->firstChild = (uint32_t)first;
+    node->childCount = (uint16_t)count;
+    atomic_store(&node->state, MCTS_EXPANDED);
+    return 1;
+}
+
+/*
+ * UCT: the child with the best mean reward plus exploration bonus, trying
+ * every child once first (in static order). Visits include playouts in
+ * flight, which add no reward until they finish.
+ */
+static MctsNode *selectChild(MctsNode *nodes, const MctsNode *parent)
+{
+    MctsNode *children = &nodes[parent->firstChild];
+    double logVisits = log((double)atomic_load_explicit(&parent->visits, memory_order_relaxed));
+    MctsNode *best = &children[0];
+    double bestValue = -1.0;
+    for (int i = 0; i < parent->childCount; ++i)
     {
-        win = 1;
-        for (int i = 0; i < BOARD_SIZE; ++i)
+        unsigned visits = atomic_load_explicit(&children[i].visits, memory_order_relaxed);
+        if (visits == 0)
+            return &children[i];
+        unsigned rewards = atomic_load_explicit(&children[i].rewards, memory_order_relaxed);
+        double value = rewards / (2.0 * visits) + MCTS_EXPLORATION * sqrt(logVisits / visits);
+        if (value > bestValue)
         {
-            if (board[i][i] != player)
-            {
-                win = 0;
-                break;
-            }
+            bestValue = value;
+            best = &children[i];
         }
-        if (win)
-            return 1;
     }
+    return best;
+}
 
-    if (row + col == BOARD_SIZE - 1)
+/*
+ * Pool task of a Monte Carlo search. Each iteration walks down the shared
+ * tree from the root by UCT, expanding a leaf that has been visited often
+ * enough, plays the game out from where the walk stopped and adds the result
+ * to every node on the path.
+ */
+static void runMctsJob(void *arg, SearchContext *context, int *moveStack)
+{
+    (void)moveStack;
+    MctsJob *job = arg;
+    MiniMaxEngine *engine = job->engine;
+    MctsNode *nodes = engine->treeNodes;
+    int light = engine->config.lightPlayouts;
+    MctsNode *path[MAX_MOVES + 1];
+    unsigned long long playouts = 0;
+    int deepest = 0;
+
+    uint64_t seed = job->seed + (uint64_t)atomic_fetch_add(&job->nextThread, 1);
+    uint64_t random = nextRandom(&seed) | 1;
+
+    /* the context only serves its deadline polling (limitReached) and its position */
+    *context = (SearchContext){
+        .engine = engine,
+        .hasDeadline = job->hasDeadline,
+        .deadline = job->deadline,
+        .pollCountdown = 1,
+    };
+    Position *position = &context->position;
+
+    while (!limitReached(context))
     {
-        win = 1;
-        for (int i = 0; i < BOARD_SIZE; ++i)
+        if (job->maxPlayouts != 0 && atomic_fetch_add(&job->claimed, 1) >= job->maxPlayouts)
+            break;
+
+        *position = job->root;
+        int side = job->rootSide;
+        int ownLast = -1;
+        int opponentLast = -1;
+        int depth = 0;
+        MctsNode *node = &nodes[0];
+        path[0] = node;
+        atomic_fetch_add_explicit(&node->visits, 1, memory_order_relaxed);
+
+        while (node->terminal == MCTS_OPEN)
         {
-            if (board[i][BOARD_SIZE - 1 - i] != player)
+            int state = atomic_load(&node->state);
+            if (state == MCTS_LEAF && atomic_load_explicit(&node->visits, memory_order_relaxed) >= MCTS_EXPAND_VISITS &&
+                !atomic_load_explicit(&job->treeFull, memory_order_relaxed) &&
+                atomic_compare_exchange_strong(&node->state, &state, MCTS_EXPANDING))
             {
-                win = 0;
-                break;
+                state = expandNode(job, node, position, side) ? MCTS_EXPANDED : MCTS_LEAF;
             }
+            if (state != MCTS_EXPANDED)
+                break;
+
+            node = selectChild(nodes, node);
+            atomic_fetch_add_explicit(&node->visits, 1, memory_order_relaxed);
+            placeStone(position, side, node->cell);
+            ownLast = opponentLast;
+            opponentLast = node->cell;
+            side = !side;
+            path[++depth] = node;
         }
-        if (win)
-            return 1;
+
+        int winner;
+        if (node->terminal == MCTS_WON)
+            winner = !side;
+        else if (node->terminal == MCTS_DRAWN)
+            winner = -1;
+        else
+            winner = playout(position, side, ownLast, opponentLast, &random, light);
+
+        /* path[i] was entered by a move of the side to move at path[i - 1] */
+        int mover = job->rootSide;
+        for (int i = 1; i <= depth; ++i)
+        {
+            unsigned reward = winner == mover ? 2 : winner < 0 ? 1 : 0;
+            atomic_fetch_add_explicit(&path[i]->rewards, reward, memory_order_relaxed);
+            mover = !mover;
+        }
+
+        ++playouts;
+        if (depth > deepest)
+            deepest = depth;
     }
 
-    return 0;
+    pthread_mutex_lock(&job->mutex);
+    job->playouts += playouts;
+    if (deepest > job->depth)
+        job->depth = deepest;
+    pthread_mutex_unlock(&job->mutex);
 }
 
 /*
- * Partition moves by weight into three buckets and concatenate them
- * (4 -> 3 -> 2). Within each bucket, original row-major ordering is kept,
- * ensuring deterministic results for tied scores.
+ * Choose a move by Monte Carlo tree search on the engine's arena and pool.
+ * The root is expanded before the threads start, so a move that wins on the
+ * spot or a single candidate is answered without playouts. Otherwise the
+ * most visited root move is played (the better reward breaks ties). The tree
+ * is rebuilt for every move.
  */
-static void orderMoves(MoveList *moves)
+static void mctsMove(MiniMaxEngine *engine, const char board[BOARD_ROWS][BOARD_COLS], char aiPlayer, MoveResult *out_result)
 {
-    Move movesWithWeightFour[MAX_MOVES];
-    Move movesWithWeightThree[MAX_MOVES];
-    Move movesWithWeightTwo[MAX_MOVES];
-    int movesWithWeightFourCount = 0;
-    int movesWithWeightThreeCount = 0;
-    int movesWithWeightTwoCount = 0;
+    pthread_once(&tablesOnce, initTables);
 
-    for (int moveIndex = 0; moveIndex < moves->count; ++moveIndex)
+    const MiniMaxConfig *config = &engine->config;
+    MctsJob job = {.engine = engine, .rootSide = (aiPlayer == 'x') ? SIDE_X : SIDE_O};
+    *out_result = (MoveResult){.row = -1, .col = -1};
+    loadPosition(board, 1, &job.root);
+    if (boardScore(&job.root, job.rootSide) != CONTINUE_SCORE)
+        return;
+
+    MctsNode *root = &engine->treeNodes[0];
+    atomic_init(&root->visits, 0);
+    atomic_init(&root->rewards, 0);
+    atomic_init(&root->state, MCTS_EXPANDING);
+    root->terminal = MCTS_OPEN;
+    atomic_init(&job.treeUsed, 1);
+    atomic_init(&job.treeFull, 0);
+    expandNode(&job, root, &job.root, job.rootSide);
+
+    MctsNode *children = &engine->treeNodes[root->firstChild];
+    if (root->childCount == 1)
     {
-        Move move = moves->moves[moveIndex];
-        int weight = moveWeight(move.row, move.col);
-        if (weight == 4)
-        {
-            movesWithWeightFour[movesWithWeightFourCount++] = move;
-        }
-        else if (weight == 3)
+        out_result->row = children[0].cell / BOARD_COLS;
+        out_result->col = children[0].cell % BOARD_COLS;
+        if (children[0].terminal == MCTS_WON)
         {
-            movesWithWeightThree[movesWithWeightThreeCount++] = move;
-        }
-        else
-        {
-            movesWithWeightTwo[movesWithWeightTwoCount++] = move;
+            out_result->score = AI_WIN_SCORE - 1;
+            out_result->depth = 1;
+            out_result->solved = 1;
         }
+        return;
     }
 
-    int writeIndex = 0;
-    for (int index = 0; index < movesWithWeightFourCount; ++index)
+    job.maxPlayouts = config->maxPlayouts;
+    if (config->moveTimeMs > 0)
     {
-        moves->moves[writeIndex++] = movesWithWeightFour[index];
+        job.hasDeadline = 1;
+        setDeadline(&job.deadline, config->moveTimeMs);
     }
-    for (int index = 0; index < movesWithWeightThreeCount; ++index)
+    else if (job.maxPlayouts == 0)
     {
-        moves->moves[writeIndex++] = movesWithWeightThree[index];
+        job.maxPlayouts = DEFAULT_MCTS_PLAYOUTS;
     }
-    for (int index = 0; index < movesWithWeightTwoCount; ++index)
+    job.seed = job.root.hashes[0] ^ (uint64_t)job.rootSide;
+    atomic_init(&job.claimed, 0);
+    atomic_init(&job.nextThread, 0);
+    pthread_mutex_init(&job.mutex, NULL);
+
+    runOnPool(&engine->pool, runMctsJob, &job, &engine->scratch, engine->moveStack);
+
+    pthread_mutex_destroy(&job.mutex);
+
+    const MctsNode *best = &children[0];
+    for (int i = 1; i < root->childCount; ++i)
     {
-        moves->moves[writeIndex++] = movesWithWeightTwo[index];
+        unsigned visits = atomic_load(&children[i].visits);
+        unsigned bestVisits = atomic_load(&best->visits);
+        if (visits > bestVisits || (visits == bestVisits && atomic_load(&children[i].rewards) > atomic_load(&best->rewards)))
+            best = &children[i];
     }
+
+    long long visits = atomic_load(&best->visits);
+    long long rewards = atomic_load(&best->rewards);
+    size_t used = atomic_load(&job.treeUsed);
+    out_result->row = best->cell / BOARD_COLS;
+    out_result->col = best->cell % BOARD_COLS;
+    out_result->score = visits > 0 ? (int)((rewards - visits) * EVAL_SCORE_LIMIT / visits) : TIE_SCORE;
+    out_result->depth = job.depth;
+    out_result->counters.nodes = used < engine->treeCapacity ? used : engine->treeCapacity;
+    out_result->counters.playouts = job.playouts;
+    addCounters(&engine->totals, &out_result->counters);
 }
 
-/*
- * Terminal evaluation:
- *  - +100 if a line completed by aiPlayer
- *  - -100 if a line completed by opponent
- *  -  0 for tie
- *  -  1 (CONTINUE_SCORE) if the game is not terminal
- */
-static int boardScore(const char board[BOARD_SIZE][BOARD_SIZE], char aiPlayer)
+/* Run the MCTS backend, or look the move up, or search with the engine's configured limits. */
+int getAiMoveEx(MiniMaxEngine *engine, char board[BOARD_ROWS][BOARD_COLS], char aiPlayer, MoveResult *out_result)
 {
-    for (int i = 0; i < BOARD_SIZE; i++)
-    {
-        char first = board[i][0];
-
-        if (first == ' ')
-            continue;
-
-        int allSame = 1;
-
-        for (int j = 1; j < BOARD_SIZE; j++)
-        {
-            if (board[i][j] != first)
-            {
-                allSame = 0;
-                break;
-            }
-        }
+    if (engine == NULL || board == NULL || out_result == NULL)
+        return -1;
 
-        if (allSame)
-            return (first == aiPlayer) ? AI_WIN_SCORE : PLAYER_WIN_SCORE;
+    if (engine->treeNodes != NULL)
+    {
+        mctsMove(engine, board, aiPlayer, out_result);
+        return 0;
     }
+    if (lookupMove(&engine->scratch, engine->moveStack, board, aiPlayer, out_result))
+        return 0;
+
+    runSearch(engine, board, aiPlayer, engine->config.maxDepth, engine->config.maxNodes, engine->config.moveTimeMs, out_result);
+    return 0;
+}
 
-    for (int j = 0; j < BOARD_SIZE; j++)
+/*
+ * One batch: the distinct positions are handed out one at a time through
+ * next, and each is answered serially by whichever thread claims it.
+ */
+typedef struct
+{
+    MiniMaxEngine *engine;
+    const char (*boards)[BOARD_ROWS][BOARD_COLS];
+    const char *players;
+    const size_t *positions; /* index of each distinct position in boards */
+    size_t count;            /* number of distinct positions */
+    MoveResult *results;
+    atomic_size_t next;
+    SearchCounters counters;
+    SearchStats stats;
+    pthread_mutex_t countersMutex;
+} BatchJob;
+
+/* Pool task of a batch: answer positions until none are left. */
+static void runBatchJob(void *arg, SearchContext *context, int *moveStack)
+{
+    BatchJob *job = arg;
+    MiniMaxEngine *engine = job->engine;
+    const MiniMaxConfig *config = &engine->config;
+    SearchCounters counters = {0};
+    SearchStats stats = {0};
+
+    size_t index;
+    context->engine = engine;
+    while ((index = atomic_fetch_add(&job->next, 1)) < job->count)
     {
-        char first = board[0][j];
+        size_t position = job->positions[index];
+        const char(*board)[BOARD_COLS] = job->boards[position];
+        char aiPlayer = job->players[position];
+        MoveResult *result = &job->results[position];
 
-        if (first == ' ')
+        if (lookupMove(context, moveStack, board, aiPlayer, result))
             continue;
-
-        int allSame = 1;
-
-        for (int i = 1; i < BOARD_SIZE; i++)
+        if (searchPosition(context, moveStack, 0, TIE_SCORE, board, aiPlayer, config->maxDepth, config->maxNodes, config->moveTimeMs, result))
         {
-            if (board[i][j] != first)
-            {
-                allSame = 0;
-                break;
-            }
+            addCounters(&counters, &context->counters);
+            addStats(&stats, &context->stats);
         }
-
-        if (allSame)
-            return (first == aiPlayer) ? AI_WIN_SCORE : PLAYER_WIN_SCORE;
     }
 
-    char first = board[0][0];
+    pthread_mutex_lock(&job->countersMutex);
+    addCounters(&job->counters, &counters);
+    addStats(&job->stats, &stats);
+    pthread_mutex_unlock(&job->countersMutex);
+}
 
-    if (first != ' ')
+/* FNV-1a hash of a board and the player to move, for finding duplicates. */
+static uint64_t batchKey(const char board[BOARD_ROWS][BOARD_COLS], char aiPlayer)
+{
+    uint64_t hash = 0xCBF29CE484222325ULL;
+    for (int row = 0; row < BOARD_ROWS; ++row)
     {
-        int allSame = 1;
-
-        for (int i = 1; i < BOARD_SIZE; i++)
+        for (int col = 0; col < BOARD_COLS; ++col)
         {
-            if (board[i][i] != first)
-            {
-                allSame = 0;
-                break;
-            }
+            hash ^= (unsigned char)board[row][col];
+            hash *= 0x100000001B3ULL;
         }
-
-        if (allSame)
-            return (first == aiPlayer) ? AI_WIN_SCORE : PLAYER_WIN_SCORE;
     }
+    hash ^= (unsigned char)aiPlayer;
+    hash *= 0x100000001B3ULL;
+    return hash;
+}
 
-    first = board[0][BOARD_SIZE - 1];
+/*
+ * Answer a batch on the engine's worker pool. Duplicates are found with an
+ * open-addressing table of first occurrences and only distinct positions are
+ * searched; every duplicate then copies its first occurrence's result.
+ */
+int getAiMovesBatch(MiniMaxEngine *engine, const char boards[][BOARD_ROWS][BOARD_COLS], const char *players, MoveResult *out_results, size_t count)
+{
+    if (engine == NULL || ((boards == NULL || players == NULL || out_results == NULL) && count > 0))
+        return -1;
+    if (count == 0)
+        return 0;
 
-    if (first != ' ')
+    size_t capacity = 16;
+    while (capacity < 2 * count)
+        capacity *= 2;
+    size_t *firstOf = malloc(count * sizeof(size_t));
+    size_t *positions = malloc(count * sizeof(size_t));
+    size_t *slots = malloc(capacity * sizeof(size_t));
+    if (firstOf == NULL || positions == NULL || slots == NULL)
     {
-        int allSame = 1;
+        free(firstOf);
+        free(positions);
+        free(slots);
+        return -1;
+    }
 
-        for (int i = 1; i < BOARD_SIZE; i++)
+    /* slots hold a position index + 1, so 0 marks an empty slot */
+    memset(slots, 0, capacity * sizeof(size_t));
+    size_t distinct = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        size_t slot = (size_t)batchKey(boards[i], players[i]) & (capacity - 1);
+        firstOf[i] = i;
+        while (slots[slot] != 0)
         {
-            if (board[i][BOARD_SIZE - 1 - i] != first)
+            size_t other = slots[slot] - 1;
+            if (players[other] == players[i] && memcmp(boards[other], boards[i], sizeof(boards[i])) == 0)
             {
-                allSame = 0;
+                firstOf[i] = other;
                 break;
             }
+            slot = (slot + 1) & (capacity - 1);
+        }
+        if (firstOf[i] == i)
+        {
+            slots[slot] = i + 1;
+            positions[distinct++] = i;
         }
+    }
+    free(slots);
 
-        if (allSame)
-            return (first == aiPlayer) ? AI_WIN_SCORE : PLAYER_WIN_SCORE;
+    /* Monte Carlo searches use the whole pool for one position at a time */
+    if (engine->treeNodes != NULL)
+    {
+        for (size_t i = 0; i < distinct; ++i)
+            mctsMove(engine, boards[positions[i]], players[positions[i]], &out_results[positions[i]]);
+    }
+    else
+    {
+        BatchJob job = {
+            .engine = engine,
+            .boards = boards,
+            .players = players,
+            .positions = positions,
+            .count = distinct,
+            .results = out_results,
+        };
+        atomic_init(&job.next, 0);
+        pthread_mutex_init(&job.countersMutex, NULL);
+
+        runOnPool(&engine->pool, runBatchJob, &job, &engine->scratch, engine->moveStack);
+
+        pthread_mutex_destroy(&job.countersMutex);
+        addCounters(&engine->totals, &job.counters);
+        addStats(&engine->stats, &job.stats);
     }
 
-    for (int i = 0; i < BOARD_SIZE; i++)
+    for (size_t i = 0; i < count; ++i)
     {
-        for (int j = 0; j < BOARD_SIZE; j++)
+        if (firstOf[i] != i)
         {
-            if (board[i][j] == ' ')
-                return CONTINUE_SCORE;
+            out_results[i] = out_results[firstOf[i]];
+            out_results[i].counters = (SearchCounters){0};
         }
     }
 
-    return TIE_SCORE;
+    free(firstOf);
+    free(positions);
+    return 0;
 }
 
-static int miniMaxLow(char board[BOARD_SIZE][BOARD_SIZE], char aiPlayer, int depth, int alpha, int beta);
-
 /*
- * Maximizing ply (AI).
- * Returns best score achievable for aiPlayer from the current position.
+ * Multi-PV analysis: score every root move in one call (see scoreRootMoves)
+ * and sort the moves best first. Equal scores keep the search order, so the
+ * first move is the one the full search picks.
  */
-static int miniMaxHigh(char board[BOARD_SIZE][BOARD_SIZE], char aiPlayer, int depth, int alpha, int beta)
+int analyzeMovesEx(MiniMaxEngine *engine, char board[BOARD_ROWS][BOARD_COLS], char aiPlayer, MoveScore *out_scores, int *out_count)
 {
-    int state = boardScore(board, aiPlayer);
-    if (state != CONTINUE_SCORE)
-    {
-        /* terminal: propagate depth-adjusted values */
-        if (state == TIE_SCORE)
-            return TIE_SCORE;
+    if (engine == NULL || board == NULL || out_scores == NULL || out_count == NULL)
+        return -1;
 
-        if (state > 0)
-            return state - depth;
+    pthread_once(&tablesOnce, initTables);
+    *out_count = 0;
 
-        return state + depth;
-    }
+    const MiniMaxConfig *config = &engine->config;
+    SearchContext *context = &engine->scratch;
+    int aiSide = (aiPlayer == 'x') ? SIDE_X : SIDE_O;
+    MoveList moves;
+    if (!loadRoot(context, engine->moveStack, board, aiSide, config->candidateRadius, &moves))
+        return 0;
 
-    MoveList emptySpots;
-    findEmptySpots(board, &emptySpots);
-    orderMoves(&emptySpots);
-    int bestScore = -INF;
+    int remaining = FULL_DEPTH;
+    if (config->maxDepth > 0)
+        remaining = config->maxDepth < MAX_LIMITED_DEPTH ? config->maxDepth : MAX_LIMITED_DEPTH;
+    else if (context->position.empties > solveEmptiesLimit(config))
+        remaining = config->evalDepth > 0 ? config->evalDepth : DEFAULT_EVAL_DEPTH;
 
-    for (int i = 0; i < emptySpots.count; i++)
+    context->splitRoot = engine->pool.helperCount > 0;
+    memset(context->killers, -1, sizeof(context->killers));
+    int scores[MAX_MOVES];
+    scoreRootMoves(context, aiSide, &moves, remaining, scores);
+
+    for (int i = 0; i < moves.count; ++i)
     {
-        Move move = emptySpots.moves[i];
-        board[move.row][move.col] = aiPlayer;
-        int score;
-        if (didLastMoveWin(board, move.row, move.col))
-        {
-            /* immediate win after this move; prefer faster wins */
-            score = AI_WIN_SCORE - (depth + 1);
-        }
-        else if (emptySpots.count == 1)
-        {
-            score = TIE_SCORE;
-        }
-        else
+        MoveScore entry = {
+            .row = moves.cells[i] / BOARD_COLS,
+            .col = moves.cells[i] % BOARD_COLS,
+            .score = scores[i],
+        };
+        int j = i;
+        while (j > 0 && out_scores[j - 1].score < entry.score)
         {
-            score = miniMaxLow(board, aiPlayer, depth + 1, alpha, beta);
+            out_scores[j] = out_scores[j - 1];
+            --j;
         }
-        board[move.row][move.col] = ' ';
-
-        if (score > bestScore)
-            bestScore = score;
-
-        if (score > alpha)
-            alpha = score;
-        if (beta <= alpha)
-            break;
+        out_scores[j] = entry;
     }
+    *out_count = moves.count;
 
-    return bestScore;
+    addCounters(&engine->totals, &context->counters);
+    addStats(&engine->stats, &context->stats);
+    return 0;
 }
 
 /*
- * Minimizing ply (opponent).
- * Returns worst-case score for aiPlayer given optimal opponent play.
+ * Lock and return the default engine, creating it on first use.
+ * Returns NULL (unlocked) if it could not be created.
  */
-static int miniMaxLow(char board[BOARD_SIZE][BOARD_SIZE], char aiPlayer, int depth, int alpha, int beta)
+static MiniMaxEngine *lockDefaultEngine(void)
 {
+    pthread_mutex_lock(&defaultEngineMutex);
+    if (defaultEngine == NULL)
+        defaultEngine = createMiniMaxEngine(NULL);
+    if (defaultEngine == NULL)
+        pthread_mutex_unlock(&defaultEngineMutex);
+    return defaultEngine;
+}
 
-    int state = boardScore(board, aiPlayer);
-    if (state != CONTINUE_SCORE)
+/*
+ * Public entry: select the best move for aiPlayer with a full-depth search on
+ * the default engine. The char board is converted to bitboards once; the
+ * search never touches it.
+ */
+void getAiMove(char board[BOARD_ROWS][BOARD_COLS], char aiPlayer, int *out_row, int *out_col)
+{
+    MoveResult result = {.row = -1, .col = -1};
+    if (perfectLookup(board, aiPlayer, &result))
     {
-        /* terminal: propagate depth-adjusted values */
-        if (state == TIE_SCORE)
-            return TIE_SCORE;
-
-        if (state > 0)
-            return state - depth;
+        *out_row = result.row;
+        *out_col = result.col;
+        return;
+    }
 
-        return state + depth;
+    MiniMaxEngine *engine = lockDefaultEngine();
+    if (engine != NULL)
+    {
+        runSearch(engine, board, aiPlayer, 0, 0, 0, &result);
+        pthread_mutex_unlock(&defaultEngineMutex);
     }
 
-    MoveList emptySpots;
-    findEmptySpots(board, &emptySpots);
-    orderMoves(&emptySpots);
-    int bestScore = INF;
-    char opponent = (aiPlayer == 'x') ? 'o' : 'x';
+    *out_row = result.row;
+    *out_col = result.col;
+}
 
-    for (int i = 0; i < emptySpots.count; i++)
+/* Public entry: iterative deepening under a wall-clock budget on the default engine. */
+void getAiMoveTimed(char board[BOARD_ROWS][BOARD_COLS], char aiPlayer, long budget_ms, int *out_row, int *out_col)
+{
+    MoveResult result = {.row = -1, .col = -1};
+    MiniMaxEngine *engine = lockDefaultEngine();
+    if (engine != NULL)
     {
-        Move move = emptySpots.moves[i];
-        board[move.row][move.col] = opponent;
-        int score;
-        if (didLastMoveWin(board, move.row, move.col))
-        {
-            /* opponent just won; later losses are (slightly) better */
-            score = PLAYER_WIN_SCORE + (depth + 1);
-        }
-        else if (emptySpots.count == 1)
-        {
-            score = TIE_SCORE;
-        }
-        else
-        {
-            score = miniMaxHigh(board, aiPlayer, depth + 1, alpha, beta);
-        }
-        board[move.row][move.col] = ' ';
+        runSearch(engine, board, aiPlayer, 0, 0, budget_ms > 0 ? budget_ms : 0, &result);
+        pthread_mutex_unlock(&defaultEngineMutex);
+    }
 
-        if (score < bestScore)
-            bestScore = score;
+    *out_row = result.row;
+    *out_col = result.col;
+}
 
-        if (score < beta)
-            beta = score;
-        if (beta <= alpha)
-            break;
-    }
+/* Public entry: multi-PV analysis on the default engine. */
+int analyzeMoves(char board[BOARD_ROWS][BOARD_COLS], char aiPlayer, MoveScore *out_scores, int *out_count)
+{
+    MiniMaxEngine *engine = lockDefaultEngine();
+    if (engine == NULL)
+        return -1;
 
-    return bestScore;
+    int result = analyzeMovesEx(engine, board, aiPlayer, out_scores, out_count);
+    pthread_mutex_unlock(&defaultEngineMutex);
+    return result;
 }
 
-/*
- * Public entry: select the best move for aiPlayer.
- * Short-circuits:
- *  - Terminal board -> (-1, -1)
- *  - Empty board    -> center (even sizes pick (BOARD_SIZE/2, BOARD_SIZE/2))
- */
-void getAiMove(char board[BOARD_SIZE][BOARD_SIZE], char aiPlayer, int *out_row, int *out_col)
+/* Default-engine wrapper: change only the table size. */
+int setTranspositionTableSize(size_t megabytes)
 {
-    int state = boardScore(board, aiPlayer);
-    if (state != CONTINUE_SCORE)
-    {
-        *out_row = -1;
-        *out_col = -1;
+    MiniMaxEngine *engine = lockDefaultEngine();
+    if (engine == NULL)
+        return -1;
+
+    MiniMaxConfig config = engine->config;
+    config.ttMegabytes = megabytes;
+    int result = configureMiniMaxEngine(engine, &config);
+    pthread_mutex_unlock(&defaultEngineMutex);
+    return result;
+}
+
+/* Default-engine wrapper: toggle symmetry sharing (clears the table). */
+void setSymmetryCache(int enabled)
+{
+    MiniMaxEngine *engine = lockDefaultEngine();
+    if (engine == NULL)
         return;
-    }
 
-    MoveList emptySpots;
-    findEmptySpots(board, &emptySpots);
+    MiniMaxConfig config = engine->config;
+    config.useSymmetry = enabled;
+    configureMiniMaxEngine(engine, &config);
+    pthread_mutex_unlock(&defaultEngineMutex);
+}
 
-    if (emptySpots.count == BOARD_SIZE * BOARD_SIZE)
-    {
-        int lowerMiddle = (BOARD_SIZE - 1) / 2;
-        int upperMiddle = BOARD_SIZE / 2;
-        int centerRow = lowerMiddle;
-        int centerCol = lowerMiddle;
-        if (BOARD_SIZE % 2 == 0)
-        {
-            centerRow = upperMiddle;
-            centerCol = upperMiddle;
-        }
-        *out_row = centerRow;
-        *out_col = centerCol;
-        return;
-    }
+/* Default-engine wrapper: change the number of root search threads. */
+int setSearchThreads(int threads)
+{
+    MiniMaxEngine *engine = lockDefaultEngine();
+    if (engine == NULL)
+        return -1;
+
+    MiniMaxConfig config = engine->config;
+    config.searchThreads = threads;
+    int result = configureMiniMaxEngine(engine, &config);
+    pthread_mutex_unlock(&defaultEngineMutex);
+    return result;
+}
 
-    if (emptySpots.count == 1)
-    {
-        *out_row = emptySpots.moves[0].row;
-        *out_col = emptySpots.moves[0].col;
+/* Default-engine wrapper for clearEngineCache. */
+void clearTranspositionTable(void)
+{
+    MiniMaxEngine *engine = lockDefaultEngine();
+    if (engine == NULL)
         return;
-    }
 
-    orderMoves(&emptySpots);
+    clearEngineCache(engine);
+    pthread_mutex_unlock(&defaultEngineMutex);
+}
 
-    int alpha = -INF;
-    int beta = INF;
-    Move bestMove = emptySpots.moves[0];
-    int bestScore = -INF;
+/* Default-engine wrapper for getEngineCounters. */
+void getSearchCounters(SearchCounters *out_counters)
+{
+    *out_counters = (SearchCounters){0};
+    MiniMaxEngine *engine = lockDefaultEngine();
+    if (engine == NULL)
+        return;
 
-    for (int i = 0; i < emptySpots.count; ++i)
-    {
-        Move move = emptySpots.moves[i];
-        board[move.row][move.col] = aiPlayer;
+    getEngineCounters(engine, out_counters);
+    pthread_mutex_unlock(&defaultEngineMutex);
+}
 
-        if (didLastMoveWin(board, move.row, move.col))
-        {
-            board[move.row][move.col] = ' ';
-            *out_row = move.row;
-            *out_col = move.col;
-            return;
-        }
+/* Default-engine wrapper for getEngineStats. */
+void getSearchStats(SearchStats *out_stats)
+{
+    *out_stats = (SearchStats){0};
+    MiniMaxEngine *engine = lockDefaultEngine();
+    if (engine == NULL)
+        return;
 
-        int score = miniMaxLow(board, aiPlayer, 1, alpha, beta);
-        board[move.row][move.col] = ' ';
+    getEngineStats(engine, out_stats);
+    pthread_mutex_unlock(&defaultEngineMutex);
+}
 
-        if (score > bestScore)
-        {
-            bestScore = score;
-            bestMove = move;
-            alpha = score;
-        }
-    }
+/* Default-engine wrapper for resetEngineCounters. */
+void resetSearchCounters(void)
+{
+    MiniMaxEngine *engine = lockDefaultEngine();
+    if (engine == NULL)
+        return;
 
-    *out_row = bestMove.row;
-    *out_col = bestMove.col;
+    resetEngineCounters(engine);
+    pthread_mutex_unlock(&defaultEngineMutex);
 }
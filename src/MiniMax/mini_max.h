@@ -6,21 +6,40 @@
  * ---------------------
  * Public API for the Minimax-based Tic-Tac-Toe engine.
  *
- * The engine searches the full game tree using Minimax with alpha–beta pruning
- * and a lightweight move ordering heuristic. It is designed for small boards
- * (e.g., 3x3) but supports arbitrary square sizes via BOARD_SIZE.
+ * The engine searches the full game tree using Minimax with alpha–beta pruning.
+ * Moves are ordered by the transposition table's best move, killer moves and a
+ * history of earlier cutoffs, falling back to a geometric weight. It is designed for small boards
+ * (e.g., 3x3) but supports rectangular boards and k-in-a-row variants via
+ * BOARD_ROWS, BOARD_COLS and WIN_LENGTH.
  *
  * Board representation:
- * - A 2D char array sized [BOARD_SIZE][BOARD_SIZE]
+ * - A 2D char array sized [BOARD_ROWS][BOARD_COLS]
  * - 'x' and 'o' represent players; ' ' (space) represents an empty cell
  *
  * Notable characteristics:
  * - Deterministic results due to stable ordering within buckets
  * - Depth-adjusted scoring prefers faster wins and delays losses
  * - Simple opening heuristic (play center on empty board)
+ * - Transposition table keyed by the canonical orientation so the 8 board
+ *   symmetries (4 on rectangular boards) share entries
+ * - On k-in-a-row boards only cells near existing stones are searched
+ *
+ * Two ways to use it:
+ * - MiniMaxEngine: an explicit handle that owns its table, worker threads,
+ *   scratch buffers, limits and counters. Independent engines can search
+ *   concurrently; one engine runs one search at a time.
+ * - getAiMove() and friends: the classic API, backed by a lazily created
+ *   default engine. Calls from several threads are serialized.
+ *
+ * An engine can also choose its moves with Monte Carlo tree search instead of
+ * minimax (MiniMaxConfig.backend), an anytime player for boards too large to
+ * search to the end.
  */
 
+#include <stddef.h>
 #include "../TicTacToe/tic_tac_toe.h"
+#include "../SolvedCache/solved_cache.h"
+#include "../Tablebase/tablebase.h"
 
 /**
  * Compute the AI's next move using Minimax with alpha–beta pruning.
@@ -31,11 +50,357 @@
  *  - out_row:   Output pointer for selected row (0-based). Set to -1 if the game is already terminal
  *  - out_col:   Output pointer for selected column (0-based). Set to -1 if the game is already terminal
  *
+ * Thread safety: may be called from several threads; calls share the default
+ * engine and run one at a time. Use one MiniMaxEngine per thread to search in
+ * parallel.
+ *
  * Behavior:
  *  - If the board is terminal (win/tie), returns (-1, -1)
  *  - On an empty board, selects the center without searching
  *  - Otherwise, orders candidate moves and runs a full-depth alpha–beta search
+ *  - With more than 16 empty cells (large boards), searches 4 plies instead and
+ *    scores the horizon with a static evaluation
+ */
+void getAiMove(char board[BOARD_ROWS][BOARD_COLS], char aiPlayer, int *out_row, int *out_col);
+
+/**
+ * Compute the AI's next move within a wall-clock budget.
+ *
+ * Runs iterative deepening: depth-limited searches of 1, 2, 3, ... plies, each
+ * trying the previous iteration's best move first. When the budget expires the
+ * unfinished iteration is discarded and the best move of the last completed
+ * one is returned. Positions beyond the depth limit are scored by a static
+ * evaluation of open lines, so short budgets play reasonable rather than
+ * perfect moves.
+ *
+ * Parameters match getAiMove, plus:
+ *  - budget_ms: time budget in milliseconds; <= 0 means no limit. The first
+ *               (one-ply) iteration always completes.
+ *
+ * Stops early once the position is fully solved or a forced win is found.
+ */
+void getAiMoveTimed(char board[BOARD_ROWS][BOARD_COLS], char aiPlayer, long budget_ms, int *out_row, int *out_col);
+
+/*
+ * Scores are from the AI's point of view and depth-adjusted: a win reached d
+ * plies from the root (counting the AI's move) scores SCORE_WIN - d, a loss
+ * -SCORE_WIN + d and a draw 0. Depth-limited searches score the horizon with
+ * a static evaluation that stays within +-SCORE_EVAL_LIMIT.
+ */
+#define SCORE_WIN 100
+#define SCORE_EVAL_LIMIT 49
+
+/** One root move and its score (see SCORE_WIN). */
+typedef struct
+{
+    int row;
+    int col;
+    int score;
+} MoveScore;
+
+/**
+ * Score every move of the position for aiPlayer in one search, best first
+ * (multi-PV analysis), on the default engine.
+ *
+ * Unlike the move search, which only needs to prove that other moves are no
+ * better, every root move gets a full window, so each score is exact. Moves
+ * with equal scores keep the search order, so when the position is solved
+ * out_scores[0] is the move getAiMove plays (except on the empty board, where
+ * getAiMove plays the center without searching). With more than 16 empty
+ * cells the moves are searched 4 plies deep, as in getAiMove; the best score
+ * is then the same, but iterative deepening may break ties differently.
+ *
+ * Parameters:
+ *  - board:      Current position; not modified
+ *  - aiPlayer:   The side to move ('x' or 'o')
+ *  - out_scores: Room for BOARD_ROWS * BOARD_COLS moves
+ *  - out_count:  Number of moves written; 0 if the game is already over
+ *
+ * Returns 0 on success, -1 if the default engine could not be created.
+ */
+int analyzeMoves(char board[BOARD_ROWS][BOARD_COLS], char aiPlayer, MoveScore *out_scores, int *out_count);
+
+/**
+ * Resize the transposition table of the default engine used by getAiMove.
+ *
+ * The table holds the largest power-of-two number of entries that fits in
+ * `megabytes`; 0 disables it. Entries persist across getAiMove calls, so later
+ * searches in the same game reuse earlier work. If never called, a 16 MB table
+ * is allocated on the first search.
+ *
+ * Returns 0 on success, -1 if the allocation failed (the table is then disabled).
+ */
+int setTranspositionTableSize(size_t megabytes);
+
+/**
+ * Search root moves on `threads` threads (default 1, i.e. serial).
+ *
+ * The ordered root moves are handed out to a persistent worker pool; each
+ * worker searches on its own copy of the position and all share the
+ * transposition table and the best score found so far. The chosen move is
+ * identical to the serial search, including tie-breaking. Applies to both
+ * getAiMove and getAiMoveTimed.
+ *
+ * Returns 0 on success, -1 if the worker threads could not be started (the
+ * search then stays serial).
+ */
+int setSearchThreads(int threads);
+
+/** Discard all transposition table entries, keeping the current size. */
+void clearTranspositionTable(void);
+
+/**
+ * Enable (default) or disable sharing of table entries between positions that
+ * are rotations or reflections of each other. Clears the table.
+ */
+void setSymmetryCache(int enabled);
+
+/** Search counters, cumulative per engine or for a single search. */
+typedef struct
+{
+    unsigned long long nodes;         /* interior nodes entered by the search */
+    unsigned long long tableHits;     /* nodes answered from the transposition table */
+    unsigned long long symmetricHits; /* ...of which were stored by a rotated/reflected position */
+    unsigned long long playouts;      /* random games played to the end (MCTS backend) */
+} SearchCounters;
+
+/** Copy the default engine's counters since the last resetSearchCounters(). */
+void getSearchCounters(SearchCounters *out_counters);
+
+/*
+ * Detailed search statistics cost a few increments per node, so they are only
+ * collected when the engine is compiled with SEARCH_STATS=1 (make
+ * SEARCH_STATS=1). Otherwise the counting compiles away and every statistic
+ * but the node count reads as zero.
+ */
+#ifndef SEARCH_STATS
+#define SEARCH_STATS 0
+#endif
+
+/* Plies and move indices tracked one by one; later ones share the last entry. */
+#define SEARCH_STATS_PLIES 32
+#define SEARCH_STATS_MOVE_SLOTS 8
+
+/**
+ * Search statistics, cumulative per engine (see SEARCH_STATS).
+ *
+ * nodes / movesSearched is the effective branching factor: moves tried per
+ * interior node, which good move ordering keeps close to 1 at cut nodes.
+ * cutoffsAtMove shows how late in the ordered move list cutoffs happen.
+ */
+typedef struct
+{
+    unsigned long long nodes;                                  /* interior nodes entered, as in SearchCounters */
+    unsigned long long nodesAtPly[SEARCH_STATS_PLIES];         /* [i]: nodes i + 1 plies below the root */
+    unsigned long long movesSearched;                          /* moves tried at interior nodes */
+    unsigned long long cutoffs;                                /* beta cutoffs */
+    unsigned long long cutoffsAtMove[SEARCH_STATS_MOVE_SLOTS]; /* [i]: cutoffs by the (i + 1)-th move tried */
+    unsigned long long winShortcuts;                           /* moves scored at once as wins (didLastMoveWin) */
+    unsigned long long tieShortcuts;                           /* moves scored at once as ties (board full) */
+} SearchStats;
+
+/** Copy the default engine's statistics since the last resetSearchCounters(). */
+void getSearchStats(SearchStats *out_stats);
+
+/** Zero the default engine's counters and statistics. */
+void resetSearchCounters(void);
+
+/** Opaque search engine handle. */
+typedef struct MiniMaxEngine MiniMaxEngine;
+
+/** How a root search reaches its score (MiniMaxConfig.rootDriver). */
+typedef enum
+{
+    ROOT_DRIVER_PVS = 0,    /* one principal variation search with the full window */
+    ROOT_DRIVER_ASPIRATION, /* a narrow window around a guess, widened when the score falls outside */
+    ROOT_DRIVER_MTDF        /* null-window searches converging on the score from a guess (MTD(f)) */
+} RootDriver;
+
+/** How an engine chooses its moves (MiniMaxConfig.backend). */
+typedef enum
+{
+    SEARCH_BACKEND_MINIMAX = 0, /* alpha-beta search, exact when it reaches the end of the game */
+    SEARCH_BACKEND_MCTS         /* Monte Carlo tree search with random playouts */
+} SearchBackend;
+
+/**
+ * Engine configuration. Limits of 0 mean "none"; with no limit set the engine
+ * runs a full-depth search like getAiMove, otherwise iterative deepening like
+ * getAiMoveTimed that stops at whichever limit is reached first.
+ *
+ * Depth-limited searches score positions at the horizon with a static
+ * evaluation of open lines, kept below every real win or loss. Searches
+ * never go deeper than 50 plies.
+ *
+ * A positive candidateRadius restricts every node's moves to empty cells
+ * within that Chebyshev distance of a stone (all empty cells when none
+ * qualify). It keeps the branching factor of large k-in-a-row boards small,
+ * at the price of never considering distant moves, so scores are exact only
+ * for the restricted game. It defaults to 2 when WIN_LENGTH is shorter than a
+ * side of the board and to 0 (every cell) for classic full-line boards.
+ *
+ * keepHistory carries the history move-ordering table from one getAiMoveEx
+ * call to the next (halved each time), so later moves of a game start with
+ * the cutoffs learned earlier. It only changes the order moves are searched
+ * in; full-depth results stay the same. clearEngineCache() forgets it, e.g.
+ * between games.
+ *
+ * With a solvedCache, full-depth searches (no limit set and at most
+ * solveEmpties empty cells) first look the position up there and record
+ * what they find, so a later process can skip the search.
+ *
+ * rootDriver picks how the root is searched. The aspiration and MTD(f)
+ * drivers start from a guess: the engine's previous score, moved one or two
+ * plies closer to a forced result, so the moves of one game seed each other
+ * (clearEngineCache() forgets it); iterative deepening uses the previous
+ * iteration's score. They return the same move and score as ROOT_DRIVER_PVS,
+ * usually with fewer nodes. Parallel root searches (searchThreads > 1) always
+ * use the full window.
+ *
+ * With backend SEARCH_BACKEND_MCTS, getAiMoveEx and getAiMovesBatch run Monte
+ * Carlo tree search: UCT selection over a tree of up to treeMegabytes, one
+ * random playout per iteration (lightPlayouts takes and blocks immediate
+ * wins on the lines of the last two moves), and the most visited root move
+ * is played. searchThreads threads share one tree, steered apart by virtual
+ * loss. maxPlayouts and moveTimeMs bound each move (100000 playouts when
+ * neither is set); candidateRadius restricts the tree's moves, not the
+ * playouts. The perfect-play table, tablebase and solved cache are not
+ * consulted, and analyzeMovesEx still uses minimax. A serial search with a
+ * playout budget is reproducible.
+ */
+typedef struct
+{
+    size_t ttMegabytes;           /* transposition table size; 0 disables it */
+    int useSymmetry;              /* share table entries between symmetric positions */
+    int searchThreads;            /* threads for the root search; <= 1 is serial */
+    int maxDepth;                 /* maximum search depth in plies */
+    int solveEmpties;             /* unlimited searches with more empty cells search evalDepth plies */
+    int evalDepth;                /* depth used above solveEmpties */
+    unsigned long long maxNodes;  /* node budget per move (checked after the first iteration) */
+    long moveTimeMs;              /* wall-clock budget per move in milliseconds */
+    int candidateRadius;          /* only search cells within this many rows/columns of a stone; 0 = every empty cell */
+    int keepHistory;              /* keep move-ordering history across calls on this engine */
+    int usePerfectTable;          /* answer full-depth 3x3 queries from the built-in table */
+    const Tablebase *tablebase;   /* optional solved table (not owned); replaces the search */
+    SolvedCache *solvedCache;     /* optional persistent root results (not owned) */
+    RootDriver rootDriver;        /* root search driver */
+    SearchBackend backend;        /* minimax or Monte Carlo tree search */
+    unsigned long long maxPlayouts; /* MCTS: playout budget per move over all threads */
+    size_t treeMegabytes;         /* MCTS: memory for tree nodes; the tree stops growing when full */
+    int lightPlayouts;            /* MCTS: playouts take and block immediate wins instead of moving at random */
+} MiniMaxConfig;
+
+/**
+ * Result of one getAiMoveEx() call. With the MCTS backend, score is the
+ * move's playout result mapped onto +-SCORE_EVAL_LIMIT (all wins to all
+ * losses), depth the deepest tree ply reached, and solved is only set for a
+ * move that wins on the spot.
  */
-void getAiMove(char board[BOARD_SIZE][BOARD_SIZE], char aiPlayer, int *out_row, int *out_col);
+typedef struct
+{
+    int row;                 /* selected move, or -1 when the game is already over */
+    int col;
+    int score;               /* engine score of the move, from the AI's point of view */
+    int depth;               /* depth of the last completed search iteration */
+    int solved;              /* 1 if the score is exact (searched to the end of the game) */
+    SearchCounters counters; /* work done by this call */
+} MoveResult;
+
+/**
+ * Fill out_config with the defaults used by getAiMove (16 MB table, symmetry
+ * on, serial, no limits, minimax; a 64 MB tree and light playouts for MCTS).
+ */
+void defaultMiniMaxConfig(MiniMaxConfig *out_config);
+
+/**
+ * Create an engine. `config` may be NULL for the defaults.
+ * Returns NULL if the table or the worker threads could not be allocated.
+ */
+MiniMaxEngine *createMiniMaxEngine(const MiniMaxConfig *config);
+
+/** Stop the engine's worker threads and free it. NULL is ignored. */
+void destroyMiniMaxEngine(MiniMaxEngine *engine);
+
+/**
+ * Change the configuration of an idle engine. The table keeps its entries
+ * unless its size changes (reallocated) or symmetry sharing is toggled (cleared).
+ *
+ * Returns 0 on success, -1 if the table, the MCTS tree or threads could not
+ * be allocated (the engine then runs without a table, with minimax or
+ * serially).
+ */
+int configureMiniMaxEngine(MiniMaxEngine *engine, const MiniMaxConfig *config);
+
+/**
+ * Compute the AI's next move with the engine's configuration and limits.
+ *
+ * Full-depth 3x3 queries are answered from the built-in perfect-play table
+ * (unless config.usePerfectTable is 0, e.g. to time the search itself).
+ * With a tablebase configured, every move is scored from its successor's
+ * stored value instead of searched (limits do not apply); the choice is the
+ * same move the full search makes. Positions the table does not cover fall
+ * back to search. A configured solvedCache answers full-depth queries it has
+ * recorded before, and records the ones it had to search.
+ *
+ * Parameters:
+ *  - engine:     Engine to search with; not to be shared between concurrent calls
+ *  - board:      Current position; not modified
+ *  - aiPlayer:   The AI symbol ('x' or 'o') to maximize for
+ *  - out_result: Selected move, its score, the search depth and counters
+ *
+ * Returns 0 on success, -1 on invalid arguments.
+ */
+int getAiMoveEx(MiniMaxEngine *engine, char board[BOARD_ROWS][BOARD_COLS], char aiPlayer, MoveResult *out_result);
+
+/**
+ * Compute the AI's move for many positions in one call, e.g. for a server
+ * answering many games at once.
+ *
+ * Positions that occur more than once in the batch (same board and same
+ * player) are answered once. The distinct positions are spread over the
+ * engine's worker pool (config.searchThreads threads, counting the caller),
+ * one whole position per thread at a time, and all of them share the
+ * engine's transposition table. Each position gets the same move, score and
+ * depth getAiMoveEx returns with the engine's configuration.
+ *
+ * Parameters:
+ *  - engine:      Engine to search with; not to be shared between concurrent calls
+ *  - boards:      `count` positions; not modified
+ *  - players:     The AI symbol ('x' or 'o') of each position
+ *  - out_results: One result per position, in input order. Duplicates report
+ *                 zero counters, so the counters add up to the work done.
+ *  - count:       Number of positions; 0 does nothing
+ *
+ * With keepHistory, every position starts from the kept history; the batch
+ * leaves it unchanged.
+ *
+ * Returns 0 on success, -1 on invalid arguments or when out of memory.
+ */
+int getAiMovesBatch(MiniMaxEngine *engine, const char boards[][BOARD_ROWS][BOARD_COLS], const char *players, MoveResult *out_results, size_t count);
+
+/**
+ * analyzeMoves with the engine's table, worker threads and configuration.
+ * The root moves are scored in parallel on the engine's search threads.
+ * config.maxDepth limits the depth (otherwise solveEmpties and evalDepth
+ * apply, as for an unlimited search); node and time limits do not apply.
+ *
+ * Returns 0 on success, -1 on invalid arguments.
+ */
+int analyzeMovesEx(MiniMaxEngine *engine, char board[BOARD_ROWS][BOARD_COLS], char aiPlayer, MoveScore *out_scores, int *out_count);
+
+/**
+ * Discard all of the engine's table entries, kept history and root driver
+ * guess, keeping the current table size.
+ */
+void clearEngineCache(MiniMaxEngine *engine);
+
+/** Copy the engine's cumulative counters since the last resetEngineCounters(). */
+void getEngineCounters(const MiniMaxEngine *engine, SearchCounters *out_counters);
+
+/** Copy the engine's cumulative statistics since the last resetEngineCounters(). */
+void getEngineStats(const MiniMaxEngine *engine, SearchStats *out_stats);
+
+/** Zero the engine's cumulative counters and statistics. */
+void resetEngineCounters(MiniMaxEngine *engine);
 
 #endif
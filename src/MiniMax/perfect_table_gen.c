@@ -0,0 +1,140 @@
+/*
+ * Perfect-play table generator (3x3)
+ * ----------------------------------
+ * Build-time tool: walks every position reachable from the empty board (with
+ * either side moving first), asks the search engine for the best move of both
+ * players, and prints a C header that mini_max.c includes when built with
+ * -DHAVE_PERFECT_TABLE. getAiMove then answers 3x3 queries by lookup.
+ *
+ * Table layout: perfectTable[aiSide][code], where code is the base-3 position
+ * code (cell r*3+c contributes 3^(r*3+c) times 0 = empty, 1 = 'x', 2 = 'o').
+ * Each entry packs the move as (cell + 2) in the low byte (1 = game over,
+ * 0 = position not in the table) and the signed root score in the high byte.
+ *
+ * Usage: perfect_table_gen > perfect_table.h
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include "mini_max.h"
+
+#if BOARD_ROWS == 3 && BOARD_COLS == 3 && WIN_LENGTH == 3
+
+#define POSITION_CODES 19683 /* 3^9 */
+
+static uint16_t entries[2][POSITION_CODES];
+static unsigned char visited[POSITION_CODES];
+
+static int positionCode(char board[BOARD_ROWS][BOARD_COLS])
+{
+    int code = 0;
+    for (int cell = MAX_MOVES - 1; cell >= 0; --cell)
+    {
+        char symbol = board[cell / BOARD_COLS][cell % BOARD_COLS];
+        code = code * 3 + (symbol == 'x' ? 1 : symbol == 'o' ? 2 : 0);
+    }
+    return code;
+}
+
+/*
+ * Record the engine's answer for both players at this position, then recurse
+ * into every move of `toMove` unless the game is already over.
+ * Returns 0 on success, -1 if the engine failed.
+ */
+static int solveFrom(MiniMaxEngine *engine, char board[BOARD_ROWS][BOARD_COLS], char toMove)
+{
+    int code = positionCode(board);
+    if (visited[code] & (toMove == 'x' ? 1 : 2))
+        return 0;
+
+    if (!visited[code])
+    {
+        for (int side = 0; side < 2; ++side)
+        {
+            MoveResult result;
+            if (getAiMoveEx(engine, board, side == 0 ? 'x' : 'o', &result) != 0)
+                return -1;
+
+            int cell = result.row < 0 ? -1 : result.row * BOARD_COLS + result.col;
+            entries[side][code] = (uint16_t)(((uint8_t)(int8_t)result.score << 8) | (cell + 2));
+        }
+    }
+    visited[code] |= (toMove == 'x' ? 1 : 2);
+    if ((entries[0][code] & 0xFF) == 1) /* game over */
+        return 0;
+
+    for (int row = 0; row < BOARD_ROWS; ++row)
+    {
+        for (int col = 0; col < BOARD_COLS; ++col)
+        {
+            if (board[row][col] != ' ')
+                continue;
+
+            board[row][col] = toMove;
+            int status = solveFrom(engine, board, toMove == 'x' ? 'o' : 'x');
+            board[row][col] = ' ';
+            if (status != 0)
+                return status;
+        }
+    }
+    return 0;
+}
+
+int main(void)
+{
+    MiniMaxEngine *engine = createMiniMaxEngine(NULL);
+    if (engine == NULL)
+    {
+        fprintf(stderr, "perfect_table_gen: could not create the search engine\n");
+        return 1;
+    }
+
+    char board[BOARD_ROWS][BOARD_COLS];
+    for (int row = 0; row < BOARD_ROWS; ++row)
+    {
+        for (int col = 0; col < BOARD_COLS; ++col)
+            board[row][col] = ' ';
+    }
+
+    if (solveFrom(engine, board, 'x') != 0 || solveFrom(engine, board, 'o') != 0)
+    {
+        fprintf(stderr, "perfect_table_gen: search failed\n");
+        destroyMiniMaxEngine(engine);
+        return 1;
+    }
+    destroyMiniMaxEngine(engine);
+
+    int positions = 0;
+    for (int code = 0; code < POSITION_CODES; ++code)
+        positions += visited[code] != 0;
+
+    printf("/* Generated by perfect_table_gen (%d reachable positions); do not edit. */\n\n", positions);
+    printf("#define PERFECT_TABLE_AVAILABLE 1\n");
+    printf("#define PERFECT_TABLE_CODES %d\n\n", POSITION_CODES);
+    printf("static const uint16_t perfectTable[2][PERFECT_TABLE_CODES] = {\n");
+    for (int side = 0; side < 2; ++side)
+    {
+        printf("    {");
+        for (int code = 0; code < POSITION_CODES; ++code)
+        {
+            if (code % 12 == 0)
+                printf("\n        ");
+            printf("0x%04x,", entries[side][code]);
+        }
+        printf("\n    },\n");
+    }
+    printf("};\n");
+
+    return ferror(stdout) ? 1 : 0;
+}
+
+#else
+
+/* Only classic 3x3 has a table; other boards get an empty header and keep searching. */
+int main(void)
+{
+    printf("/* Generated by perfect_table_gen: no table for %dx%d, %d in a row. */\n", BOARD_ROWS, BOARD_COLS, WIN_LENGTH);
+    return ferror(stdout) ? 1 : 0;
+}
+
+#endif
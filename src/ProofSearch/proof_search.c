@@ -0,0 +1,456 @@
+/*
+ * Proof-number solver
+ * -------------------
+ *
+ * Responsibilities in this file:
+ *  - Depth-first proof-number search (df-pn) for "the attacker wins"
+ *  - A bounded proof table keyed by Zobrist hashes
+ *  - Win/draw/loss from two proofs, plus the proving move
+ *
+ * Numbers are kept in the phi/delta form: at every node, phi is the cost of
+ * proving that the side to move reaches its goal and delta the cost of
+ * proving that it does not. The attacker's goal is a win; the defender's is
+ * to stop that, so a draw counts for the defender. A node's phi is the
+ * smallest delta of its children and its delta the sum of their phis.
+ *
+ * mid() is Nagai's multiple iterative deepening: it keeps expanding the child
+ * with the smallest delta until the node's numbers reach the thresholds
+ * handed down by the parent. The threshold for the runner-up child is
+ * widened by a quarter (the 1 + epsilon trick), so the search does not keep
+ * switching between two similar children.
+ *
+ * Like the tablebase, the solver keeps its own line masks and move loop, so
+ * it does not depend on the search engine it is meant to check.
+ */
+
+#include "proof_search.h"
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../MiniMax/bitboard.h"
+
+/* Proof and disproof numbers saturate here; PROOF_INFINITY marks a settled node. */
+#define PROOF_INFINITY 0x7FFFFFFFu
+
+/* Entries per table bucket; a full bucket replaces its cheapest entry. */
+#define PROOF_BUCKET_SIZE 4
+
+/* Smallest proof table, whatever ttMegabytes asks for. */
+#define PROOF_MIN_MEGABYTES 1
+
+/* Each cell lies in at most WIN_LENGTH windows per direction. */
+#define MAX_CELL_LINES (4 * WIN_LENGTH)
+
+/* Stored numbers of one position; key 0 marks an empty slot. */
+typedef struct
+{
+    uint64_t key;
+    uint32_t phi;
+    uint32_t delta;
+    unsigned long long work; /* expansions spent below this position */
+} ProofEntry;
+
+/* One proof: the position being searched, the attacker and the table. */
+typedef struct
+{
+    Bitboard stones[2]; /* indexed by side: 0 'x', 1 'o' */
+    uint64_t key;
+    int empties;
+    int attacker;
+    ProofEntry *table;
+    size_t bucketMask;
+    unsigned long long nodes;
+    unsigned long long maxNodes; /* 0 = no budget */
+    int aborted;
+} ProofSearch;
+
+/* A move of the node being expanded. */
+typedef struct
+{
+    int cell;
+    uint64_t key;
+    int settled; /* the game ends with this move; phi/delta below are final */
+    uint32_t phi;
+    uint32_t delta;
+} ProofChild;
+
+/* Line masks and Zobrist keys, filled once by initTables(). */
+static Bitboard lines[4 * MAX_MOVES];
+static int lineCount;
+static Bitboard cellLines[MAX_MOVES][MAX_CELL_LINES];
+static int cellLineCount[MAX_MOVES];
+static uint64_t zobristKeys[2][MAX_MOVES];
+static uint64_t zobristSideKey; /* xored in when 'o' is to move */
+static pthread_once_t tablesOnce = PTHREAD_ONCE_INIT;
+
+/* SplitMix64, seeded differently from the engine's keys. */
+static uint64_t nextRandom(uint64_t *state)
+{
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+static void initTables(void)
+{
+    static const int directions[4][2] = {{0, 1}, {1, 0}, {1, 1}, {1, -1}};
+    for (int d = 0; d < 4; ++d)
+    {
+        int rowStep = directions[d][0];
+        int colStep = directions[d][1];
+        for (int row = 0; row < BOARD_ROWS; ++row)
+        {
+            for (int col = 0; col < BOARD_COLS; ++col)
+            {
+                int lastRow = row + rowStep * (WIN_LENGTH - 1);
+                int lastCol = col + colStep * (WIN_LENGTH - 1);
+                if (lastRow >= BOARD_ROWS || lastCol < 0 || lastCol >= BOARD_COLS)
+                    continue;
+
+                Bitboard line = bitboardEmpty();
+                for (int i = 0; i < WIN_LENGTH; ++i)
+                    bitboardToggle(&line, (row + rowStep * i) * BOARD_COLS + col + colStep * i);
+                lines[lineCount++] = line;
+                for (int i = 0; i < WIN_LENGTH; ++i)
+                {
+                    int cell = (row + rowStep * i) * BOARD_COLS + col + colStep * i;
+                    cellLines[cell][cellLineCount[cell]++] = line;
+                }
+            }
+        }
+    }
+
+    uint64_t state = 0x50F5EA4C4ULL;
+    for (int side = 0; side < 2; ++side)
+    {
+        for (int cell = 0; cell < MAX_MOVES; ++cell)
+            zobristKeys[side][cell] = nextRandom(&state);
+    }
+    zobristSideKey = nextRandom(&state);
+}
+
+/* Non-zero if the stones complete a line through cell. */
+static int winsThrough(Bitboard stones, int cell)
+{
+    for (int i = 0; i < cellLineCount[cell]; ++i)
+    {
+        if (bitboardContains(stones, cellLines[cell][i]))
+            return 1;
+    }
+    return 0;
+}
+
+/*
+ * Non-zero if the attacker can still complete a line, `side` to move: a line
+ * without a defender stone that needs no more stones than the attacker has
+ * moves left. Otherwise the game can only end in the defender's favour.
+ */
+static int attackerCanWin(const ProofSearch *search, int side)
+{
+    int attacker = search->attacker;
+    int movesLeft = side == attacker ? (search->empties + 1) / 2 : search->empties / 2;
+    for (int i = 0; i < lineCount; ++i)
+    {
+        if (!bitboardIsEmpty(bitboardAnd(lines[i], search->stones[!attacker])))
+            continue;
+        if (WIN_LENGTH - bitboardCount(bitboardAnd(lines[i], search->stones[attacker])) <= movesLeft)
+            return 1;
+    }
+    return 0;
+}
+
+/* a + b, saturating below PROOF_INFINITY unless either is infinite. */
+static uint32_t addNumbers(uint32_t a, uint32_t b)
+{
+    if (a == PROOF_INFINITY || b == PROOF_INFINITY)
+        return PROOF_INFINITY;
+    uint64_t sum = (uint64_t)a + b;
+    return sum < PROOF_INFINITY ? (uint32_t)sum : PROOF_INFINITY - 1;
+}
+
+static ProofEntry *bucketOf(const ProofSearch *search, uint64_t key)
+{
+    return search->table + (size_t)(key & search->bucketMask) * PROOF_BUCKET_SIZE;
+}
+
+/* Stored numbers of a position, or 1 and 1 for one never expanded. */
+static void lookupNumbers(const ProofSearch *search, uint64_t key, uint32_t *out_phi, uint32_t *out_delta)
+{
+    const ProofEntry *bucket = bucketOf(search, key);
+    for (int i = 0; i < PROOF_BUCKET_SIZE; ++i)
+    {
+        if (bucket[i].key == key)
+        {
+            *out_phi = bucket[i].phi;
+            *out_delta = bucket[i].delta;
+            return;
+        }
+    }
+    *out_phi = 1;
+    *out_delta = (uint32_t)search->empties;
+}
+
+/* Store a position's numbers, replacing the entry that took the least work. */
+static void storeNumbers(ProofSearch *search, uint64_t key, uint32_t phi, uint32_t delta, unsigned long long work)
+{
+    ProofEntry *bucket = bucketOf(search, key);
+    ProofEntry *slot = &bucket[0];
+    for (int i = 0; i < PROOF_BUCKET_SIZE; ++i)
+    {
+        if (bucket[i].key == key)
+        {
+            slot = &bucket[i];
+            work += slot->work;
+            break;
+        }
+        if (bucket[i].work < slot->work)
+            slot = &bucket[i];
+    }
+    *slot = (ProofEntry){.key = key, .phi = phi, .delta = delta, .work = work};
+}
+
+/* Threshold that lets the best child grow a quarter past the runner-up. */
+static uint32_t widenThreshold(uint32_t secondDelta)
+{
+    if (secondDelta >= PROOF_INFINITY - 1)
+        return secondDelta;
+    return addNumbers(secondDelta, secondDelta / 4 + 1);
+}
+
+/*
+ * Expand the current position, `side` to move, until its phi reaches thPhi
+ * or its delta reaches thDelta, and store its numbers. out_cell receives the
+ * child with the smallest delta: with phi 0 the move that reaches the goal.
+ */
+static void mid(ProofSearch *search, int side, uint32_t thPhi, uint32_t thDelta, uint32_t *out_phi, uint32_t *out_delta, int *out_cell)
+{
+    unsigned long long startNodes = search->nodes;
+    if (search->maxNodes > 0 && search->nodes >= search->maxNodes)
+    {
+        search->aborted = 1;
+        return;
+    }
+    ++search->nodes;
+
+    /*
+     * Moves that end the game are settled here. A win, or for the defender
+     * filling the board, reaches the mover's goal and settles this node too.
+     */
+    ProofChild children[MAX_MOVES];
+    int count = 0;
+    uint64_t childBase = search->key ^ zobristSideKey;
+    Bitboard empty = bitboardAndNot(bitboardFull(), bitboardOr(search->stones[0], search->stones[1]));
+    for (int cell = bitboardPopLowest(&empty); cell >= 0; cell = bitboardPopLowest(&empty))
+    {
+        ProofChild *child = &children[count++];
+        child->cell = cell;
+        child->key = childBase ^ zobristKeys[side][cell];
+        child->settled = 0;
+
+        bitboardToggle(&search->stones[side], cell);
+        int won = winsThrough(search->stones[side], cell);
+        bitboardToggle(&search->stones[side], cell);
+        if (won)
+        {
+            storeNumbers(search, search->key, 0, PROOF_INFINITY, 1);
+            *out_phi = 0;
+            *out_delta = PROOF_INFINITY;
+            *out_cell = cell;
+            return;
+        }
+        /* the attacker has failed: the board is full, or no line can still be completed */
+        bitboardToggle(&search->stones[side], cell);
+        --search->empties;
+        int open = search->empties > 0 && attackerCanWin(search, !side);
+        ++search->empties;
+        bitboardToggle(&search->stones[side], cell);
+        if (!open)
+        {
+            if (side != search->attacker)
+            {
+                storeNumbers(search, search->key, 0, PROOF_INFINITY, 1);
+                *out_phi = 0;
+                *out_delta = PROOF_INFINITY;
+                *out_cell = cell;
+                return;
+            }
+            child->settled = 1;
+            child->phi = 0;
+            child->delta = PROOF_INFINITY;
+        }
+    }
+
+    for (;;)
+    {
+        uint32_t phi = PROOF_INFINITY;
+        uint32_t delta = 0;
+        uint32_t secondDelta = PROOF_INFINITY;
+        uint32_t bestPhi = PROOF_INFINITY;
+        int best = 0;
+        for (int i = 0; i < count; ++i)
+        {
+            uint32_t childPhi = children[i].phi;
+            uint32_t childDelta = children[i].delta;
+            if (!children[i].settled)
+                lookupNumbers(search, children[i].key, &childPhi, &childDelta);
+
+            if (childDelta < phi)
+            {
+                secondDelta = phi;
+                phi = childDelta;
+                bestPhi = childPhi;
+                best = i;
+            }
+            else if (childDelta < secondDelta)
+            {
+                secondDelta = childDelta;
+            }
+            delta = addNumbers(delta, childPhi);
+        }
+
+        *out_cell = children[best].cell;
+        if (phi >= thPhi || delta >= thDelta)
+        {
+            storeNumbers(search, search->key, phi, delta, search->nodes - startNodes);
+            *out_phi = phi;
+            *out_delta = delta;
+            return;
+        }
+
+        uint32_t childThPhi = thDelta == PROOF_INFINITY ? PROOF_INFINITY : thDelta - delta + bestPhi;
+        uint32_t childThDelta = widenThreshold(secondDelta);
+        if (childThDelta > thPhi)
+            childThDelta = thPhi;
+
+        int cell = children[best].cell;
+        uint64_t key = search->key;
+        bitboardToggle(&search->stones[side], cell);
+        search->key = children[best].key;
+        --search->empties;
+
+        uint32_t childPhi;
+        uint32_t childDelta;
+        int childCell;
+        mid(search, !side, childThPhi, childThDelta, &childPhi, &childDelta, &childCell);
+
+        ++search->empties;
+        search->key = key;
+        bitboardToggle(&search->stones[side], cell);
+        if (search->aborted)
+            return;
+    }
+}
+
+/* Key of the loaded position with `side` to move. */
+static uint64_t positionKey(const ProofSearch *search, int side)
+{
+    uint64_t key = side == 1 ? zobristSideKey : 0;
+    for (int s = 0; s < 2; ++s)
+    {
+        Bitboard stones = search->stones[s];
+        for (int cell = bitboardPopLowest(&stones); cell >= 0; cell = bitboardPopLowest(&stones))
+            key ^= zobristKeys[s][cell];
+    }
+    /* keep 0 free to mark empty slots */
+    return key != 0 ? key : 1;
+}
+
+/*
+ * Run one proof from the root, `side` to move, with `attacker` trying to win.
+ * Returns 1 if proven, 0 if disproven, -1 if the budget ran out; out_cell
+ * is the root's best move.
+ */
+static int prove(ProofSearch *search, int side, int attacker, int *out_cell)
+{
+    memset(search->table, 0, (search->bucketMask + 1) * PROOF_BUCKET_SIZE * sizeof(ProofEntry));
+    search->attacker = attacker;
+    search->key = positionKey(search, side);
+
+    uint32_t phi;
+    uint32_t delta;
+    mid(search, side, PROOF_INFINITY, PROOF_INFINITY, &phi, &delta, out_cell);
+    if (search->aborted)
+        return -1;
+
+    /* phi 0: the mover reached its goal */
+    int moverWins = phi == 0;
+    return side == attacker ? moverWins : !moverWins;
+}
+
+int solvePosition(const char board[BOARD_ROWS][BOARD_COLS], char player, size_t ttMegabytes, unsigned long long maxNodes, SolveResult *out_result)
+{
+    if (board == NULL || out_result == NULL || (player != 'x' && player != 'o'))
+        return -1;
+
+    pthread_once(&tablesOnce, initTables);
+    *out_result = (SolveResult){.value = SOLVE_UNKNOWN, .row = -1, .col = -1};
+
+    ProofSearch search = {.maxNodes = maxNodes};
+    search.stones[0] = bitboardEmpty();
+    search.stones[1] = bitboardEmpty();
+    for (int cell = 0; cell < MAX_MOVES; ++cell)
+    {
+        char symbol = board[cell / BOARD_COLS][cell % BOARD_COLS];
+        if (symbol == 'x' || symbol == 'o')
+            bitboardToggle(&search.stones[symbol == 'o'], cell);
+        else
+            ++search.empties;
+    }
+
+    /* finished games need no proof */
+    int side = player == 'o';
+    for (int s = 0; s < 2; ++s)
+    {
+        Bitboard stones = search.stones[s];
+        for (int cell = bitboardPopLowest(&stones); cell >= 0; cell = bitboardPopLowest(&stones))
+        {
+            if (winsThrough(search.stones[s], cell))
+            {
+                out_result->value = s == side ? SOLVE_WIN : SOLVE_LOSS;
+                return 0;
+            }
+        }
+    }
+    if (search.empties == 0)
+    {
+        out_result->value = SOLVE_DRAW;
+        return 0;
+    }
+
+    if (ttMegabytes < PROOF_MIN_MEGABYTES)
+        ttMegabytes = PROOF_MIN_MEGABYTES;
+    if (ttMegabytes > SIZE_MAX / (2 * 1024 * 1024))
+        return -1;
+    /* round up, so at least the requested memory is used */
+    size_t buckets = 1;
+    while (buckets * PROOF_BUCKET_SIZE * sizeof(ProofEntry) < ttMegabytes * 1024 * 1024)
+        buckets *= 2;
+    search.table = malloc(buckets * PROOF_BUCKET_SIZE * sizeof(ProofEntry));
+    if (search.table == NULL)
+        return -1;
+    search.bucketMask = buckets - 1;
+
+    int cell = -1;
+    int proven = prove(&search, side, side, &cell);
+    if (proven == 1)
+    {
+        out_result->value = SOLVE_WIN;
+    }
+    else if (proven == 0)
+    {
+        /* no win: the draw holds unless the opponent can force a win */
+        proven = prove(&search, side, !side, &cell);
+        if (proven >= 0)
+            out_result->value = proven ? SOLVE_LOSS : SOLVE_DRAW;
+    }
+
+    free(search.table);
+    out_result->nodes = search.nodes;
+    if (proven < 0)
+        return 1;
+    out_result->row = cell / BOARD_COLS;
+    out_result->col = cell % BOARD_COLS;
+    return 0;
+}
@@ -0,0 +1,58 @@
+#ifndef PROOF_SEARCH_H
+#define PROOF_SEARCH_H
+
+/*
+ * Proof-number solver
+ * -------------------
+ * Decides whether a position is a win, draw or loss for the side to move
+ * with depth-first proof-number search (df-pn), without the depth-adjusted
+ * scores of the minimax engine.
+ *
+ * Proof-number search expands the position whose proof or disproof looks
+ * cheapest (fewest open leaves to settle), so it goes straight for forcing
+ * lines and settles a draw or loss as soon as one refutation is found. Its
+ * memory is one fixed-size table: when the table is full, entries that
+ * took the least work are replaced, at the price of redoing that work.
+ */
+
+#include <stddef.h>
+#include "../TicTacToe/tic_tac_toe.h"
+
+/** Game-theoretic value for the side to move. */
+typedef enum
+{
+    SOLVE_UNKNOWN = 0, /* the node budget ran out first */
+    SOLVE_WIN,
+    SOLVE_DRAW,
+    SOLVE_LOSS
+} SolveValue;
+
+/** Result of one solvePosition() call. */
+typedef struct
+{
+    SolveValue value;
+    int row; /* proving move: a win, or a move that holds the draw; in a loss any move. */
+    int col; /* -1 when the game is already over or the value is unknown */
+    unsigned long long nodes; /* positions expanded */
+} SolveResult;
+
+/**
+ * Solve the position with `player` ('x' or 'o') to move.
+ *
+ * The first proof asks whether `player` can force a win. If that fails, a
+ * second one asks whether the opponent can; if not, the position is a draw.
+ *
+ * Parameters:
+ *  - board:       Current position; not modified
+ *  - player:      Side to move
+ *  - ttMegabytes: Size of the proof table, rounded up to a power of two
+ *                 (at least 1 MB is used)
+ *  - maxNodes:    Expansion budget over both proofs; 0 means none
+ *  - out_result:  Value, proving move and node count
+ *
+ * Returns 0 when solved (including finished games), 1 if the budget ran out
+ * (value SOLVE_UNKNOWN), -1 on invalid arguments or when out of memory.
+ */
+int solvePosition(const char board[BOARD_ROWS][BOARD_COLS], char player, size_t ttMegabytes, unsigned long long maxNodes, SolveResult *out_result);
+
+#endif
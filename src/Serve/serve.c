@@ -0,0 +1,574 @@
+/*
+ * Engine server
+ * -------------
+ * Each connection (stdin/stdout, or one accepted socket) has an input buffer.
+ * Whatever one read() returns is split into complete lines, and every line in
+ * it is parsed before any is answered. Runs of consecutive requests on the
+ * same board size then go to the size's engine as one batch, and all
+ * responses are appended to the connection's output buffer and flushed
+ * together. A client that pipelines its requests therefore gets them searched
+ * together, deduplicated and spread over the engine's worker pool, and pays
+ * one system call per chunk rather than per request.
+ *
+ * The server is single-threaded apart from the engines' own pools; socket
+ * clients are polled and served one chunk at a time, so engines are never
+ * used concurrently. Client sockets are non-blocking: output a peer does not
+ * take yet stays in its buffer and is flushed when the socket is writable,
+ * and a peer with more than SERVE_OUTPUT_LIMIT bytes unsent is not read from
+ * until it catches up. No client can stall the others.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include "serve.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include "../Kernels/board_kernel.h"
+
+/* Input buffer of one connection, which is also the longest accepted line. */
+#define SERVE_BUFFER_SIZE 65536
+
+/* Requests answered per round; a longer chunk takes several rounds. */
+#define SERVE_MAX_REQUESTS 1024
+
+/* Longest response line, including the newline. */
+#define SERVE_MAX_RESPONSE 128
+
+/* Socket clients served at the same time; later ones wait to be accepted. */
+#define SERVE_MAX_CLIENTS 64
+
+/* Unsent output above which a socket client's requests are not read. */
+#define SERVE_OUTPUT_LIMIT (SERVE_MAX_REQUESTS * SERVE_MAX_RESPONSE)
+
+typedef enum
+{
+    REQUEST_MOVE,
+    REQUEST_ANALYZE,
+    REQUEST_ERROR
+} RequestKind;
+
+/* One parsed request line. */
+typedef struct
+{
+    RequestKind kind;
+    int kernelIndex;   /* index into boardKernels */
+    const char *cells; /* size * size flat cells ('x', 'o', ' '), rewritten in place in the input */
+    const char *error; /* message of a REQUEST_ERROR */
+} Request;
+
+/* One client: where requests come from and responses go. */
+typedef struct
+{
+    int inFd;
+    int outFd;
+    size_t length;  /* bytes in input */
+    int discarding; /* dropping the rest of an over-long line */
+    int ended;      /* input is over; the connection closes once its output is sent */
+    char *output;   /* responses not written yet */
+    size_t outputLength;
+    size_t outputCapacity;
+    char input[SERVE_BUFFER_SIZE + 1]; /* room to terminate a last line without a newline */
+} Connection;
+
+/* Engines and per-round scratch shared by every connection. */
+typedef struct
+{
+    MiniMaxConfig config;
+    const Tablebase *tablebase;
+    SolvedCache *solvedCache;
+    int tablebaseSize; /* size of the tablebase and the cache */
+    MiniMaxEngine **engines; /* per boardKernels entry, created on first use */
+    int kernelCount;
+    Request requests[SERVE_MAX_REQUESTS];
+    char players[SERVE_MAX_REQUESTS];
+    MoveResult results[SERVE_MAX_REQUESTS];
+    char *batchCells; /* SERVE_MAX_REQUESTS boards of the largest size */
+} Server;
+
+static volatile sig_atomic_t stopRequested = 0;
+
+static void requestStop(int signal)
+{
+    (void)signal;
+    stopRequested = 1;
+}
+
+/*
+ * Room for `length` more bytes at the end of the connection's output.
+ * Returns where they go, or NULL if the buffer could not grow.
+ */
+static char *reserveOutput(Connection *connection, size_t length)
+{
+    size_t needed = connection->outputLength + length;
+    if (needed > connection->outputCapacity)
+    {
+        size_t capacity = connection->outputCapacity != 0 ? connection->outputCapacity : SERVE_OUTPUT_LIMIT;
+        while (capacity < needed)
+            capacity *= 2;
+        char *output = realloc(connection->output, capacity);
+        if (output == NULL)
+            return NULL;
+        connection->output = output;
+        connection->outputCapacity = capacity;
+    }
+    return connection->output + connection->outputLength;
+}
+
+/*
+ * Write as much pending output as the peer takes without blocking (all of it
+ * on a blocking descriptor) and keep the rest. Returns 0, or -1 if the peer
+ * is gone.
+ */
+static int flushOutput(Connection *connection)
+{
+    size_t sent = 0;
+    while (sent < connection->outputLength)
+    {
+        ssize_t written = write(connection->outFd, connection->output + sent, connection->outputLength - sent);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+                break;
+            return -1;
+        }
+        sent += (size_t)written;
+    }
+
+    connection->outputLength -= sent;
+    memmove(connection->output, connection->output + sent, connection->outputLength);
+    return 0;
+}
+
+/* Index of the kernel for size in boardKernels, or -1 if it was not built. */
+static int findKernelIndex(int size)
+{
+    for (int i = 0; boardKernels[i] != NULL; ++i)
+    {
+        if (boardKernels[i]->size == size)
+            return i;
+    }
+    return -1;
+}
+
+/* The server's engine for a kernel, created on first use; NULL if that failed. */
+static MiniMaxEngine *serverEngine(Server *server, int kernelIndex)
+{
+    if (server->engines[kernelIndex] == NULL)
+    {
+        const BoardKernel *kernel = boardKernels[kernelIndex];
+        MiniMaxConfig config = server->config;
+        config.tablebase = kernel->size == server->tablebaseSize ? server->tablebase : NULL;
+        config.solvedCache = kernel->size == server->tablebaseSize ? server->solvedCache : NULL;
+        server->engines[kernelIndex] = kernel->createEngine(&config);
+    }
+    return server->engines[kernelIndex];
+}
+
+/* Parse one line (terminated in place) into request and *out_player. */
+static void parseRequest(char *line, Request *request, char *out_player)
+{
+    char *fields[5];
+    int fieldCount = 0;
+    char *save = NULL;
+    for (char *field = strtok_r(line, " \t\r", &save); field != NULL; field = strtok_r(NULL, " \t\r", &save))
+    {
+        if (fieldCount == 5)
+            break;
+        fields[fieldCount++] = field;
+    }
+
+    request->kind = REQUEST_ERROR;
+    *out_player = 'x';
+    if (strcmp(fields[0], "move") != 0 && strcmp(fields[0], "analyze") != 0)
+    {
+        request->error = "unknown request (expected move or analyze)";
+        return;
+    }
+    if (fieldCount != 4)
+    {
+        request->error = "expected <size> <cells> <player>";
+        return;
+    }
+
+    int size = atoi(fields[1]);
+    request->kernelIndex = findKernelIndex(size);
+    if (request->kernelIndex < 0)
+    {
+        request->error = "board size not built";
+        return;
+    }
+    if (parseBoardText(fields[2], size, fields[2], NULL) != 0)
+    {
+        request->error = "cells must be size * size of x, o or .";
+        return;
+    }
+    if ((fields[3][0] != 'x' && fields[3][0] != 'o') || fields[3][1] != '\0')
+    {
+        request->error = "player must be x or o";
+        return;
+    }
+
+    request->kind = fields[0][0] == 'm' ? REQUEST_MOVE : REQUEST_ANALYZE;
+    request->cells = fields[2];
+    *out_player = fields[3][0];
+}
+
+/*
+ * Answer requests[0..count): runs of consecutive valid requests on one board
+ * size become one batch call, then every response is queued in order.
+ * Returns 0, or -1 if the output buffer could not grow.
+ */
+static int answerRequests(Server *server, Connection *connection, int count)
+{
+    int start = 0;
+    while (start < count)
+    {
+        Request *first = &server->requests[start];
+        if (first->kind == REQUEST_ERROR)
+        {
+            ++start;
+            continue;
+        }
+
+        int end = start + 1;
+        while (end < count && server->requests[end].kind != REQUEST_ERROR &&
+               server->requests[end].kernelIndex == first->kernelIndex)
+            ++end;
+
+        const BoardKernel *kernel = boardKernels[first->kernelIndex];
+        size_t cellCount = (size_t)kernel->size * (size_t)kernel->size;
+        for (int i = start; i < end; ++i)
+            memcpy(server->batchCells + (size_t)(i - start) * cellCount, server->requests[i].cells, cellCount);
+
+        MiniMaxEngine *engine = serverEngine(server, first->kernelIndex);
+        if (engine == NULL ||
+            kernel->getAiMovesBatch(engine, server->batchCells, &server->players[start], &server->results[start],
+                                    (size_t)(end - start)) != 0)
+        {
+            for (int i = start; i < end; ++i)
+            {
+                server->requests[i].kind = REQUEST_ERROR;
+                server->requests[i].error = "engine unavailable";
+            }
+        }
+        start = end;
+    }
+
+    char *output = reserveOutput(connection, (size_t)count * SERVE_MAX_RESPONSE);
+    if (output == NULL)
+        return -1;
+
+    size_t length = 0;
+    for (int i = 0; i < count; ++i)
+    {
+        const Request *request = &server->requests[i];
+        const MoveResult *result = &server->results[i];
+        char *out = output + length;
+        int written;
+        if (request->kind == REQUEST_ERROR)
+            written = snprintf(out, SERVE_MAX_RESPONSE, "error %s\n", request->error);
+        else if (request->kind == REQUEST_MOVE)
+            written = snprintf(out, SERVE_MAX_RESPONSE, "ok %d %d\n", result->row, result->col);
+        else
+            written = snprintf(out, SERVE_MAX_RESPONSE, "ok %d %d %d %d %d %llu\n", result->row, result->col,
+                               result->score, result->depth, result->solved, result->counters.nodes);
+        length += (size_t)written;
+    }
+
+    connection->outputLength += length;
+    return 0;
+}
+
+/*
+ * Answer every complete line in the connection's input and keep the partial
+ * last line, if any. At end of input the partial line is answered too.
+ * Returns 0, or -1 if the output buffer could not grow.
+ */
+static int serveInput(Server *server, Connection *connection, int endOfInput)
+{
+    size_t offset = 0;
+    for (;;)
+    {
+        int count = 0;
+        while (count < SERVE_MAX_REQUESTS && offset < connection->length)
+        {
+            char *line = connection->input + offset;
+            char *newline = memchr(line, '\n', connection->length - offset);
+            if (newline == NULL && !endOfInput)
+                break;
+
+            size_t lineLength = newline != NULL ? (size_t)(newline - line) : connection->length - offset;
+            line[lineLength] = '\0';
+            offset += lineLength + 1;
+
+            if (connection->discarding)
+            {
+                connection->discarding = 0;
+                continue;
+            }
+            if (strspn(line, " \t\r") == lineLength)
+                continue;
+
+            parseRequest(line, &server->requests[count], &server->players[count]);
+            ++count;
+        }
+
+        if (count == 0)
+            break;
+        if (answerRequests(server, connection, count) != 0)
+            return -1;
+    }
+
+    if (offset >= connection->length)
+    {
+        connection->length = 0;
+        return 0;
+    }
+
+    connection->length -= offset;
+    memmove(connection->input, connection->input + offset, connection->length);
+    if (connection->length == SERVE_BUFFER_SIZE)
+    {
+        /* no newline in a full buffer: refuse the line once and skip to its end */
+        static const char tooLong[] = "error line too long\n";
+        int alreadyRefused = connection->discarding;
+        connection->length = 0;
+        connection->discarding = 1;
+        if (alreadyRefused)
+            return 0;
+        char *output = reserveOutput(connection, sizeof(tooLong) - 1);
+        if (output == NULL)
+            return -1;
+        memcpy(output, tooLong, sizeof(tooLong) - 1);
+        connection->outputLength += sizeof(tooLong) - 1;
+    }
+    return 0;
+}
+
+/*
+ * Read what the client sent, answer it and flush what the peer takes. At end
+ * of input the connection is marked ended. Returns 0, or -1 if the client is
+ * gone or its output could not be buffered.
+ */
+static int serveConnection(Server *server, Connection *connection)
+{
+    ssize_t received = read(connection->inFd, connection->input + connection->length,
+                            SERVE_BUFFER_SIZE - connection->length);
+    if (received < 0 && (errno == EINTR || errno == EAGAIN || errno == EWOULDBLOCK))
+        return 0;
+
+    int status;
+    if (received <= 0)
+    {
+        connection->ended = 1;
+        status = serveInput(server, connection, 1);
+    }
+    else
+    {
+        connection->length += (size_t)received;
+        status = serveInput(server, connection, 0);
+    }
+    return status == 0 ? flushOutput(connection) : -1;
+}
+
+/* Close a socket client and free it. */
+static void closeConnection(Connection *connection)
+{
+    close(connection->inFd);
+    free(connection->output);
+    free(connection);
+}
+
+/* Open a listening UNIX socket at path, replacing a stale socket there. Returns the fd or -1. */
+static int listenOnSocket(const char *path)
+{
+    struct sockaddr_un address = {.sun_family = AF_UNIX};
+    if (strlen(path) >= sizeof(address.sun_path))
+    {
+        fprintf(stderr, "Socket path too long: %s\n", path);
+        return -1;
+    }
+    strcpy(address.sun_path, path);
+
+    struct stat status;
+    if (stat(path, &status) == 0 && S_ISSOCK(status.st_mode))
+        unlink(path);
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || bind(fd, (struct sockaddr *)&address, sizeof(address)) != 0 || listen(fd, SERVE_MAX_CLIENTS) != 0)
+    {
+        perror(path);
+        if (fd >= 0)
+            close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+/* Accept and serve socket clients until SIGINT or SIGTERM. */
+static int serveSocket(Server *server, const char *path)
+{
+    int listenFd = listenOnSocket(path);
+    if (listenFd < 0)
+        return 1;
+
+    struct sigaction action = {.sa_handler = requestStop};
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGINT, &action, NULL);
+    sigaction(SIGTERM, &action, NULL);
+
+    struct pollfd polls[SERVE_MAX_CLIENTS + 1];
+    Connection *clients[SERVE_MAX_CLIENTS];
+    int clientCount = 0;
+    fprintf(stderr, "Listening on %s\n", path);
+
+    while (!stopRequested)
+    {
+        polls[0] = (struct pollfd){.fd = listenFd, .events = clientCount < SERVE_MAX_CLIENTS ? POLLIN : 0};
+        for (int i = 0; i < clientCount; ++i)
+        {
+            const Connection *client = clients[i];
+            short events = 0;
+            if (!client->ended && client->outputLength < SERVE_OUTPUT_LIMIT)
+                events |= POLLIN;
+            if (client->outputLength > 0)
+                events |= POLLOUT;
+            polls[i + 1] = (struct pollfd){.fd = client->inFd, .events = events};
+        }
+
+        if (poll(polls, (nfds_t)clientCount + 1, -1) < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            perror("poll");
+            break;
+        }
+
+        for (int i = clientCount - 1; i >= 0; --i)
+        {
+            Connection *client = clients[i];
+            short revents = polls[i + 1].revents;
+            if (revents == 0)
+                continue;
+
+            /* an error or hang-up shows up as a failed write or the end of input */
+            int status = 0;
+            if (client->outputLength > 0)
+                status = flushOutput(client);
+            if (status == 0 && (polls[i + 1].events & POLLIN) && (revents & (POLLIN | POLLHUP | POLLERR)))
+                status = serveConnection(server, client);
+            if (status == 0 && !(client->ended && client->outputLength == 0))
+                continue;
+
+            closeConnection(client);
+            clients[i] = clients[--clientCount];
+        }
+
+        if (polls[0].revents & POLLIN)
+        {
+            int fd = accept(listenFd, NULL, NULL);
+            if (fd >= 0 && fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK) != 0)
+            {
+                close(fd);
+                fd = -1;
+            }
+            Connection *connection = fd >= 0 ? calloc(1, sizeof(Connection)) : NULL;
+            if (connection != NULL)
+            {
+                connection->inFd = fd;
+                connection->outFd = fd;
+                clients[clientCount++] = connection;
+            }
+            else if (fd >= 0)
+            {
+                close(fd);
+            }
+        }
+    }
+
+    for (int i = 0; i < clientCount; ++i)
+        closeConnection(clients[i]);
+    close(listenFd);
+    unlink(path);
+    return 0;
+}
+
+int runServer(const MiniMaxConfig *config, int size, const char *socketPath)
+{
+    Server *server = calloc(1, sizeof(Server));
+    if (server == NULL)
+    {
+        fprintf(stderr, "Out of memory.\n");
+        return 1;
+    }
+
+    server->config = *config;
+    server->tablebase = config->tablebase;
+    server->solvedCache = config->solvedCache;
+    server->tablebaseSize = size;
+    int largest = 0;
+    while (boardKernels[server->kernelCount] != NULL)
+    {
+        if (boardKernels[server->kernelCount]->size > largest)
+            largest = boardKernels[server->kernelCount]->size;
+        ++server->kernelCount;
+    }
+    server->engines = calloc((size_t)server->kernelCount, sizeof(MiniMaxEngine *));
+    server->batchCells = malloc((size_t)SERVE_MAX_REQUESTS * (size_t)largest * (size_t)largest);
+    if (server->engines == NULL || server->batchCells == NULL)
+    {
+        fprintf(stderr, "Out of memory.\n");
+        free(server->engines);
+        free(server->batchCells);
+        free(server);
+        return 1;
+    }
+
+    /* a client that hangs up shows up as a failed write, not a signal */
+    signal(SIGPIPE, SIG_IGN);
+
+    int status = 0;
+    if (socketPath != NULL)
+    {
+        status = serveSocket(server, socketPath);
+    }
+    else
+    {
+        Connection *connection = calloc(1, sizeof(Connection));
+        if (connection == NULL)
+        {
+            fprintf(stderr, "Out of memory.\n");
+            status = 1;
+        }
+        else
+        {
+            connection->inFd = STDIN_FILENO;
+            connection->outFd = STDOUT_FILENO;
+            while (!connection->ended && serveConnection(server, connection) == 0)
+            {
+            }
+            free(connection->output);
+            free(connection);
+        }
+    }
+
+    for (int i = 0; i < server->kernelCount; ++i)
+    {
+        if (server->engines[i] != NULL)
+            boardKernels[i]->destroyEngine(server->engines[i]);
+    }
+    free(server->engines);
+    free(server->batchCells);
+    free(server);
+    return status;
+}
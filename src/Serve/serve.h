@@ -0,0 +1,48 @@
+#ifndef SERVE_H
+#define SERVE_H
+
+/*
+ * Engine server
+ * -------------
+ * A long-running process that answers move requests over a line protocol,
+ * on stdin/stdout or on a UNIX domain socket. One engine per board size is
+ * created on first use and kept for the life of the server, so its
+ * transposition table, worker threads and scratch memory stay warm from one
+ * request to the next.
+ *
+ * Requests, one per line (fields separated by spaces):
+ *  - move <size> <cells> <player>     -> ok <row> <col>
+ *  - analyze <size> <cells> <player>  -> ok <row> <col> <score> <depth> <solved> <nodes>
+ *
+ * <cells> lists the size * size cells row by row as 'x', 'o' or '.' (empty);
+ * rows may be separated by '/'. <player> is the side to move, 'x' or 'o'.
+ * Rows and columns are 0-based; a finished game answers -1 -1. The score is
+ * the engine's, from <player>'s point of view, and <solved> is 1 when it is
+ * exact. A bad request answers "error <message>" and the server carries on.
+ *
+ * Requests may be pipelined: every response is written in request order, and
+ * the requests that arrived together are answered together, consecutive ones
+ * on the same board size as one getAiMovesBatch call.
+ */
+
+#include "../MiniMax/mini_max.h"
+
+/**
+ * Serve requests until the input ends (stdio) or SIGINT/SIGTERM (socket).
+ *
+ * Parameters:
+ *  - config:     engine configuration for every size; its tablebase and
+ *                solved-position cache, if any, are only given to the engine
+ *                of `size`
+ *  - size:       board size the tablebase and cache belong to
+ *  - socketPath: UNIX socket to listen on, or NULL for stdin/stdout. A stale
+ *                socket at the path is replaced and removed again on exit.
+ *                Clients are served one request chunk at a time, in turn,
+ *                and never block the server: a client that does not read
+ *                its responses stops being read until it does.
+ *
+ * Returns 0 on a clean shutdown, 1 if the socket could not be set up.
+ */
+int runServer(const MiniMaxConfig *config, int size, const char *socketPath);
+
+#endif
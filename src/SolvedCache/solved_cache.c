@@ -0,0 +1,344 @@
+/*
+ * Solved-position cache
+ * ---------------------
+ *
+ * Responsibilities in this file:
+ *  - Create the versioned cache file and check it against this build
+ *  - Map its records read-only and index them in an open-addressing table
+ *  - Collect new records in memory and append them on close
+ *
+ * The index covers the mapped records and the new ones alike: record numbers
+ * below mappedCount point into the mapping, the rest into `added`. Probes and
+ * records are rare (one per root search), so one mutex guards both.
+ *
+ * Appending locks the file, re-reads its record count (another process may
+ * have appended meanwhile), writes the new records after the last complete
+ * one and only then raises the count in the header. A process that dies in
+ * between leaves bytes past the count, which readers ignore and the next
+ * append overwrites.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include "solved_cache.h"
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define SOLVED_CACHE_MAGIC "TTTSOLV"
+#define SOLVED_CACHE_VERSION 1
+
+/* Record: packed cells, player, then the cell and score as little-endian int16. */
+#define KEY_SIZE ((2 * MAX_MOVES + 7) / 8 + 1)
+#define RECORD_SIZE (KEY_SIZE + 4)
+
+/* File header; the records follow immediately. */
+typedef struct
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t rows;
+    uint32_t cols;
+    uint32_t winLength;
+    int32_t candidateRadius;
+    uint32_t recordSize;
+    uint64_t recordCount; /* complete records after the header */
+} SolvedCacheHeader;
+
+struct SolvedCache
+{
+    int fd; /* open for appending, or -1 when read-only */
+    void *mapping;
+    size_t mappingSize;
+    const uint8_t *mapped; /* records in the file when it was opened */
+    size_t mappedCount;
+    uint8_t *added; /* records found since */
+    size_t addedCount;
+    size_t addedCapacity;
+    uint32_t *index; /* record number + 1 per slot; 0 is empty */
+    size_t indexMask;
+    pthread_mutex_t mutex;
+};
+
+/* Key of a position: 2 bits per cell (0 empty, 1 'x', 2 'o'), then the player. */
+static void packKey(const char board[BOARD_ROWS][BOARD_COLS], char player, uint8_t out_key[KEY_SIZE])
+{
+    memset(out_key, 0, KEY_SIZE);
+    for (int cell = 0; cell < MAX_MOVES; ++cell)
+    {
+        char symbol = board[cell / BOARD_COLS][cell % BOARD_COLS];
+        int value = symbol == 'x' ? 1 : symbol == 'o' ? 2 : 0;
+        out_key[cell / 4] |= (uint8_t)(value << (2 * (cell % 4)));
+    }
+    out_key[KEY_SIZE - 1] = (uint8_t)player;
+}
+
+/* FNV-1a hash of a key. */
+static size_t hashKey(const uint8_t *key)
+{
+    uint64_t hash = 0xCBF29CE484222325ULL;
+    for (int i = 0; i < KEY_SIZE; ++i)
+    {
+        hash ^= key[i];
+        hash *= 0x100000001B3ULL;
+    }
+    return (size_t)hash;
+}
+
+static const uint8_t *recordAt(const SolvedCache *cache, size_t number)
+{
+    if (number < cache->mappedCount)
+        return cache->mapped + number * RECORD_SIZE;
+    return cache->added + (number - cache->mappedCount) * RECORD_SIZE;
+}
+
+/* Index slot holding key, or the empty slot where it belongs. */
+static size_t findSlot(const SolvedCache *cache, const uint8_t *key)
+{
+    size_t slot = hashKey(key) & cache->indexMask;
+    while (cache->index[slot] != 0 && memcmp(recordAt(cache, cache->index[slot] - 1), key, KEY_SIZE) != 0)
+        slot = (slot + 1) & cache->indexMask;
+    return slot;
+}
+
+/*
+ * Make room for one more record in the index (kept at most half full).
+ * Returns 0 on success, -1 when out of memory.
+ */
+static int growIndex(SolvedCache *cache)
+{
+    size_t count = cache->mappedCount + cache->addedCount;
+    if (cache->index != NULL && 2 * (count + 1) <= cache->indexMask + 1)
+        return 0;
+    if (count + 1 >= UINT32_MAX)
+        return -1;
+
+    size_t capacity = 64;
+    while (capacity < 4 * (count + 1))
+        capacity *= 2;
+    uint32_t *index = calloc(capacity, sizeof(uint32_t));
+    if (index == NULL)
+        return -1;
+
+    free(cache->index);
+    cache->index = index;
+    cache->indexMask = capacity - 1;
+    for (size_t number = 0; number < count; ++number)
+    {
+        size_t slot = findSlot(cache, recordAt(cache, number));
+        if (cache->index[slot] == 0)
+            cache->index[slot] = (uint32_t)number + 1;
+    }
+    return 0;
+}
+
+/* Header this build writes and accepts. */
+static void expectedHeader(int candidateRadius, SolvedCacheHeader *out_header)
+{
+    memset(out_header, 0, sizeof(*out_header));
+    memcpy(out_header->magic, SOLVED_CACHE_MAGIC, sizeof(SOLVED_CACHE_MAGIC));
+    out_header->version = SOLVED_CACHE_VERSION;
+    out_header->rows = BOARD_ROWS;
+    out_header->cols = BOARD_COLS;
+    out_header->winLength = WIN_LENGTH;
+    out_header->candidateRadius = candidateRadius;
+    out_header->recordSize = RECORD_SIZE;
+}
+
+/* Take (F_WRLCK) or release (F_UNLCK) the advisory lock on the whole file. */
+static int lockFile(int fd, short type)
+{
+    struct flock lock = {.l_type = type, .l_whence = SEEK_SET};
+    return fcntl(fd, F_SETLKW, &lock);
+}
+
+/*
+ * Read the header into out_header, first writing a fresh one if the file is
+ * empty (just created). Returns 0 if it matches this build, -1 otherwise.
+ */
+static int readHeader(int fd, int readOnly, const SolvedCacheHeader *expected, SolvedCacheHeader *out_header)
+{
+    struct stat status;
+    if (fstat(fd, &status) != 0)
+        return -1;
+    if (status.st_size == 0 && !readOnly &&
+        pwrite(fd, expected, sizeof(*expected), 0) != (ssize_t)sizeof(*expected))
+        return -1;
+
+    if (pread(fd, out_header, sizeof(*out_header), 0) != (ssize_t)sizeof(*out_header))
+        return -1;
+
+    SolvedCacheHeader fields = *out_header;
+    fields.recordCount = 0;
+    if (memcmp(&fields, expected, sizeof(fields)) != 0)
+        return -1;
+    if (fstat(fd, &status) != 0 ||
+        (uint64_t)status.st_size < sizeof(*out_header) + out_header->recordCount * RECORD_SIZE)
+        return -1;
+    return 0;
+}
+
+SolvedCache *openSolvedCache(const char *path, int candidateRadius, int readOnly)
+{
+    int fd = readOnly ? open(path, O_RDONLY) : open(path, O_RDWR | O_CREAT, 0644);
+    if (fd < 0)
+        return NULL;
+
+    SolvedCacheHeader expected;
+    SolvedCacheHeader header;
+    expectedHeader(candidateRadius, &expected);
+    int locked = !readOnly && lockFile(fd, F_WRLCK) == 0;
+    int valid = (readOnly || locked) && readHeader(fd, readOnly, &expected, &header) == 0;
+    if (locked)
+        lockFile(fd, F_UNLCK);
+
+    SolvedCache *cache = valid ? calloc(1, sizeof(SolvedCache)) : NULL;
+    if (cache == NULL)
+    {
+        close(fd);
+        return NULL;
+    }
+
+    cache->mappingSize = sizeof(header) + (size_t)header.recordCount * RECORD_SIZE;
+    cache->mapping = mmap(NULL, cache->mappingSize, PROT_READ, MAP_SHARED, fd, 0);
+    if (cache->mapping == MAP_FAILED)
+    {
+        close(fd);
+        free(cache);
+        return NULL;
+    }
+
+    cache->fd = readOnly ? -1 : fd;
+    if (readOnly)
+        close(fd);
+    cache->mapped = (const uint8_t *)cache->mapping + sizeof(header);
+    pthread_mutex_init(&cache->mutex, NULL);
+
+    /* index the mapped records; with duplicates the first one wins */
+    cache->mappedCount = (size_t)header.recordCount;
+    if (growIndex(cache) != 0)
+    {
+        closeSolvedCache(cache);
+        return NULL;
+    }
+    return cache;
+}
+
+int probeSolvedCache(SolvedCache *cache, const char board[BOARD_ROWS][BOARD_COLS], char player, int *out_cell, int *out_score)
+{
+    uint8_t key[KEY_SIZE];
+    packKey(board, player, key);
+
+    pthread_mutex_lock(&cache->mutex);
+    uint32_t number = cache->index[findSlot(cache, key)];
+    const uint8_t *record = number != 0 ? recordAt(cache, number - 1) : NULL;
+    int cell = 0;
+    int score = 0;
+    if (record != NULL)
+    {
+        cell = (int16_t)(record[KEY_SIZE] | record[KEY_SIZE + 1] << 8);
+        score = (int16_t)(record[KEY_SIZE + 2] | record[KEY_SIZE + 3] << 8);
+    }
+    pthread_mutex_unlock(&cache->mutex);
+
+    /* the file is shared and may be damaged: a move that cannot be played is a miss */
+    if (record == NULL || cell < 0 || cell >= MAX_MOVES)
+        return 0;
+    char symbol = board[cell / BOARD_COLS][cell % BOARD_COLS];
+    if (symbol == 'x' || symbol == 'o')
+        return 0;
+
+    *out_cell = cell;
+    *out_score = score;
+    return 1;
+}
+
+void recordSolvedCache(SolvedCache *cache, const char board[BOARD_ROWS][BOARD_COLS], char player, int cell, int score)
+{
+    if (cache->fd < 0)
+        return;
+
+    uint8_t key[KEY_SIZE];
+    packKey(board, player, key);
+
+    pthread_mutex_lock(&cache->mutex);
+    if (cache->index[findSlot(cache, key)] == 0 && growIndex(cache) == 0)
+    {
+        if (cache->addedCount == cache->addedCapacity)
+        {
+            size_t capacity = cache->addedCapacity > 0 ? 2 * cache->addedCapacity : 256;
+            uint8_t *added = realloc(cache->added, capacity * RECORD_SIZE);
+            if (added == NULL)
+            {
+                pthread_mutex_unlock(&cache->mutex);
+                return;
+            }
+            cache->added = added;
+            cache->addedCapacity = capacity;
+        }
+
+        uint8_t *record = cache->added + cache->addedCount * RECORD_SIZE;
+        memcpy(record, key, KEY_SIZE);
+        record[KEY_SIZE] = (uint8_t)(cell & 0xFF);
+        record[KEY_SIZE + 1] = (uint8_t)((cell >> 8) & 0xFF);
+        record[KEY_SIZE + 2] = (uint8_t)(score & 0xFF);
+        record[KEY_SIZE + 3] = (uint8_t)((score >> 8) & 0xFF);
+        /* growIndex may have moved the slot */
+        cache->index[findSlot(cache, key)] = (uint32_t)(cache->mappedCount + cache->addedCount) + 1;
+        ++cache->addedCount;
+    }
+    pthread_mutex_unlock(&cache->mutex);
+}
+
+/* Append the added records after the file's last complete record. */
+static int appendRecords(SolvedCache *cache)
+{
+    const SolvedCacheHeader *mappedHeader = cache->mapping;
+    SolvedCacheHeader header;
+    if (lockFile(cache->fd, F_WRLCK) != 0)
+        return -1;
+
+    int result = -1;
+    if (pread(cache->fd, &header, sizeof(header), 0) == (ssize_t)sizeof(header))
+    {
+        SolvedCacheHeader fields = header;
+        fields.recordCount = mappedHeader->recordCount;
+        size_t bytes = cache->addedCount * RECORD_SIZE;
+        off_t offset = (off_t)(sizeof(header) + header.recordCount * RECORD_SIZE);
+        if (memcmp(&fields, mappedHeader, sizeof(fields)) == 0 &&
+            pwrite(cache->fd, cache->added, bytes, offset) == (ssize_t)bytes)
+        {
+            header.recordCount += cache->addedCount;
+            if (pwrite(cache->fd, &header, sizeof(header), 0) == (ssize_t)sizeof(header))
+                result = 0;
+        }
+    }
+
+    lockFile(cache->fd, F_UNLCK);
+    return result;
+}
+
+int closeSolvedCache(SolvedCache *cache)
+{
+    if (cache == NULL)
+        return 0;
+
+    int result = 0;
+    if (cache->fd >= 0)
+    {
+        if (cache->addedCount > 0)
+            result = appendRecords(cache);
+        close(cache->fd);
+    }
+
+    munmap(cache->mapping, cache->mappingSize);
+    pthread_mutex_destroy(&cache->mutex);
+    free(cache->added);
+    free(cache->index);
+    free(cache);
+    return result;
+}
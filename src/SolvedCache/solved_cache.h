@@ -0,0 +1,57 @@
+#ifndef SOLVED_CACHE_H
+#define SOLVED_CACHE_H
+
+/*
+ * Solved-position cache
+ * ---------------------
+ * A file of root positions the engine has solved with a full-depth search,
+ * each with the move and score the search returned, so later processes can
+ * answer them without searching again.
+ *
+ * A record is keyed by the exact position (2 bits per cell, row-major) and
+ * the player to move. The file is a versioned header naming the board shape,
+ * win length and candidate radius, followed by fixed-size records in the
+ * order they were added. Readers map it read-only with mmap and index it in
+ * memory; results found while running are kept in memory and appended to
+ * the file when the cache is closed.
+ */
+
+#include "../TicTacToe/tic_tac_toe.h"
+
+/** Opaque cache handle. */
+typedef struct SolvedCache SolvedCache;
+
+/**
+ * Map the cache at `path` read-only and index its records.
+ *
+ * Unless `readOnly` is set, a missing file is created, and the results
+ * recorded from now on are appended to it by closeSolvedCache().
+ * `candidateRadius` is the engine's (scores depend on it); a file written for
+ * another radius, board shape, win length or format version is refused.
+ *
+ * Returns NULL if the file cannot be opened, created or mapped, or does not
+ * match. The handle may be shared by any number of engines and threads.
+ */
+SolvedCache *openSolvedCache(const char *path, int candidateRadius, int readOnly);
+
+/**
+ * Look up the position with `player` to move. Returns 1 and the cell
+ * (row * BOARD_COLS + col) and score on a hit, 0 on a miss. A record whose
+ * cell is off the board or not empty in `board` counts as a miss.
+ */
+int probeSolvedCache(SolvedCache *cache, const char board[BOARD_ROWS][BOARD_COLS], char player, int *out_cell, int *out_score);
+
+/** Remember a solved position; ignored when it is already known or the cache is read-only. */
+void recordSolvedCache(SolvedCache *cache, const char board[BOARD_ROWS][BOARD_COLS], char player, int cell, int score);
+
+/**
+ * Append the recorded positions to the file (under an advisory lock, so
+ * several processes may share one file), then unmap and free the cache.
+ * NULL is ignored.
+ *
+ * Returns 0 on success, -1 if the new records could not be written (the
+ * file keeps its earlier records).
+ */
+int closeSolvedCache(SolvedCache *cache);
+
+#endif
@@ -0,0 +1,386 @@
+/*
+ * Retrograde tablebase for small Tic-Tac-Toe boards
+ * -------------------------------------------------
+ *
+ * Responsibilities in this file:
+ *  - Solve every position by backward induction over stone counts
+ *  - Write the values to a versioned file (header + one byte per code)
+ *  - Map the file read-only at runtime and answer probes by index
+ *
+ * The solver is self-contained (its own line masks and move loop) so the
+ * table does not depend on the search engine it is meant to replace.
+ */
+
+#define _POSIX_C_SOURCE 200112L
+#include "tablebase.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define TABLEBASE_MAGIC "TTTBASE"
+#define TABLEBASE_VERSION 2
+
+/* Codes are split into two halves of up to 8 cells for table-driven decoding. */
+#define HALF_CELLS 8
+#define HALF_CODES 6561 /* 3^8 */
+
+/* Windows of WIN_LENGTH cells along rows, columns and both diagonal directions. */
+#define WINDOW_STARTS(length) ((length) - WIN_LENGTH + 1)
+#define NUM_LINES (BOARD_ROWS * WINDOW_STARTS(BOARD_COLS) +       \
+                   BOARD_COLS * WINDOW_STARTS(BOARD_ROWS) +       \
+                   2 * WINDOW_STARTS(BOARD_ROWS) * WINDOW_STARTS(BOARD_COLS))
+
+/* File header; the value array follows immediately. */
+typedef struct
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t rows;
+    uint32_t cols;
+    uint32_t winLength;
+    uint64_t codeCount;
+} TablebaseHeader;
+
+struct Tablebase
+{
+    void *mapping;
+    size_t mappingSize;
+    const uint8_t *values;
+};
+
+static const uint32_t powersOfThree[TABLEBASE_MAX_CELLS + 1] = {
+    1, 3, 9, 27, 81, 243, 729, 2187, 6561, 19683, 59049, 177147,
+    531441, 1594323, 4782969, 14348907, 43046721};
+
+/* Number of codes for this board, or 0 when it is too large. */
+static uint64_t codeCount(void)
+{
+    return MAX_MOVES <= TABLEBASE_MAX_CELLS ? powersOfThree[MAX_MOVES] : 0;
+}
+
+/* Base-3 code of a position seen from the side to move. */
+static uint32_t positionCode(uint32_t mover, uint32_t other)
+{
+    uint32_t code = 0;
+    while (mover != 0)
+    {
+        code += powersOfThree[__builtin_ctz(mover)];
+        mover &= mover - 1;
+    }
+    while (other != 0)
+    {
+        code += 2 * powersOfThree[__builtin_ctz(other)];
+        other &= other - 1;
+    }
+    return code;
+}
+
+#if MAX_MOVES <= TABLEBASE_MAX_CELLS
+
+/* Per-half decoding tables and line masks used only while building. */
+typedef struct
+{
+    uint8_t moverHalf[HALF_CODES];
+    uint8_t otherHalf[HALF_CODES];
+    uint8_t stonesHalf[HALF_CODES];
+    uint16_t swappedHalf[HALF_CODES]; /* the same half with mover and opponent exchanged */
+    uint32_t lineMasks[NUM_LINES];
+    uint32_t cellLines[TABLEBASE_MAX_CELLS][4 * WIN_LENGTH]; /* windows through the cell */
+    int cellLineCount[TABLEBASE_MAX_CELLS];
+} BuildTables;
+
+static void initBuildTables(BuildTables *tables)
+{
+    for (int half = 0; half < HALF_CODES; ++half)
+    {
+        int rest = half;
+        tables->moverHalf[half] = 0;
+        tables->otherHalf[half] = 0;
+        tables->swappedHalf[half] = 0;
+        for (int cell = 0; cell < HALF_CELLS; ++cell)
+        {
+            int digit = rest % 3;
+            rest /= 3;
+            if (digit == 1)
+            {
+                tables->moverHalf[half] |= (uint8_t)(1u << cell);
+                tables->swappedHalf[half] += (uint16_t)(2 * powersOfThree[cell]);
+            }
+            else if (digit == 2)
+            {
+                tables->otherHalf[half] |= (uint8_t)(1u << cell);
+                tables->swappedHalf[half] += (uint16_t)powersOfThree[cell];
+            }
+        }
+        tables->stonesHalf[half] = (uint8_t)__builtin_popcount(tables->moverHalf[half] | tables->otherHalf[half]);
+    }
+
+    static const int directions[4][2] = {{0, 1}, {1, 0}, {1, 1}, {1, -1}};
+    memset(tables->lineMasks, 0, sizeof(tables->lineMasks));
+    memset(tables->cellLineCount, 0, sizeof(tables->cellLineCount));
+    int line = 0;
+    for (int d = 0; d < 4; ++d)
+    {
+        for (int row = 0; row < BOARD_ROWS; ++row)
+        {
+            for (int col = 0; col < BOARD_COLS; ++col)
+            {
+                int lastRow = row + directions[d][0] * (WIN_LENGTH - 1);
+                int lastCol = col + directions[d][1] * (WIN_LENGTH - 1);
+                if (lastRow >= BOARD_ROWS || lastCol < 0 || lastCol >= BOARD_COLS)
+                    continue;
+
+                for (int i = 0; i < WIN_LENGTH; ++i)
+                {
+                    int cell = (row + directions[d][0] * i) * BOARD_COLS + col + directions[d][1] * i;
+                    tables->lineMasks[line] |= 1u << cell;
+                    tables->cellLines[cell][tables->cellLineCount[cell]++] = line;
+                }
+                ++line;
+            }
+        }
+    }
+}
+
+static int hasLine(const BuildTables *tables, uint32_t stones)
+{
+    for (int line = 0; line < NUM_LINES; ++line)
+    {
+        if ((stones & tables->lineMasks[line]) == tables->lineMasks[line])
+            return 1;
+    }
+    return 0;
+}
+
+/* Non-zero if stones (which include cell) complete a line through cell. */
+static int completesLine(const BuildTables *tables, uint32_t stones, int cell)
+{
+    for (int i = 0; i < tables->cellLineCount[cell]; ++i)
+    {
+        uint32_t mask = tables->lineMasks[tables->cellLines[cell][i]];
+        if ((stones & mask) == mask)
+            return 1;
+    }
+    return 0;
+}
+
+static uint8_t packValue(TablebaseResult result, int distance)
+{
+    return (uint8_t)(result | (distance << 2));
+}
+
+/* Order values for the mover: faster wins first, then draws, then slower losses. */
+static int valueRank(uint8_t value)
+{
+    switch (TABLEBASE_RESULT(value))
+    {
+    case TABLEBASE_WIN:
+        return 1000 - TABLEBASE_DISTANCE(value);
+    case TABLEBASE_LOSS:
+        return -1000 + TABLEBASE_DISTANCE(value);
+    default:
+        return 0;
+    }
+}
+
+/*
+ * Value of a non-terminal position with every successor already solved.
+ * `swapped` is the code of the same position with the roles exchanged, so the
+ * successor after a move to `cell` sits at swapped + 2 * 3^cell.
+ */
+static uint8_t solveFromSuccessors(const BuildTables *tables, const uint8_t *values, uint32_t mover, uint32_t other, uint32_t swapped)
+{
+    uint32_t empties = ((1u << MAX_MOVES) - 1) & ~(mover | other);
+    uint8_t best = 0;
+    int bestRank = -2000;
+
+    while (empties != 0)
+    {
+        int cell = __builtin_ctz(empties);
+        empties &= empties - 1;
+
+        uint8_t value;
+        if (completesLine(tables, mover | (1u << cell), cell))
+        {
+            value = packValue(TABLEBASE_WIN, 1);
+        }
+        else
+        {
+            uint8_t reply = values[swapped + 2 * powersOfThree[cell]];
+            int distance = TABLEBASE_DISTANCE(reply) + 1;
+            if (TABLEBASE_RESULT(reply) == TABLEBASE_WIN)
+                value = packValue(TABLEBASE_LOSS, distance);
+            else if (TABLEBASE_RESULT(reply) == TABLEBASE_LOSS)
+                value = packValue(TABLEBASE_WIN, distance);
+            else
+                value = packValue(TABLEBASE_DRAW, distance);
+        }
+
+        int rank = valueRank(value);
+        if (rank > bestRank)
+        {
+            bestRank = rank;
+            best = value;
+        }
+    }
+    return best;
+}
+
+/* Fill values[] for every reachable stone count, from the full board down to the empty one. */
+static void solveAll(const BuildTables *tables, uint8_t *values, uint32_t count)
+{
+    for (int stones = MAX_MOVES; stones >= 0; --stones)
+    {
+        for (uint32_t code = 0; code < count; ++code)
+        {
+            uint32_t low = code % HALF_CODES;
+            uint32_t high = code / HALF_CODES;
+            if (tables->stonesHalf[low] + tables->stonesHalf[high] != stones)
+                continue;
+
+            uint32_t mover = tables->moverHalf[low] | ((uint32_t)tables->moverHalf[high] << HALF_CELLS);
+            uint32_t other = tables->otherHalf[low] | ((uint32_t)tables->otherHalf[high] << HALF_CELLS);
+            int moverStones = __builtin_popcount(mover);
+            int otherStones = stones - moverStones;
+            if (moverStones != otherStones && moverStones + 1 != otherStones)
+                continue;
+
+            if (hasLine(tables, other))
+                values[code] = packValue(TABLEBASE_LOSS, 0);
+            else if (hasLine(tables, mover))
+                values[code] = packValue(TABLEBASE_WIN, 0);
+            else if (stones == MAX_MOVES)
+                values[code] = packValue(TABLEBASE_DRAW, 0);
+            else
+                values[code] = solveFromSuccessors(tables, values, mover, other, tables->swappedHalf[low] + tables->swappedHalf[high] * HALF_CODES);
+        }
+    }
+}
+
+/* Write header and values to path via a temporary file and rename. */
+static int writeTablebase(const char *path, const uint8_t *values, uint64_t count)
+{
+    size_t pathLength = strlen(path);
+    char *temporaryPath = malloc(pathLength + 5);
+    if (temporaryPath == NULL)
+        return -1;
+    memcpy(temporaryPath, path, pathLength);
+    memcpy(temporaryPath + pathLength, ".tmp", 5);
+
+    TablebaseHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, TABLEBASE_MAGIC, sizeof(TABLEBASE_MAGIC));
+    header.version = TABLEBASE_VERSION;
+    header.rows = BOARD_ROWS;
+    header.cols = BOARD_COLS;
+    header.winLength = WIN_LENGTH;
+    header.codeCount = count;
+
+    int result = -1;
+    FILE *file = fopen(temporaryPath, "wb");
+    if (file != NULL)
+    {
+        int written = fwrite(&header, sizeof(header), 1, file) == 1 && fwrite(values, 1, count, file) == count;
+        if (fclose(file) == 0 && written && rename(temporaryPath, path) == 0)
+            result = 0;
+        else
+            remove(temporaryPath);
+    }
+
+    free(temporaryPath);
+    return result;
+}
+
+int buildTablebase(const char *path)
+{
+    uint64_t count = codeCount();
+    BuildTables *tables = malloc(sizeof(BuildTables));
+    uint8_t *values = calloc(count, 1);
+    if (tables == NULL || values == NULL)
+    {
+        free(tables);
+        free(values);
+        return -1;
+    }
+
+    initBuildTables(tables);
+    solveAll(tables, values, (uint32_t)count);
+    int result = writeTablebase(path, values, count);
+
+    free(tables);
+    free(values);
+    return result;
+}
+
+#else
+
+/* Boards larger than TABLEBASE_MAX_CELLS have too many codes to tabulate. */
+int buildTablebase(const char *path)
+{
+    (void)path;
+    return -1;
+}
+
+#endif
+
+Tablebase *openTablebase(const char *path)
+{
+    uint64_t count = codeCount();
+    if (count == 0)
+        return NULL;
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return NULL;
+
+    struct stat status;
+    size_t size = sizeof(TablebaseHeader) + (size_t)count;
+    if (fstat(fd, &status) != 0 || (uint64_t)status.st_size != size)
+    {
+        close(fd);
+        return NULL;
+    }
+
+    void *mapping = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED)
+        return NULL;
+
+    const TablebaseHeader *header = mapping;
+    Tablebase *tablebase = malloc(sizeof(Tablebase));
+    if (tablebase == NULL ||
+        memcmp(header->magic, TABLEBASE_MAGIC, sizeof(TABLEBASE_MAGIC)) != 0 ||
+        header->version != TABLEBASE_VERSION ||
+        header->rows != BOARD_ROWS ||
+        header->cols != BOARD_COLS ||
+        header->winLength != WIN_LENGTH ||
+        header->codeCount != count)
+    {
+        free(tablebase);
+        munmap(mapping, size);
+        return NULL;
+    }
+
+    tablebase->mapping = mapping;
+    tablebase->mappingSize = size;
+    tablebase->values = (const uint8_t *)mapping + sizeof(TablebaseHeader);
+    return tablebase;
+}
+
+void closeTablebase(Tablebase *tablebase)
+{
+    if (tablebase == NULL)
+        return;
+
+    munmap(tablebase->mapping, tablebase->mappingSize);
+    free(tablebase);
+}
+
+uint8_t probeTablebase(const Tablebase *tablebase, uint32_t mover, uint32_t other)
+{
+    return tablebase->values[positionCode(mover, other)];
+}
@@ -0,0 +1,76 @@
+#ifndef TABLEBASE_H
+#define TABLEBASE_H
+
+/*
+ * Tablebase (retrograde analysis)
+ * -------------------------------
+ * Public API for the precomputed game-theoretic value of every position of a
+ * board with at most TABLEBASE_MAX_CELLS cells (4x4 and smaller).
+ *
+ * Positions are described from the side to move: `mover` holds the stones of
+ * the player about to move and `other` those of the opponent, one bit per cell
+ * (bit row * BOARD_COLS + col). Each position is stored in one byte at its
+ * base-3 code (cell c contributes 3^c times 1 for a mover stone, 2 for an
+ * opponent stone):
+ *  - bits 0-1: TablebaseResult for the mover
+ *  - bits 2-7: distance in plies to the end of the game under best play
+ *    (the winner wins as fast as possible, the loser holds out longest)
+ *
+ * The file is a small header followed by the value array. Readers map it with
+ * mmap, so opening is cheap and processes using the same file share its pages.
+ */
+
+#include <stdint.h>
+#include "../TicTacToe/tic_tac_toe.h"
+
+/* Largest board (in cells) a tablebase can describe: 3^16 codes. */
+#define TABLEBASE_MAX_CELLS 16
+
+/** Game-theoretic result for the side to move. */
+typedef enum
+{
+    TABLEBASE_UNKNOWN = 0, /* position not in the table (unreachable stone counts) */
+    TABLEBASE_WIN = 1,
+    TABLEBASE_DRAW = 2,
+    TABLEBASE_LOSS = 3
+} TablebaseResult;
+
+#define TABLEBASE_RESULT(value) ((TablebaseResult)((value) & 3))
+#define TABLEBASE_DISTANCE(value) ((int)((value) >> 2))
+
+/** Opaque read-only tablebase handle. */
+typedef struct Tablebase Tablebase;
+
+/**
+ * Solve every position of the BOARD_ROWS x BOARD_COLS board (WIN_LENGTH in
+ * a row wins) by retrograde analysis and write the tablebase to `path`.
+ *
+ * Positions are solved from the full board backwards, one stone count at a
+ * time, so every successor is already known when a position is evaluated.
+ * Only stone counts that occur in a game are solved: the mover has as many
+ * stones as the opponent, or one fewer.
+ *
+ * The file is written under a temporary name and renamed into place, so
+ * readers never see a partial table. A 4x4 table takes 43 MB.
+ *
+ * Returns 0 on success, -1 if the board is too large or on an allocation or
+ * I/O failure.
+ */
+int buildTablebase(const char *path);
+
+/**
+ * Map the tablebase at `path` read-only.
+ *
+ * Returns NULL if the file cannot be mapped or was built for another board
+ * shape, win length or format version. The handle may be shared by any number of engines
+ * and threads.
+ */
+Tablebase *openTablebase(const char *path);
+
+/** Unmap the tablebase. NULL is ignored. */
+void closeTablebase(Tablebase *tablebase);
+
+/** Packed value (see above) of the position with the given stones. */
+uint8_t probeTablebase(const Tablebase *tablebase, uint32_t mover, uint32_t other);
+
+#endif
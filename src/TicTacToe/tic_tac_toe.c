@@ -4,6 +4,7 @@
  *
  * Responsibilities in this file:
  *  - Maintain global board state and player symbols
+ *  - Reentrant GameState variants of the move/result helpers
  *  - Basic I/O helpers for a terminal UI (reading moves, printing board)
  *  - Lightweight result checking after each move
  */
@@ -13,7 +14,7 @@
 #include "tic_tac_toe.h"
 
 /* Global game state used by the simple CLI program. */
-char board[BOARD_SIZE][BOARD_SIZE];
+char board[BOARD_ROWS][BOARD_COLS];
 char player_turn = 'x';
 int move_count = 0; /* number of moves played so far */
 char human_symbol = 'x';
@@ -41,37 +42,43 @@ static int numDigits(int number)
     return digitQuantity;
 }
 
-/* Initialize all board cells to ' ' (empty). */
-void initializeBoard()
+/* Set every cell of the given board to ' ' (empty). */
+static void clearBoard(char cells[BOARD_ROWS][BOARD_COLS])
 {
-    for (size_t i = 0; i < BOARD_SIZE; i++)
+    for (size_t i = 0; i < BOARD_ROWS; i++)
     {
-        for (size_t j = 0; j < BOARD_SIZE; j++)
+        for (size_t j = 0; j < BOARD_COLS; j++)
         {
-            board[i][j] = ' ';
+            cells[i][j] = ' ';
         }
     }
 }
 
+/* Initialize all board cells to ' ' (empty). */
+void initializeBoard()
+{
+    clearBoard(board);
+}
+
 /* Pretty-print the board with 1-based indices on both axes. */
 void printBoard()
 {
-    int digits = numDigits(BOARD_SIZE);
+    int digits = numDigits(BOARD_ROWS > BOARD_COLS ? BOARD_ROWS : BOARD_COLS);
 
     putchar('\n');
 
     printf("%*s", digits, "");
-    for (int c = 1; c <= BOARD_SIZE; ++c)
+    for (int c = 1; c <= BOARD_COLS; ++c)
     {
         printf(" %*d ", digits, c);
     }
     putchar('\n');
 
-    for (int i = 1; i <= BOARD_SIZE; ++i)
+    for (int i = 1; i <= BOARD_ROWS; ++i)
     {
         printf("%*d", digits, i);
 
-        for (int j = 1; j <= BOARD_SIZE; ++j)
+        for (int j = 1; j <= BOARD_COLS; ++j)
         {
             printf("[%*c]", digits, board[i - 1][j - 1]);
         }
@@ -131,16 +138,16 @@ void getMove(int *out_row, int *out_col)
                     exit(0);
                 }
 
-                printf("Invalid column input. Enter a number 1-%d.\n", BOARD_SIZE);
+                printf("Invalid column input. Enter a number 1-%d.\n", BOARD_COLS);
                 discardLine();
                 continue;
             }
 
             discardLine();
 
-            if (col_input < 1 || col_input > BOARD_SIZE)
+            if (col_input < 1 || col_input > BOARD_COLS)
             {
-                printf("Column out of range (1-%d).\n", BOARD_SIZE);
+                printf("Column out of range (1-%d).\n", BOARD_COLS);
                 continue;
             }
 
@@ -160,16 +167,16 @@ void getMove(int *out_row, int *out_col)
                     exit(0);
                 }
 
-                printf("Invalid row input. Enter a number 1-%d.\n", BOARD_SIZE);
+                printf("Invalid row input. Enter a number 1-%d.\n", BOARD_ROWS);
                 discardLine();
                 continue;
             }
 
             discardLine();
 
-            if (row_input < 1 || row_input > BOARD_SIZE)
+            if (row_input < 1 || row_input > BOARD_ROWS)
             {
-                printf("Row out of range (1-%d).\n", BOARD_SIZE);
+                printf("Row out of range (1-%d).\n", BOARD_ROWS);
                 continue;
             }
 
@@ -201,75 +208,50 @@ void makeMove(int row, int col)
     move_count++;
 }
 
+/* Count consecutive `player` stones from (row,col) stepping by (dr,dc), excluding the start cell. */
+static int countRun(const char cells[BOARD_ROWS][BOARD_COLS], char player, int row, int col, int dr, int dc)
+{
+    int run = 0;
+    for (int r = row + dr, c = col + dc; r >= 0 && r < BOARD_ROWS && c >= 0 && c < BOARD_COLS && cells[r][c] == player; r += dr, c += dc)
+        ++run;
+    return run;
+}
+
 /*
- * Check whether the last move at (row,col) finished the game.
- * Scans the affected row, column, and diagonals only.
- * Returns PLAYER_WIN/AI_WIN/TIE/CONTINUE.
+ * Shared result check for the global and reentrant APIs: counts the run of
+ * the mover's stones through (row,col) along the row, the column and both
+ * diagonals on the given board only. A run of WIN_LENGTH or more wins.
  */
-GameResult checkWinner(int row, int col)
+static GameResult evaluateLastMove(const char cells[BOARD_ROWS][BOARD_COLS], int moveCount, char humanSymbol, int row, int col)
 {
-    char player = board[row][col];
-
-    int win = 1;
-    for (int c = 0; c < BOARD_SIZE; ++c)
-    {
-        if (board[row][c] != player)
-        {
-            win = 0;
-            break;
-        }
-    }
-    if (win)
-        return (player == human_symbol) ? PLAYER_WIN : AI_WIN;
+    static const int directions[4][2] = {{0, 1}, {1, 0}, {1, 1}, {1, -1}};
+    char player = cells[row][col];
 
-    win = 1;
-    for (int r = 0; r < BOARD_SIZE; ++r)
+    for (int d = 0; d < 4; ++d)
     {
-        if (board[r][col] != player)
-        {
-            win = 0;
-            break;
-        }
+        int dr = directions[d][0];
+        int dc = directions[d][1];
+        int run = 1 + countRun(cells, player, row, col, dr, dc) + countRun(cells, player, row, col, -dr, -dc);
+        if (run >= WIN_LENGTH)
+            return (player == humanSymbol) ? PLAYER_WIN : AI_WIN;
     }
-    if (win)
-        return (player == human_symbol) ? PLAYER_WIN : AI_WIN;
 
-    if (row == col)
-    {
-        win = 1;
-        for (int i = 0; i < BOARD_SIZE; ++i)
-        {
-            if (board[i][i] != player)
-            {
-                win = 0;
-                break;
-            }
-        }
-        if (win)
-            return (player == human_symbol) ? PLAYER_WIN : AI_WIN;
-    }
-
-    if (row + col == BOARD_SIZE - 1)
-    {
-        win = 1;
-        for (int i = 0; i < BOARD_SIZE; ++i)
-        {
-            if (board[i][BOARD_SIZE - 1 - i] != player)
-            {
-                win = 0;
-                break;
-            }
-        }
-        if (win)
-            return (player == human_symbol) ? PLAYER_WIN : AI_WIN;
-    }
-
-    if (move_count < MAX_MOVES)
+    if (moveCount < MAX_MOVES)
         return GAME_CONTINUE;
 
     return GAME_TIE;
 }
 
+/*
+ * Check whether the last move at (row,col) finished the game.
+ * Scans the runs through the affected cell only.
+ * Returns PLAYER_WIN/AI_WIN/TIE/CONTINUE.
+ */
+GameResult checkWinner(int row, int col)
+{
+    return evaluateLastMove(board, move_count, human_symbol, row, col);
+}
+
 /* Reset the board and counters to start a fresh game. */
 void restartGame(void)
 {
@@ -278,6 +260,33 @@ void restartGame(void)
     player_turn = 'x';
 }
 
+/* Reentrant makeMove on an explicit GameState. */
+void makeMoveState(GameState *state, int row, int col)
+{
+    state->board[row][col] = state->player_turn;
+    state->player_turn = (state->player_turn == 'x') ? 'o' : 'x';
+    state->move_count++;
+}
+
+/* Reentrant checkWinner on an explicit GameState. */
+GameResult checkWinnerState(const GameState *state, int row, int col)
+{
+    return evaluateLastMove(state->board, state->move_count, state->human_symbol, row, col);
+}
+
+/* Reentrant restartGame on an explicit GameState. */
+void restartGameState(GameState *state)
+{
+    clearBoard(state->board);
+    state->move_count = 0;
+    state->player_turn = 'x';
+    if (state->human_symbol != 'x' && state->human_symbol != 'o')
+    {
+        state->human_symbol = 'x';
+        state->ai_symbol = 'o';
+    }
+}
+
 /* Ask user to restart; returns 1 for yes, 0 for no. */
 int askRestart(void)
 {
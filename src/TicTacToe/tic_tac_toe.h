@@ -5,12 +5,16 @@
  * evaluation. The engine logic (minimax) is in MiniMax/.
  *
  * Board representation:
- *  - 2D char array board[BOARD_SIZE][BOARD_SIZE]
+ *  - 2D char array board[BOARD_ROWS][BOARD_COLS]
  *  - 'x' / 'o' for players, ' ' (space) for empty
  *
- * Configuration:
- *  - BOARD_SIZE (default 3, can be overridden at compile-time)
- *  - MAX_MOVES = BOARD_SIZE * BOARD_SIZE
+ * Configuration (all can be overridden at compile-time):
+ *  - BOARD_SIZE (default 3): side of a square board
+ *  - BOARD_ROWS, BOARD_COLS (default BOARD_SIZE): rectangular boards
+ *  - WIN_LENGTH (default: the shorter side): stones in a row needed to win,
+ *    so the defaults are classic Tic-Tac-Toe and e.g. 15x15 with
+ *    WIN_LENGTH 5 is Gomoku
+ *  - MAX_MOVES = BOARD_ROWS * BOARD_COLS
  */
 
 #ifndef TIC_TAC_TOE_H
@@ -26,7 +30,37 @@ extern "C"
 #define BOARD_SIZE 3
 #endif
 
-#define MAX_MOVES ((BOARD_SIZE) * (BOARD_SIZE))
+/*
+ * Size kernels (see Kernels/board_kernel.h) compile the game, engine and
+ * tablebase once per square size N with -DBOARD_KERNEL=N, which overrides the
+ * board shape and gives every public symbol an _N suffix.
+ */
+#ifdef BOARD_KERNEL
+#undef BOARD_SIZE
+#undef BOARD_ROWS
+#undef BOARD_COLS
+#define BOARD_SIZE BOARD_KERNEL
+#include "../Kernels/kernel_names.h"
+#endif
+
+/* Board dimensions; override via -DBOARD_ROWS=M -DBOARD_COLS=N for a rectangle. */
+#ifndef BOARD_ROWS
+#define BOARD_ROWS BOARD_SIZE
+#endif
+#ifndef BOARD_COLS
+#define BOARD_COLS BOARD_SIZE
+#endif
+
+/* Stones in a row (horizontally, vertically or diagonally) that win; -DWIN_LENGTH=K. */
+#ifndef WIN_LENGTH
+#define WIN_LENGTH ((BOARD_ROWS) < (BOARD_COLS) ? (BOARD_ROWS) : (BOARD_COLS))
+#endif
+
+#if WIN_LENGTH < 1 || WIN_LENGTH > BOARD_ROWS || WIN_LENGTH > BOARD_COLS
+#error "WIN_LENGTH must be between 1 and the shorter side of the board"
+#endif
+
+#define MAX_MOVES ((BOARD_ROWS) * (BOARD_COLS))
 
     /** Game outcome from the point-of-view of the UI. */
     typedef enum
@@ -37,8 +71,22 @@ extern "C"
         GAME_TIE = 3
     } GameResult;
 
+    /**
+     * Self-contained game state for code that runs several games at once
+     * (e.g. threaded self-play). Used with the *State function variants below,
+     * which touch nothing but the struct they are given.
+     */
+    typedef struct
+    {
+        char board[BOARD_ROWS][BOARD_COLS];
+        char player_turn;  /* whose turn it is: 'x' or 'o' */
+        int move_count;    /* number of moves played so far */
+        char human_symbol; /* symbol reported as PLAYER_WIN by checkWinnerState */
+        char ai_symbol;
+    } GameState;
+
     /* Global game state (simple CLI program design). */
-    extern char board[BOARD_SIZE][BOARD_SIZE];
+    extern char board[BOARD_ROWS][BOARD_COLS];
     extern char player_turn;  /* whose turn it is: 'x' or 'o' */
     extern char human_symbol; /* player's chosen symbol */
     extern char ai_symbol;    /* AI's symbol (opposite of human_symbol) */
@@ -63,7 +111,8 @@ extern "C"
     void makeMove(int row, int col);
 
     /**
-     * Check if the last move at (row,col) decided the game.
+     * Check if the last move at (row,col) decided the game, i.e. completed
+     * WIN_LENGTH stones in a row through that cell.
      * Returns PLAYER_WIN or AI_WIN based on the symbol at that cell,
      * GAME_TIE if the board is full, or GAME_CONTINUE otherwise.
      */
@@ -72,6 +121,19 @@ extern "C"
     /** Reset board, move counter, and player_turn to initial state. */
     void restartGame(void);
 
+    /** Reentrant makeMove: apply a move for state->player_turn and flip the turn. */
+    void makeMoveState(GameState *state, int row, int col);
+
+    /** Reentrant checkWinner: evaluate the last move at (row,col) in state. */
+    GameResult checkWinnerState(const GameState *state, int row, int col);
+
+    /**
+     * Reentrant restartGame: empty the board, zero the move counter and give
+     * 'x' the first move. Symbols of a zero-initialized state default to
+     * human 'x', AI 'o'.
+     */
+    void restartGameState(GameState *state);
+
     /** Ask the user whether to restart; returns 1 for yes, 0 for no. */
     int askRestart(void);
 
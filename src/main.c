@@ -1,10 +1,40 @@
 /*
  * Program entry and CLI modes
  * ---------------------------
+ * Parses the command line, picks the board-size kernel for --size and runs
+ * the requested mode through it (see Kernels/board_kernel.h).
+ *
  * - Interactive game loop (human vs AI)
- * - Self-play benchmarking via --selfplay|-s [games] [--quiet|-q]
+ * - Self-play benchmarking via --selfplay|-s [games] [--quiet|-q] [--threads N]
  *   * Default games: 1000 when omitted
  *   * --quiet/-q suppresses timing output
+ *   * --threads N shards the games over N threads
+ * - Position benchmark via --bench (see Bench/bench.h)
+ * - Engine server via --serve [SOCKET] on stdin/stdout or a UNIX socket
+ *   (protocol in Serve/serve.h)
+ * - --stats prints search statistics after self-play or each interactive AI
+ *   move (builds with SEARCH_STATS=1)
+ * - --analyze scores every move before each interactive human turn
+ * - Engine options accepted in any mode:
+ *   * --size N plays on an N x N board (default BOARD_SIZE; any built kernel size)
+ *   * --tt-mb N sizes the transposition table (0 disables it)
+ *   * --no-symmetry stops symmetric positions from sharing table entries
+ *   * --movetime MS limits each AI move to MS milliseconds (iterative deepening)
+ *   * --depth N limits each AI move to N plies, scoring the horizon statically
+ *   * --search-threads N searches root moves on N threads
+ *   * --keep-history keeps move-ordering history between the AI's moves
+ *   * --root-driver pvs|aspiration|mtdf picks how the root search converges
+ *   * --engine minimax|mcts picks the move search; for mcts, --playouts N
+ *     and --movetime MS bound each move, --search-threads N share one tree,
+ *     --tree-mb N sizes it and --random-playouts turns off the light policy
+ *     (--bench then measures playout rates on 1 to 32 threads)
+ *   * --tablebase FILE answers moves from a tablebase instead of searching
+ *   * --cache-file FILE keeps solved positions in FILE across runs
+ *     (--cache-readonly only reads it)
+ * - Tablebase generation via --build-tablebase FILE (boards up to 4x4)
+ * - Win/draw/loss proof of one position via --solve CELLS (see
+ *   ProofSearch/proof_search.h); --tt-mb bounds its memory and
+ *   --solve-nodes N its work (0 for no limit)
  */
 
 #define _POSIX_C_SOURCE 199309L
@@ -12,143 +42,334 @@
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
-#include "TicTacToe/tic_tac_toe.h"
-#include "MiniMax/mini_max.h"
+#include "Bench/bench.h"
+#include "Kernels/board_kernel.h"
+#include "Serve/serve.h"
 
-/*
- * Interactive human vs AI loop. Prompts the user to choose a symbol, then
- * alternates between human input and AI selection until the game ends.
- */
-static void playGame(void)
-{
-    while (1)
-    {
-        restartGame();
-        choosePlayerSymbol();
-        if (player_turn != ai_symbol)
-            printBoard();
+/* Default --solve-nodes: expansions before --solve gives up and reports "unknown". */
+#define DEFAULT_SOLVE_NODES 100000000ULL
 
-        while (1)
-        {
-            int row, col;
+/* Print the sizes of the built kernels, e.g. "3 4 5 6 7 8". */
+static void printKernelSizes(FILE *stream)
+{
+    for (int i = 0; boardKernels[i] != NULL; ++i)
+        fprintf(stream, "%s%d", i > 0 ? " " : "", boardKernels[i]->size);
+    fputc('\n', stream);
+}
 
-            if (player_turn == human_symbol)
-            {
-                getMove(&row, &col);
-                makeMove(row, col);
-                GameResult result = checkWinner(row, col);
-
-                if (result != GAME_CONTINUE)
-                {
-                    printGameResult(result);
-                    break;
-                }
-            }
-            else
-            {
-                int ai_row, ai_col;
-                getAiMove(board, ai_symbol, &ai_row, &ai_col);
-                makeMove(ai_row, ai_col);
-                printf("AI plays (%d, %d)\n", ai_col + 1, ai_row + 1);
-                GameResult result = checkWinner(ai_row, ai_col);
-
-                if (result != GAME_CONTINUE)
-                {
-                    printGameResult(result);
-                    break;
-                }
-                else
-                {
-                    printBoard();
-                }
-            }
-        }
+/* Solve the board by retrograde analysis and write the tablebase to path. */
+static int buildTablebaseFile(const BoardKernel *kernel, const char *path)
+{
+    struct timespec startTime;
+    struct timespec endTime;
 
-        if (!askRestart())
-            return;
+    printf("Building %dx%d tablebase into %s...\n", kernel->size, kernel->size, path);
+    fflush(stdout);
+    clock_gettime(CLOCK_MONOTONIC, &startTime);
+    if (kernel->buildTablebase(path) != 0)
+    {
+        fprintf(stderr, "Could not build a tablebase at %s (boards up to %d cells are supported).\n", path, TABLEBASE_MAX_CELLS);
+        return 1;
     }
+    clock_gettime(CLOCK_MONOTONIC, &endTime);
+
+    double elapsed = (endTime.tv_sec - startTime.tv_sec) + (endTime.tv_nsec - startTime.tv_nsec) / 1e9;
+    printf("Done in %.3f s.\n", elapsed);
+    return 0;
 }
 
 /*
- * Self-play benchmarking: runs gameCount AI vs AI games starting from an empty
- * board, alternating turns. Collects win/tie stats and (optionally) prints
- * timing and throughput.
- *
- * Parameters:
- *  - gameCount: number of games to run
- *  - quiet:     when non-zero, suppress timing output
+ * Prove the value of one position with the proof-number solver and print it.
+ * Returns 0 once the value is proven, 1 on an invalid position, a lack of
+ * memory or a node budget that ran out first.
  */
-static int selfPlay(int gameCount, int quiet)
+static int solvePositionText(const BoardKernel *kernel, const char *text, size_t ttMegabytes, unsigned long long maxNodes)
 {
-    int ai1Wins = 0;
-    int ai2Wins = 0;
-    int ties = 0;
+    static const char *const valueNames[] = {"unknown", "win", "draw", "loss"};
     struct timespec startTime;
     struct timespec endTime;
 
-    if (!quiet)
-        clock_gettime(CLOCK_MONOTONIC, &startTime);
-
-    for (int g = 0; g < gameCount; ++g)
+    char *cells = malloc((size_t)kernel->size * (size_t)kernel->size);
+    char player;
+    if (cells == NULL || parseBoardText(text, kernel->size, cells, &player) != 0)
     {
-        restartGame();
-
-        while (1)
-        {
-            int currentRow = -1;
-            int currentCol = -1;
-            char currentPlayer = player_turn;
-
-            getAiMove(board, currentPlayer, &currentRow, &currentCol);
-            makeMove(currentRow, currentCol);
-            GameResult result = checkWinner(currentRow, currentCol);
-
-            if (result != GAME_CONTINUE)
-            {
-                if (result == GAME_TIE)
-                    ++ties;
-                else if (currentPlayer == 'x')
-                    ++ai1Wins;
-                else
-                    ++ai2Wins;
-                break;
-            }
-        }
+        fprintf(stderr, "Invalid %dx%d position: %s (rows of x, o or ., separated by /)\n", kernel->size, kernel->size, text);
+        free(cells);
+        return 1;
     }
 
-    if (!quiet)
+    SolveResult result;
+    clock_gettime(CLOCK_MONOTONIC, &startTime);
+    int status = kernel->solvePosition(cells, player, ttMegabytes, maxNodes, &result);
+    clock_gettime(CLOCK_MONOTONIC, &endTime);
+    free(cells);
+    if (status < 0)
     {
-        clock_gettime(CLOCK_MONOTONIC, &endTime);
-        double elapsed = (endTime.tv_sec - startTime.tv_sec) + (endTime.tv_nsec - startTime.tv_nsec) / 1e9;
-        double throughput = elapsed > 0 ? (gameCount / elapsed) : 0.0;
-        printf("Self-play finished: %d games. AI1Wins=%d AI2Wins=%d Ties=%d\n", gameCount, ai1Wins, ai2Wins, ties);
-        printf("Elapsed: %.3f s, Throughput: %.1f games/s\n", elapsed, throughput);
+        fprintf(stderr, "Out of memory.\n");
+        return 1;
     }
 
-    return 0;
+    double elapsed = (endTime.tv_sec - startTime.tv_sec) + (endTime.tv_nsec - startTime.tv_nsec) / 1e9;
+    printf("%c to move: %s", player, valueNames[result.value]);
+    if (status == 1)
+        printf(" (node budget of %llu ran out; raise it with --solve-nodes)", maxNodes);
+    if (result.row >= 0)
+        printf(", %s (%d, %d)", result.value == SOLVE_LOSS ? "every move loses, e.g." : "by playing",
+               result.col + 1, result.row + 1);
+    printf("\nNodes: %llu, time: %.3f s\n", result.nodes, elapsed);
+    return status == 1 ? 1 : 0;
 }
 
 /*
  * CLI:
  *  - Default (no args): interactive human vs AI game
- *  - --selfplay|-s [games] [--quiet|-q]: run AI vs AI for N games (default 1000)
+ *  - --selfplay|-s [games] [--quiet|-q] [--threads N]: run AI vs AI for N games (default 1000)
+ *  - --stats: print search statistics (self-play and interactive)
+ *  - --analyze: print the score of every move before each human turn (interactive)
+ *  - --bench: search the benchmark suite and exit (engine options apply)
+ *  - --serve [SOCKET]: answer move requests on stdin/stdout, or on a UNIX socket
+ *  - --size N: board size (any mode)
+ *  - --tt-mb N: transposition table size in megabytes (any mode)
+ *  - --no-symmetry: key the table by raw orientation only (any mode)
+ *  - --movetime MS: per-move time budget for the AI (any mode)
+ *  - --depth N: per-move depth limit for the AI (any mode)
+ *  - --search-threads N: parallel root search on N threads (any mode)
+ *  - --keep-history: carry move-ordering history across moves (any mode)
+ *  - --root-driver pvs|aspiration|mtdf: root search driver (any mode)
+ *  - --engine minimax|mcts: move search backend (any mode)
+ *  - --playouts N, --tree-mb N, --random-playouts: MCTS budget, tree size and policy (any mode)
+ *  - --tablebase FILE: play from a tablebase built earlier (any mode)
+ *  - --cache-file FILE [--cache-readonly]: persistent solved-position cache (any mode)
+ *  - --build-tablebase FILE: solve the board, write the tablebase and exit
+ *  - --solve CELLS [--solve-nodes N]: prove win/draw/loss for the side to move and exit
  */
 int main(int argc, char **argv)
 {
-    if (argc >= 2 && (strcmp(argv[1], "--selfplay") == 0 || strcmp(argv[1], "-s") == 0))
+    int selfplay = 0;
+    int bench = 0;
+    int serve = 0;
+    const char *socketPath = NULL;
+    int games = 1000;
+    int quiet = 0;
+    int threads = 1;
+    int showStats = 0;
+    int showAnalysis = 0;
+    int size = BOARD_SIZE;
+    const char *tablebasePath = NULL;
+    const char *buildPath = NULL;
+    const char *solveText = NULL;
+    unsigned long long solveNodes = DEFAULT_SOLVE_NODES;
+    const char *cachePath = NULL;
+    int cacheReadOnly = 0;
+    MiniMaxConfig engineConfig;
+
+    /* the size picks the kernel, whose defaults the other options then change */
+    for (int i = 1; i + 1 < argc; ++i)
+    {
+        if (strcmp(argv[i], "--size") == 0)
+            size = atoi(argv[i + 1]);
+    }
+
+    const BoardKernel *kernel = findBoardKernel(size);
+    if (kernel == NULL)
+    {
+        fprintf(stderr, "Unsupported board size %d. Built sizes: ", size);
+        printKernelSizes(stderr);
+        return 1;
+    }
+    kernel->defaultConfig(&engineConfig);
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--selfplay") == 0 || strcmp(argv[i], "-s") == 0)
+        {
+            selfplay = 1;
+            if (i + 1 < argc && argv[i + 1][0] >= '0' && argv[i + 1][0] <= '9')
+                games = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--quiet") == 0 || strcmp(argv[i], "-q") == 0)
+        {
+            quiet = 1;
+        }
+        else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+        {
+            threads = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--bench") == 0)
+        {
+            bench = 1;
+        }
+        else if (strcmp(argv[i], "--serve") == 0)
+        {
+            serve = 1;
+            if (i + 1 < argc && argv[i + 1][0] != '-')
+                socketPath = argv[++i];
+        }
+        else if (strcmp(argv[i], "--stats") == 0)
+        {
+            showStats = 1;
+        }
+        else if (strcmp(argv[i], "--analyze") == 0)
+        {
+            showAnalysis = 1;
+        }
+        else if (strcmp(argv[i], "--size") == 0 && i + 1 < argc)
+        {
+            ++i; /* handled above */
+        }
+        else if (strcmp(argv[i], "--tt-mb") == 0 && i + 1 < argc)
+        {
+            long megabytes = atol(argv[++i]);
+            if (megabytes < 0)
+            {
+                fprintf(stderr, "Invalid transposition table size: %s\n", argv[i]);
+                return 1;
+            }
+            engineConfig.ttMegabytes = (size_t)megabytes;
+        }
+        else if (strcmp(argv[i], "--no-symmetry") == 0)
+        {
+            engineConfig.useSymmetry = 0;
+        }
+        else if (strcmp(argv[i], "--movetime") == 0 && i + 1 < argc)
+        {
+            engineConfig.moveTimeMs = atol(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--depth") == 0 && i + 1 < argc)
+        {
+            engineConfig.maxDepth = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--search-threads") == 0 && i + 1 < argc)
+        {
+            engineConfig.searchThreads = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--keep-history") == 0)
+        {
+            engineConfig.keepHistory = 1;
+        }
+        else if (strcmp(argv[i], "--root-driver") == 0 && i + 1 < argc)
+        {
+            const char *name = argv[++i];
+            if (strcmp(name, "pvs") == 0)
+                engineConfig.rootDriver = ROOT_DRIVER_PVS;
+            else if (strcmp(name, "aspiration") == 0)
+                engineConfig.rootDriver = ROOT_DRIVER_ASPIRATION;
+            else if (strcmp(name, "mtdf") == 0)
+                engineConfig.rootDriver = ROOT_DRIVER_MTDF;
+            else
+            {
+                fprintf(stderr, "Unknown root driver: %s (expected pvs, aspiration or mtdf)\n", name);
+                return 1;
+            }
+        }
+        else if (strcmp(argv[i], "--engine") == 0 && i + 1 < argc)
+        {
+            const char *name = argv[++i];
+            if (strcmp(name, "minimax") == 0)
+                engineConfig.backend = SEARCH_BACKEND_MINIMAX;
+            else if (strcmp(name, "mcts") == 0)
+                engineConfig.backend = SEARCH_BACKEND_MCTS;
+            else
+            {
+                fprintf(stderr, "Unknown engine: %s (expected minimax or mcts)\n", name);
+                return 1;
+            }
+        }
+        else if (strcmp(argv[i], "--playouts") == 0 && i + 1 < argc)
+        {
+            engineConfig.maxPlayouts = strtoull(argv[++i], NULL, 10);
+        }
+        else if (strcmp(argv[i], "--tree-mb") == 0 && i + 1 < argc)
+        {
+            long megabytes = atol(argv[++i]);
+            if (megabytes < 1)
+            {
+                fprintf(stderr, "Invalid tree size: %s\n", argv[i]);
+                return 1;
+            }
+            engineConfig.treeMegabytes = (size_t)megabytes;
+        }
+        else if (strcmp(argv[i], "--random-playouts") == 0)
+        {
+            engineConfig.lightPlayouts = 0;
+        }
+        else if (strcmp(argv[i], "--tablebase") == 0 && i + 1 < argc)
+        {
+            tablebasePath = argv[++i];
+        }
+        else if (strcmp(argv[i], "--cache-file") == 0 && i + 1 < argc)
+        {
+            cachePath = argv[++i];
+        }
+        else if (strcmp(argv[i], "--cache-readonly") == 0)
+        {
+            cacheReadOnly = 1;
+        }
+        else if (strcmp(argv[i], "--build-tablebase") == 0 && i + 1 < argc)
+        {
+            buildPath = argv[++i];
+        }
+        else if (strcmp(argv[i], "--solve") == 0 && i + 1 < argc)
+        {
+            solveText = argv[++i];
+        }
+        else if (strcmp(argv[i], "--solve-nodes") == 0 && i + 1 < argc)
+        {
+            solveNodes = strtoull(argv[++i], NULL, 10);
+        }
+    }
+
+    if (buildPath != NULL)
+        return buildTablebaseFile(kernel, buildPath);
+    if (solveText != NULL)
+        return solvePositionText(kernel, solveText, engineConfig.ttMegabytes, solveNodes);
+    if (bench)
+        return engineConfig.backend == SEARCH_BACKEND_MCTS ? runPlayoutBenchmark(&engineConfig, size)
+                                                          : runBenchmark(&engineConfig);
+
+    if (showStats && !SEARCH_STATS)
     {
-        int games = 1000;
-        int quiet = 0;
-        if (argc >= 3)
-            games = atoi(argv[2]);
-        for (int i = 3; i < argc; ++i)
+        fprintf(stderr, "Search statistics are not compiled in; rebuild with make SEARCH_STATS=1.\n");
+        return 1;
+    }
+
+    Tablebase *tablebase = NULL;
+    if (tablebasePath != NULL)
+    {
+        tablebase = kernel->openTablebase(tablebasePath);
+        if (tablebase == NULL)
         {
-            if (strcmp(argv[i], "--quiet") == 0 || strcmp(argv[i], "-q") == 0)
-                quiet = 1;
+            fprintf(stderr, "Could not open a %dx%d tablebase at %s.\n", size, size, tablebasePath);
+            return 1;
         }
-        return selfPlay(games, quiet);
+        engineConfig.tablebase = tablebase;
     }
 
-    playGame();
-    return 0;
+    SolvedCache *solvedCache = NULL;
+    if (cachePath != NULL)
+    {
+        solvedCache = kernel->openSolvedCache(cachePath, engineConfig.candidateRadius, cacheReadOnly);
+        if (solvedCache == NULL)
+        {
+            fprintf(stderr, "Could not open a %dx%d solved-position cache at %s (missing, or written for another board or candidate radius).\n",
+                    size, size, cachePath);
+            kernel->closeTablebase(tablebase);
+            return 1;
+        }
+        engineConfig.solvedCache = solvedCache;
+    }
+
+    int status;
+    if (serve)
+        status = runServer(&engineConfig, size, socketPath);
+    else
+        status = selfplay ? kernel->selfPlay(&engineConfig, games, quiet, threads, showStats)
+                          : kernel->playGame(&engineConfig, showStats, showAnalysis);
+    if (kernel->closeSolvedCache(solvedCache) != 0)
+    {
+        fprintf(stderr, "Could not save new solved positions to %s.\n", cachePath);
+        status = 1;
+    }
+    kernel->closeTablebase(tablebase);
+    return status;
 }